@@ -0,0 +1,227 @@
+#include "Benchmark.h"
+#include "MemoryStats.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+/**
+ * @brief Registra un caso para uno o varios tamaños.
+ *
+ * @param name Nombre del caso.
+ * @param sizes Tamaños a medir.
+ * @param setup Prepara los datos para un tamaño y devuelve el cuerpo.
+ */
+void BenchmarkSuite::add(const std::string& name, const std::vector<std::size_t>& sizes, Setup setup) {
+    m_cases.push_back({ name, sizes, std::move(setup) });
+}
+
+/**
+ * @brief Registra una comprobación de `--verify`.
+ *
+ * @param name Nombre de la comprobación.
+ * @param check Función que verifica un resultado exacto.
+ */
+void BenchmarkSuite::addCheck(const std::string& name, Check check) {
+    m_checks.emplace_back(name, std::move(check));
+}
+
+/**
+ * @brief Lee las opciones de la línea de comandos.
+ *
+ * @param argc Número de argumentos.
+ * @param argv Argumentos del programa.
+ * @return false si alguna opción es inválida.
+ */
+bool BenchmarkSuite::parseCommandLine(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (option == "--filter" && hasValue) {
+            m_filter = argv[++i];
+        }
+        else if (option == "--samples" && hasValue) {
+            m_samples = std::max<std::size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (option == "--min-time" && hasValue) {
+            m_minSampleMs = std::max(0.1, std::strtod(argv[++i], nullptr));
+        }
+        else if (option == "--json" && hasValue) {
+            m_jsonPath = argv[++i];
+        }
+        else if (option == "--list") {
+            m_listOnly = true;
+        }
+        else if (option == "--verify") {
+            m_verify = true;
+        }
+        else {
+            std::cerr << "BenchmarkSuite : opción desconocida o incompleta '" << option << "'\n"
+                      << "uso: Benchmarks [--filter TEXTO] [--samples N] [--min-time MS] [--json ARCHIVO] [--list] [--verify]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Ejecuta los casos seleccionados.
+ *
+ * @return Código de salida (0 si todo salió bien).
+ */
+int BenchmarkSuite::run() {
+    m_results.clear();
+    if (m_verify) {
+        return runChecks();
+    }
+
+    if (!m_listOnly) {
+        std::cout << std::left << std::setw(36) << "benchmark" << std::right << std::setw(9) << "size"
+                  << std::setw(14) << "ns/op" << std::setw(14) << "min" << std::setw(14) << "max"
+                  << std::setw(12) << "allocs/op" << "\n";
+    }
+
+    for (const Case& benchmark : m_cases) {
+        if (!m_filter.empty() && benchmark.name.find(m_filter) == std::string::npos) {
+            continue;
+        }
+        for (std::size_t size : benchmark.sizes) {
+            if (m_listOnly) {
+                std::cout << benchmark.name << "/" << size << "\n";
+                continue;
+            }
+
+            BenchmarkResult result = measure(benchmark, size);
+            m_results.push_back(result);
+            std::cout << std::left << std::setw(36) << result.name << std::right << std::setw(9) << result.size
+                      << std::fixed << std::setprecision(2)
+                      << std::setw(14) << result.medianNs << std::setw(14) << result.minNs
+                      << std::setw(14) << result.maxNs << std::setw(12) << result.allocationsPerOp
+                      << std::defaultfloat << std::endl;
+        }
+    }
+
+    if (!m_jsonPath.empty() && !writeJson(m_jsonPath)) {
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Resultados de la última ejecución.
+ *
+ * @return Un resultado por caso y tamaño.
+ */
+const std::vector<BenchmarkResult>& BenchmarkSuite::getResults() const {
+    return m_results;
+}
+
+/**
+ * @brief Ejecuta las comprobaciones seleccionadas.
+ *
+ * @return Código de salida (0 si todas pasaron).
+ */
+int BenchmarkSuite::runChecks() const {
+    std::size_t failures = 0;
+    std::size_t executed = 0;
+    for (const auto& [name, check] : m_checks) {
+        if (!m_filter.empty() && name.find(m_filter) == std::string::npos) {
+            continue;
+        }
+        std::string detail;
+        bool passed = check(detail);
+        ++executed;
+        std::cout << (passed ? "[ OK ] " : "[FAIL] ") << name;
+        if (!passed) {
+            ++failures;
+            std::cout << " : " << detail;
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << executed - failures << "/" << executed << " comprobaciones correctas" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Mide un caso para un tamaño.
+ *
+ * @param benchmark Caso a medir.
+ * @param size Tamaño del problema.
+ * @return Resultado medido.
+ */
+BenchmarkResult BenchmarkSuite::measure(const Case& benchmark, std::size_t size) const {
+    using Clock = std::chrono::steady_clock;
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.size = size;
+    result.samples = m_samples;
+
+    Body body = benchmark.setup(size);
+    const double operations = static_cast<double>(std::max<std::size_t>(1, size));
+
+    // Calentamiento y calibración: duplicar repeticiones hasta llenar la muestra mínima.
+    body();
+    std::size_t iterations = 1;
+    while (true) {
+        Clock::time_point start = Clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            body();
+        }
+        double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        if (elapsedMs >= m_minSampleMs || iterations >= (std::size_t(1) << 30)) {
+            break;
+        }
+        iterations *= 2;
+    }
+    result.iterations = iterations;
+
+    std::vector<double> samples;
+    samples.reserve(m_samples);
+    sf::Uint64 allocationsBefore = MemoryStats::getAllocationCount();
+    for (std::size_t sample = 0; sample < m_samples; ++sample) {
+        Clock::time_point start = Clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            body();
+        }
+        double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        samples.push_back(elapsedNs / (static_cast<double>(iterations) * operations));
+    }
+    sf::Uint64 allocations = MemoryStats::getAllocationCount() - allocationsBefore;
+
+    std::sort(samples.begin(), samples.end());
+    result.medianNs = samples[samples.size() / 2];
+    result.minNs = samples.front();
+    result.maxNs = samples.back();
+    result.allocationsPerOp = static_cast<double>(allocations) /
+                              (static_cast<double>(iterations) * m_samples * operations);
+    return result;
+}
+
+/**
+ * @brief Escribe los resultados en formato JSON.
+ *
+ * @param path Ruta del archivo.
+ * @return true si se escribió correctamente.
+ */
+bool BenchmarkSuite::writeJson(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "BenchmarkSuite : no se puede abrir '" << path << "' para escritura\n";
+        return false;
+    }
+
+    file << "{\n  \"unit\": \"ns/op\",\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < m_results.size(); ++i) {
+        const BenchmarkResult& result = m_results[i];
+        file << "    {\"name\": \"" << result.name << "\", \"size\": " << result.size
+             << ", \"iterations\": " << result.iterations << ", \"samples\": " << result.samples
+             << std::setprecision(6)
+             << ", \"median\": " << result.medianNs << ", \"min\": " << result.minNs
+             << ", \"max\": " << result.maxNs << ", \"allocations_per_op\": " << result.allocationsPerOp << "}"
+             << (i + 1 < m_results.size() ? ",\n" : "\n");
+    }
+    file << "  ]\n}\n";
+    return file.good();
+}
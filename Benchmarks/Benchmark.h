@@ -0,0 +1,163 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales del motor.
+#include <functional>
+#include <chrono>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Impide que el compilador elimine un cálculo cuyo resultado no se usa.
+ *
+ * @param value Resultado a conservar.
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+    const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+    (void)*sink;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/**
+ * @struct BenchmarkResult
+ * @brief Resultado de un microbenchmark.
+ */
+struct BenchmarkResult {
+    std::string name;                ///< Nombre del caso (p. ej. "Actor::update").
+    std::size_t size = 0;            ///< Tamaño del problema (actores, elementos...).
+    std::size_t iterations = 0;      ///< Repeticiones del cuerpo por muestra.
+    std::size_t samples = 0;         ///< Muestras medidas.
+    double medianNs = 0.0;           ///< Mediana de nanosegundos por operación.
+    double minNs = 0.0;              ///< Mínimo de nanosegundos por operación.
+    double maxNs = 0.0;              ///< Máximo de nanosegundos por operación.
+    double allocationsPerOp = 0.0;   ///< Reservas de memoria por operación.
+};
+
+/**
+ * @class BenchmarkSuite
+ * @brief Ejecuta microbenchmarks repetibles y reporta sus resultados.
+ *
+ * Cada caso registra un cuerpo que procesa `size` operaciones. El cuerpo se calienta una
+ * vez, se calibra el número de repeticiones para que cada muestra dure al menos
+ * `minSampleTime` y se toman varias muestras; se reporta la mediana por operación, que
+ * es robusta frente a interrupciones del sistema. Los datos de entrada usan semillas
+ * fijas para que dos corridas midan exactamente el mismo trabajo.
+ *
+ * Los resultados se imprimen como tabla y, opcionalmente, como JSON para compararlos
+ * entre versiones y detectar regresiones.
+ *
+ * Con `--verify` no se mide nada: se ejecutan las comprobaciones registradas con
+ * `addCheck` (resultados exactos que una optimización no debe cambiar) y el código de
+ * salida indica si todas pasaron. Así las corre CTest.
+ */
+class BenchmarkSuite {
+public:
+    /**
+     * @brief Cuerpo de un caso: procesa una vez las `size` operaciones del caso.
+     */
+    using Body = std::function<void()>;
+
+    /**
+     * @brief Fábrica de un caso: prepara los datos y devuelve el cuerpo a medir.
+     */
+    using Setup = std::function<Body(std::size_t size)>;
+
+    /**
+     * @brief Comprobación: devuelve false y describe el fallo en `detail` si no se cumple.
+     */
+    using Check = std::function<bool(std::string& detail)>;
+
+    /**
+     * @brief Registra un caso para uno o varios tamaños.
+     *
+     * @param name Nombre del caso.
+     * @param sizes Tamaños a medir (uno por resultado).
+     * @param setup Prepara los datos para un tamaño y devuelve el cuerpo.
+     */
+    void add(const std::string& name, const std::vector<std::size_t>& sizes, Setup setup);
+
+    /**
+     * @brief Registra una comprobación de `--verify`.
+     *
+     * @param name Nombre de la comprobación.
+     * @param check Función que verifica un resultado exacto.
+     */
+    void addCheck(const std::string& name, Check check);
+
+    /**
+     * @brief Lee las opciones de la línea de comandos.
+     *
+     * Opciones: `--filter TEXTO` (solo casos cuyo nombre lo contiene), `--samples N`,
+     * `--min-time MS` (duración mínima de cada muestra), `--json ARCHIVO`, `--list` y
+     * `--verify` (solo comprobaciones).
+     *
+     * @param argc Número de argumentos.
+     * @param argv Argumentos del programa.
+     * @return false si alguna opción es inválida.
+     */
+    bool parseCommandLine(int argc, char** argv);
+
+    /**
+     * @brief Ejecuta los casos seleccionados.
+     *
+     * @return Código de salida (0 si todo salió bien).
+     */
+    int run();
+
+    /**
+     * @brief Resultados de la última ejecución.
+     *
+     * @return Un resultado por caso y tamaño.
+     */
+    const std::vector<BenchmarkResult>& getResults() const;
+
+private:
+    /**
+     * @struct Case
+     * @brief Caso registrado.
+     */
+    struct Case {
+        std::string name;                ///< Nombre del caso.
+        std::vector<std::size_t> sizes;  ///< Tamaños a medir.
+        Setup setup;                     ///< Preparación de datos.
+    };
+
+    /**
+     * @brief Ejecuta las comprobaciones seleccionadas.
+     *
+     * @return Código de salida (0 si todas pasaron).
+     */
+    int runChecks() const;
+
+    /**
+     * @brief Mide un caso para un tamaño.
+     *
+     * @param benchmark Caso a medir.
+     * @param size Tamaño del problema.
+     * @return Resultado medido.
+     */
+    BenchmarkResult measure(const Case& benchmark, std::size_t size) const;
+
+    /**
+     * @brief Escribe los resultados en formato JSON.
+     *
+     * @param path Ruta del archivo.
+     * @return true si se escribió correctamente.
+     */
+    bool writeJson(const std::string& path) const;
+
+    std::vector<Case> m_cases;             ///< Casos registrados.
+    std::vector<std::pair<std::string, Check>> m_checks;  ///< Comprobaciones registradas.
+    std::vector<BenchmarkResult> m_results;  ///< Resultados de la última ejecución.
+    std::string m_filter;                  ///< Subcadena que deben contener los nombres.
+    std::string m_jsonPath;                ///< Archivo JSON de salida (vacío = ninguno).
+    std::size_t m_samples = 7;             ///< Muestras por caso.
+    double m_minSampleMs = 20.0;           ///< Duración mínima de cada muestra.
+    bool m_listOnly = false;               ///< Solo listar los casos.
+    bool m_verify = false;                 ///< Solo ejecutar las comprobaciones.
+};
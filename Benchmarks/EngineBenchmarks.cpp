@@ -0,0 +1,1973 @@
+#include "EngineBenchmarks.h"
+#include "Actor.h"
+#include "BaseApp.h"
+#include "SoftwareRasterizer.h"
+#include "FixedTimestep.h"
+#include "InputSystem.h"
+#include "SteeringKernels.h"
+#include "PathFollower.h"
+#include "ThreadPool.h"
+#include "SpatialHashGrid.h"
+#include "PhysicsComponent.h"
+#include "TrackMask.h"
+#include "FlowField.h"
+#include "PathfindingService.h"
+#include "FixedPoint.h"
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <random>
+
+namespace {
+    const std::vector<std::size_t> kActorCounts = { 1000, 10000, 100000 };  ///< Escalas de la escena.
+    const float kStep = 1.0f / 60.0f;  ///< Duración de un tick de simulación.
+
+    /// Waypoints del circuito de la aplicación (los mismos de `BaseApp`).
+    const std::vector<sf::Vector2f> kTrackWaypoints = {
+        {720.0f, 350.0f}, {720.0f, 260.0f}, {125.0f, 50.0f},
+        {70.0f, 120.0f}, {70.0f, 450.0f}, {400.0f, 350.0f},
+        {550.0f, 500.0f}, {650.0f, 550.0f}, {720.0f, 450.0f}
+    };
+
+    /**
+     * @brief Crea actores con posiciones pseudoaleatorias repetibles.
+     *
+     * @param count Número de actores.
+     * @param shapeType Forma de cada actor (`EMPTY` para no crear geometría).
+     * @return Actores creados.
+     */
+    std::vector<EngineUtilities::TSharedPointer<Actor>> makeActors(std::size_t count, ShapeType shapeType) {
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> coordinate(0.0f, 2000.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+
+        std::vector<EngineUtilities::TSharedPointer<Actor>> actors;
+        actors.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto actor = EngineUtilities::MakeShared<Actor>("Bench");
+            if (shapeType != EMPTY) {
+                actor->getComponent<ShapeFactory>()->createShape(shapeType);
+            }
+            auto transform = actor->getComponent<Transform>();
+            transform->setPosition(sf::Vector2f(coordinate(random), coordinate(random)));
+            transform->setRotation(angle(random));
+            transform->setScale(sf::Vector2f(1.0f, 1.0f));
+            transform->savePreviousState();
+            actors.push_back(actor);
+        }
+        return actors;
+    }
+
+    /**
+     * @brief Posiciones pseudoaleatorias con densidad constante (una entidad por 32x32 px).
+     *
+     * @param count Número de entidades.
+     * @param x Recibe las coordenadas X.
+     * @param y Recibe las coordenadas Y.
+     * @return Lado del mundo generado.
+     */
+    float makeCrowdPositions(std::size_t count, std::vector<float>& x, std::vector<float>& y) {
+        float side = 32.0f * std::sqrt(static_cast<float>(count));
+        std::mt19937 random(23);
+        std::uniform_real_distribution<float> coordinate(0.0f, side);
+        x.resize(count);
+        y.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            x[i] = coordinate(random);
+            y[i] = coordinate(random);
+        }
+        return side;
+    }
+
+    /**
+     * @brief Agentes de steering con los mismos datos que el benchmark de `Transform::Seek`.
+     *
+     * @param count Número de agentes.
+     * @param starts Recibe los puntos de partida (objetivo alternativo de cada agente).
+     * @return Agentes con posición y objetivo pseudoaleatorios repetibles.
+     */
+    SteeringAgents makeSteeringAgents(std::size_t count, std::vector<sf::Vector2f>& starts) {
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> coordinate(0.0f, 2000.0f);
+        SteeringAgents agents;
+        agents.resize(count);
+        starts.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            agents.positionX[i] = coordinate(random);
+            agents.positionY[i] = coordinate(random);
+            agents.targetX[i] = coordinate(random);
+            agents.targetY[i] = coordinate(random);
+            starts[i] = sf::Vector2f(agents.positionX[i], agents.positionY[i]);
+        }
+        return agents;
+    }
+
+    /**
+     * @brief Copia en Q16.16 de los agentes de `makeSteeringAgents`.
+     *
+     * @param agents Agentes en flotante.
+     * @return Los mismos agentes con valores crudos en punto fijo.
+     */
+    FixedSteeringAgents toFixedAgents(const SteeringAgents& agents) {
+        FixedSteeringAgents fixed;
+        fixed.resize(agents.size());
+        for (std::size_t i = 0; i < agents.size(); ++i) {
+            fixed.positionX[i] = Fixed16::fromFloat(agents.positionX[i]).raw();
+            fixed.positionY[i] = Fixed16::fromFloat(agents.positionY[i]).raw();
+            fixed.targetX[i] = Fixed16::fromFloat(agents.targetX[i]).raw();
+            fixed.targetY[i] = Fixed16::fromFloat(agents.targetY[i]).raw();
+        }
+        return fixed;
+    }
+
+    /**
+     * @brief Cuerpos que se mueven en línea recta y rebotan en los bordes del mundo.
+     */
+    struct MovingBoxes {
+        std::vector<float> x;         ///< Esquina izquierda de cada caja.
+        std::vector<float> y;         ///< Esquina superior de cada caja.
+        std::vector<float> velocityX; ///< Desplazamiento por tick en X.
+        std::vector<float> velocityY; ///< Desplazamiento por tick en Y.
+        float side = 0.0f;            ///< Lado del mundo.
+        float size = 20.0f;           ///< Lado de cada caja.
+
+        /**
+         * @brief Caja de un cuerpo.
+         */
+        AABB bounds(std::size_t i) const {
+            return { sf::Vector2f(x[i], y[i]), sf::Vector2f(x[i] + size, y[i] + size) };
+        }
+
+        /**
+         * @brief Avanza un tick.
+         */
+        void step() {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                x[i] += velocityX[i];
+                y[i] += velocityY[i];
+                if (x[i] < 0.0f || x[i] > side) velocityX[i] = -velocityX[i];
+                if (y[i] < 0.0f || y[i] > side) velocityY[i] = -velocityY[i];
+            }
+        }
+    };
+
+    /**
+     * @brief Cajas de 20x20 con la densidad de `makeCrowdPositions` y velocidades de hasta 2 px por tick.
+     *
+     * @param count Número de cuerpos.
+     * @return Cuerpos repetibles.
+     */
+    MovingBoxes makeMovingBoxes(std::size_t count) {
+        MovingBoxes boxes;
+        boxes.side = makeCrowdPositions(count, boxes.x, boxes.y);
+        std::mt19937 random(37);
+        std::uniform_real_distribution<float> speed(-2.0f, 2.0f);
+        boxes.velocityX.resize(count);
+        boxes.velocityY.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            boxes.velocityX[i] = speed(random);
+            boxes.velocityY[i] = speed(random);
+        }
+        return boxes;
+    }
+
+    /**
+     * @brief Choques de karts: grupos de 8 cuerpos (círculos y cajas) encimados alrededor de puntos de reunión.
+     *
+     * @param world Mundo donde se agregan los cuerpos.
+     * @param count Número de cuerpos.
+     * @param centers Recibe el punto de reunión de cada cuerpo.
+     */
+    void makePileUps(PhysicsWorld& world, std::size_t count, std::vector<sf::Vector2f>& centers) {
+        std::mt19937 random(41);
+        std::uniform_real_distribution<float> jitter(-12.0f, 12.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 90.0f);
+        const std::size_t columns = static_cast<std::size_t>(std::sqrt(static_cast<float>(count / 8 + 1))) + 1;
+        centers.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t group = i / 8;
+            centers[i] = sf::Vector2f(120.0f * (group % columns), 120.0f * (group / columns));
+            Collider collider;
+            collider.center = centers[i] + sf::Vector2f(jitter(random), jitter(random));
+            if (i % 4 == 3) {
+                collider.type = ColliderType::Box;
+                collider.halfExtents = sf::Vector2f(12.0f, 6.0f);
+                collider.rotation = angle(random);
+            }
+            else {
+                collider.type = ColliderType::Circle;
+                collider.radius = 10.0f;
+            }
+            world.addBody(collider, 1.0f + (i % 3), 0.4f);
+        }
+    }
+
+    /**
+     * @brief Empuja cada cuerpo hacia su punto de reunión (los grupos no se dispersan).
+     *
+     * @param world Mundo con los cuerpos.
+     * @param centers Punto de reunión de cada cuerpo.
+     */
+    void pushTowardCenters(PhysicsWorld& world, const std::vector<sf::Vector2f>& centers) {
+        for (std::size_t i = 0; i < centers.size(); ++i) {
+            sf::Uint32 body = static_cast<sf::Uint32>(i);
+            world.applyForce(body, (centers[i] - world.getPosition(body)) * 40.0f * world.getMass(body));
+        }
+    }
+
+    /**
+     * @brief Circuito sintético: un anillo elíptico de asfalto gris sobre césped, con
+     *        línea blanca al centro y pianos rojos en el borde exterior.
+     *
+     * @param width Ancho de la imagen.
+     * @param height Alto de la imagen.
+     * @return Imagen del circuito.
+     */
+    sf::Image makeRingTrack(unsigned int width, unsigned int height) {
+        sf::Image image;
+        image.create(width, height, sf::Color(40, 150, 50));
+        const float centerX = width * 0.5f;
+        const float centerY = height * 0.5f;
+        for (unsigned int y = 0; y < height; ++y) {
+            for (unsigned int x = 0; x < width; ++x) {
+                float dx = (x + 0.5f - centerX) / (width * 0.5f);
+                float dy = (y + 0.5f - centerY) / (height * 0.5f);
+                float radius = std::sqrt(dx * dx + dy * dy);
+                if (radius >= 0.55f && radius < 0.85f) {
+                    bool isLine = std::abs(radius - 0.7f) < 0.01f;
+                    image.setPixel(x, y, isLine ? sf::Color(235, 235, 235) : sf::Color(95, 95, 100));
+                }
+                else if (radius >= 0.85f && radius < 0.9f) {
+                    image.setPixel(x, y, ((x / 8 + y / 8) % 2) ? sf::Color(220, 30, 30) : sf::Color(245, 245, 245));
+                }
+            }
+        }
+        return image;
+    }
+
+    /**
+     * @brief Posiciones de corredores repartidas por la pista de 1100x600 y un poco fuera de ella.
+     *
+     * @param count Número de posiciones.
+     * @return Posiciones en el mundo.
+     */
+    std::vector<sf::Vector2f> makeTrackPositions(std::size_t count) {
+        std::mt19937 random(17);
+        std::uniform_real_distribution<float> x(-50.0f, 1150.0f);
+        std::uniform_real_distribution<float> y(-50.0f, 650.0f);
+        std::vector<sf::Vector2f> positions(count);
+        for (auto& position : positions) {
+            position = sf::Vector2f(x(random), y(random));
+        }
+        return positions;
+    }
+
+    /**
+     * @brief Pares inicio/meta sobre el asfalto del circuito sintético de 1100x600.
+     *
+     * @param count Número de pares.
+     * @return Inicio y meta de cada par.
+     */
+    std::vector<std::pair<sf::Vector2f, sf::Vector2f>> makeRingRoutes(std::size_t count) {
+        std::mt19937 random(29);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        auto onRoad = [](float theta) {
+            return sf::Vector2f(550.0f + 385.0f * std::cos(theta), 300.0f + 210.0f * std::sin(theta));
+        };
+        std::vector<std::pair<sf::Vector2f, sf::Vector2f>> routes(count);
+        for (auto& route : routes) {
+            route = { onRoad(angle(random)), onRoad(angle(random)) };
+        }
+        return routes;
+    }
+
+    /**
+     * @brief Pares de cajas que se superponen comparando todas contra todas (referencia).
+     *
+     * @param bounds Caja de cada cuerpo.
+     * @param pairs Recibe los pares ordenados por `first` y luego `second`.
+     */
+    void bruteForcePairs(const std::vector<AABB>& bounds, std::vector<BroadphasePair>& pairs) {
+        pairs.clear();
+        for (std::size_t i = 0; i < bounds.size(); ++i) {
+            for (std::size_t j = i + 1; j < bounds.size(); ++j) {
+                if (bounds[i].overlaps(bounds[j])) {
+                    pairs.push_back({ static_cast<sf::Uint32>(i), static_cast<sf::Uint32>(j) });
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Validador sintáctico mínimo de JSON (RFC 8259), para revisar archivos exportados.
+     */
+    class JsonValidator {
+    public:
+        explicit JsonValidator(const std::string& text) : m_text(text) {}
+
+        /**
+         * @brief Indica si el texto completo es un único valor JSON válido.
+         *
+         * @return true si la sintaxis es correcta.
+         */
+        bool isValid() {
+            skipSpaces();
+            if (!value()) return false;
+            skipSpaces();
+            return m_position == m_text.size();
+        }
+
+    private:
+        void skipSpaces() {
+            while (m_position < m_text.size() && std::strchr(" \t\r\n", m_text[m_position]) != nullptr) ++m_position;
+        }
+
+        bool consume(char expected) {
+            skipSpaces();
+            if (m_position >= m_text.size() || m_text[m_position] != expected) return false;
+            ++m_position;
+            return true;
+        }
+
+        bool literal(const char* word) {
+            std::size_t length = std::strlen(word);
+            if (m_text.compare(m_position, length, word) != 0) return false;
+            m_position += length;
+            return true;
+        }
+
+        bool string() {
+            if (!consume('"')) return false;
+            while (m_position < m_text.size()) {
+                char c = m_text[m_position++];
+                if (c == '"') return true;
+                if (static_cast<unsigned char>(c) < 0x20) return false;
+                if (c == '\\') {
+                    if (m_position >= m_text.size()) return false;
+                    char escaped = m_text[m_position++];
+                    if (escaped == 'u') {
+                        for (int i = 0; i < 4; ++i) {
+                            if (m_position >= m_text.size() || !std::isxdigit(static_cast<unsigned char>(m_text[m_position++]))) return false;
+                        }
+                    }
+                    else if (std::strchr("\"\\/bfnrt", escaped) == nullptr) {
+                        return false;
+                    }
+                }
+            }
+            return false;
+        }
+
+        bool number() {
+            std::size_t start = m_position;
+            if (m_position < m_text.size() && m_text[m_position] == '-') ++m_position;
+            std::size_t digits = m_position;
+            while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position]))) ++m_position;
+            if (m_position == digits) return false;
+            if (m_position < m_text.size() && m_text[m_position] == '.') {
+                std::size_t fraction = ++m_position;
+                while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position]))) ++m_position;
+                if (m_position == fraction) return false;
+            }
+            if (m_position < m_text.size() && (m_text[m_position] == 'e' || m_text[m_position] == 'E')) {
+                ++m_position;
+                if (m_position < m_text.size() && (m_text[m_position] == '+' || m_text[m_position] == '-')) ++m_position;
+                std::size_t exponent = m_position;
+                while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position]))) ++m_position;
+                if (m_position == exponent) return false;
+            }
+            return m_position > start;
+        }
+
+        bool value() {
+            if (++m_depth > 64) return false;
+            skipSpaces();
+            bool valid = false;
+            if (m_position >= m_text.size()) {
+                valid = false;
+            }
+            else if (m_text[m_position] == '{') {
+                ++m_position;
+                valid = consume('}');
+                while (!valid) {
+                    skipSpaces();
+                    if (!string() || !consume(':') || !value()) break;
+                    if (consume('}')) valid = true;
+                    else if (!consume(',')) break;
+                }
+            }
+            else if (m_text[m_position] == '[') {
+                ++m_position;
+                valid = consume(']');
+                while (!valid) {
+                    if (!value()) break;
+                    if (consume(']')) valid = true;
+                    else if (!consume(',')) break;
+                }
+            }
+            else if (m_text[m_position] == '"') {
+                valid = string();
+            }
+            else {
+                valid = literal("true") || literal("false") || literal("null") || number();
+            }
+            --m_depth;
+            return valid;
+        }
+
+        const std::string& m_text;   ///< Texto a validar.
+        std::size_t m_position = 0;  ///< Siguiente carácter por leer.
+        int m_depth = 0;             ///< Anidamiento actual (limitado para no agotar la pila).
+    };
+
+    /**
+     * @brief Cuenta las apariciones de un fragmento en un texto.
+     *
+     * @param text Texto donde buscar.
+     * @param fragment Fragmento a contar.
+     * @return Número de apariciones sin solaparse.
+     */
+    std::size_t countOccurrences(const std::string& text, const std::string& fragment) {
+        std::size_t count = 0;
+        for (std::size_t at = text.find(fragment); at != std::string::npos; at = text.find(fragment, at + fragment.size())) {
+            ++count;
+        }
+        return count;
+    }
+}
+
+/**
+ * @brief Registra los microbenchmarks de las rutas críticas del motor.
+ *
+ * @param suite Suite donde se registran los casos.
+ */
+void registerEngineBenchmarks(BenchmarkSuite& suite) {
+    // Búsqueda de componentes: un dynamic_cast por componente hasta encontrar el tipo.
+    suite.add("Entity::getComponent<Transform>", kActorCounts, [](std::size_t size) {
+        auto actors = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Actor>>>(makeActors(size, EMPTY));
+        return [actors]() {
+            for (auto& actor : *actors) {
+                Entity& entity = *actor;
+                auto transform = entity.getComponent<Transform>();
+                doNotOptimize(transform);
+            }
+        };
+    });
+
+    // Punteros compartidos: conteo de referencias al copiar, mover y convertir.
+    suite.add("TSharedPointer copy", { 1000 }, [](std::size_t size) {
+        auto actors = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Actor>>>(makeActors(size, EMPTY));
+        auto copies = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Actor>>>(size);
+        return [actors, copies]() {
+            for (std::size_t i = 0; i < actors->size(); ++i) {
+                (*copies)[i] = (*actors)[i];
+            }
+            doNotOptimize(copies->back());
+        };
+    });
+
+    suite.add("TSharedPointer move", { 1000 }, [](std::size_t size) {
+        auto actors = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Actor>>>(makeActors(size, EMPTY));
+        auto moved = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Actor>>>(size);
+        return [actors, moved]() {
+            // Ida y vuelta para que cada repetición empiece con los mismos datos.
+            for (std::size_t i = 0; i < actors->size(); ++i) {
+                (*moved)[i] = std::move((*actors)[i]);
+            }
+            for (std::size_t i = 0; i < actors->size(); ++i) {
+                (*actors)[i] = std::move((*moved)[i]);
+            }
+            doNotOptimize(actors->back());
+        };
+    });
+
+    suite.add("TSharedPointer dynamic_pointer_cast", { 1000 }, [](std::size_t size) {
+        auto components = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Component>>>();
+        for (auto& actor : makeActors(size, EMPTY)) {
+            components->push_back(actor->getComponent<Transform>().dynamic_pointer_cast<Component>());
+        }
+        return [components]() {
+            for (auto& component : *components) {
+                auto transform = component.dynamic_pointer_cast<Transform>();
+                doNotOptimize(transform);
+            }
+        };
+    });
+
+    // Simulación: un tick de cada actor.
+    suite.add("Actor::update", kActorCounts, [](std::size_t size) {
+        auto actors = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Actor>>>(makeActors(size, CIRCLE));
+        return [actors]() {
+            for (auto& actor : *actors) {
+                actor->update(kStep);
+            }
+        };
+    });
+
+    suite.add("Transform::Seek", kActorCounts, [](std::size_t size) {
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> coordinate(0.0f, 2000.0f);
+        auto transforms = std::make_shared<std::vector<Transform>>(size);
+        auto targets = std::make_shared<std::vector<sf::Vector2f>>(size * 2);
+        for (std::size_t i = 0; i < size; ++i) {
+            sf::Vector2f start(coordinate(random), coordinate(random));
+            (*transforms)[i].setPosition(start);
+            (*targets)[i * 2] = sf::Vector2f(coordinate(random), coordinate(random));
+            (*targets)[i * 2 + 1] = start;
+        }
+        // Alternar entre el objetivo y el punto de partida: cada agente oscila sin llegar
+        // nunca, así todas las repeticiones hacen el mismo trabajo.
+        auto flip = std::make_shared<std::size_t>(0);
+        return [transforms, targets, flip]() {
+            for (std::size_t i = 0; i < transforms->size(); ++i) {
+                (*transforms)[i].Seek((*targets)[i * 2 + *flip], 200.0f, kStep, 1.0f);
+            }
+            *flip ^= 1;
+            doNotOptimize(transforms->back());
+        };
+    });
+
+    // El mismo movimiento por lotes (SoA) con cada ruta del kernel que soporte la CPU.
+    struct SteeringVariant {
+        const char* name;
+        SimdLevel level;
+        bool fastRsqrt;
+    };
+    const SteeringVariant steeringVariants[] = {
+        { "Steering::update Seek Scalar", SimdLevel::Scalar, false },
+        { "Steering::update Seek SSE", SimdLevel::SSE, false },
+        { "Steering::update Seek SSE rsqrt", SimdLevel::SSE, true },
+        { "Steering::update Seek AVX2", SimdLevel::AVX2, false },
+        { "Steering::update Seek AVX2 rsqrt", SimdLevel::AVX2, true },
+    };
+    for (const SteeringVariant& variant : steeringVariants) {
+        if (variant.level > Steering::bestSimdLevel()) continue;
+        suite.add(variant.name, kActorCounts, [variant](std::size_t size) {
+            auto starts = std::make_shared<std::vector<sf::Vector2f>>();
+            auto agents = std::make_shared<SteeringAgents>(makeSteeringAgents(size, *starts));
+            // Los objetivos alternos (los puntos de partida) en SoA, para intercambiarlos sin copiar.
+            auto otherX = std::make_shared<std::vector<float>>(size);
+            auto otherY = std::make_shared<std::vector<float>>(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                (*otherX)[i] = (*starts)[i].x;
+                (*otherY)[i] = (*starts)[i].y;
+            }
+            SteeringParams params;
+            params.maxSpeed = 200.0f;
+            params.range = 1.0f;
+            params.fastRsqrt = variant.fastRsqrt;
+            return [agents, otherX, otherY, params, variant]() {
+                Steering::update(*agents, params, kStep, variant.level);
+                agents->targetX.swap(*otherX);
+                agents->targetY.swap(*otherY);
+                doNotOptimize(agents->positionX.back());
+            };
+        });
+    }
+
+    // El mismo Seek en punto fijo Q16.16 (modo determinista) frente a la ruta en flotante.
+    for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::AVX2 }) {
+        if (level > Steering::bestSimdLevel()) continue;
+        std::string name = std::string("FixedSteering::update Seek ") + Steering::simdLevelName(level);
+        suite.add(name, kActorCounts, [level](std::size_t size) {
+            std::vector<sf::Vector2f> starts;
+            auto agents = std::make_shared<FixedSteeringAgents>(toFixedAgents(makeSteeringAgents(size, starts)));
+            auto otherX = std::make_shared<std::vector<sf::Int32>>(size);
+            auto otherY = std::make_shared<std::vector<sf::Int32>>(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                (*otherX)[i] = Fixed16::fromFloat(starts[i].x).raw();
+                (*otherY)[i] = Fixed16::fromFloat(starts[i].y).raw();
+            }
+            const Fixed16 speed = Fixed16::fromInt(200);
+            const Fixed16 range = Fixed16::fromInt(1);
+            const Fixed16 step = Fixed16::fromFloat(kStep);
+            return [agents, otherX, otherY, speed, range, step, level]() {
+                FixedSteering::update(*agents, speed, range, step, level);
+                agents->targetX.swap(*otherX);
+                agents->targetY.swap(*otherY);
+                doNotOptimize(agents->positionX.back());
+            };
+        });
+    }
+
+    // Rejilla hash: reconstrucción por conteo de 10k a 1M entidades y consultas de radio
+    // (1000 por repetición) contra la búsqueda exhaustiva.
+    const std::vector<std::size_t> gridCounts = { 10000, 100000, 1000000 };
+    suite.add("SpatialHashGrid::build", gridCounts, [](std::size_t size) {
+        auto x = std::make_shared<std::vector<float>>();
+        auto y = std::make_shared<std::vector<float>>();
+        makeCrowdPositions(size, *x, *y);
+        auto grid = std::make_shared<SpatialHashGrid>(64.0f);
+        return [x, y, grid]() {
+            grid->build(x->data(), y->data(), x->size());
+            doNotOptimize(grid->size());
+        };
+    });
+
+    for (std::size_t entities : gridCounts) {
+        std::string count = entities >= 1000000 ? std::to_string(entities / 1000000) + "M" : std::to_string(entities / 1000) + "k";
+        std::string name = "SpatialHashGrid::queryRadius r=64 (" + count + " entidades)";
+        suite.add(name, { 1000 }, [entities](std::size_t size) {
+            auto x = std::make_shared<std::vector<float>>();
+            auto y = std::make_shared<std::vector<float>>();
+            float side = makeCrowdPositions(entities, *x, *y);
+            auto grid = std::make_shared<SpatialHashGrid>(64.0f);
+            grid->build(x->data(), y->data(), x->size());
+            auto centers = std::make_shared<std::vector<sf::Vector2f>>(size);
+            std::mt19937 random(29);
+            std::uniform_real_distribution<float> coordinate(0.0f, side);
+            for (auto& center : *centers) center = sf::Vector2f(coordinate(random), coordinate(random));
+            auto result = std::make_shared<std::vector<sf::Uint32>>();
+            return [grid, centers, result]() {
+                for (const sf::Vector2f& center : *centers) {
+                    grid->queryRadius(center, 64.0f, *result);
+                    doNotOptimize(result->size());
+                }
+            };
+        });
+    }
+
+    suite.add("queryRadius exhaustiva r=64 (10k entidades)", { 1000 }, [](std::size_t size) {
+        auto x = std::make_shared<std::vector<float>>();
+        auto y = std::make_shared<std::vector<float>>();
+        float side = makeCrowdPositions(10000, *x, *y);
+        auto centers = std::make_shared<std::vector<sf::Vector2f>>(size);
+        std::mt19937 random(29);
+        std::uniform_real_distribution<float> coordinate(0.0f, side);
+        for (auto& center : *centers) center = sf::Vector2f(coordinate(random), coordinate(random));
+        auto result = std::make_shared<std::vector<sf::Uint32>>();
+        return [x, y, centers, result]() {
+            for (const sf::Vector2f& center : *centers) {
+                result->clear();
+                for (std::size_t i = 0; i < x->size(); ++i) {
+                    float dx = (*x)[i] - center.x;
+                    float dy = (*y)[i] - center.y;
+                    if (dx * dx + dy * dy <= 64.0f * 64.0f) result->push_back(static_cast<sf::Uint32>(i));
+                }
+                doNotOptimize(result->size());
+            }
+        };
+    });
+
+    // Fase amplia: un tick de cuerpos en movimiento (mover proxies y obtener pares) con el
+    // árbol dinámico contra la comparación de todos contra todos.
+    suite.add("Broadphase::update (AABBTree)", kActorCounts, [](std::size_t size) {
+        auto boxes = std::make_shared<MovingBoxes>(makeMovingBoxes(size));
+        auto broadphase = std::make_shared<Broadphase>();
+        for (std::size_t i = 0; i < size; ++i) broadphase->addBody(boxes->bounds(i));
+        return [boxes, broadphase]() {
+            boxes->step();
+            for (std::size_t i = 0; i < boxes->x.size(); ++i) {
+                broadphase->setBounds(static_cast<sf::Uint32>(i), boxes->bounds(i));
+            }
+            broadphase->update();
+            doNotOptimize(broadphase->getPairs().size());
+        };
+    });
+
+    suite.add("Pares por fuerza bruta", { 1000, 10000 }, [](std::size_t size) {
+        auto boxes = std::make_shared<MovingBoxes>(makeMovingBoxes(size));
+        auto bounds = std::make_shared<std::vector<AABB>>(size);
+        auto pairs = std::make_shared<std::vector<BroadphasePair>>();
+        return [boxes, bounds, pairs]() {
+            boxes->step();
+            for (std::size_t i = 0; i < boxes->x.size(); ++i) (*bounds)[i] = boxes->bounds(i);
+            bruteForcePairs(*bounds, *pairs);
+            doNotOptimize(pairs->size());
+        };
+    });
+
+    // Asfalto o fuera de pista para cada corredor: leer un bit de la máscara horneada
+    // contra leer el píxel de la imagen y clasificar su color en cada consulta.
+    suite.add("TrackMask::isDrivable", kActorCounts, [](std::size_t size) {
+        auto mask = std::make_shared<TrackMask>();
+        mask->bake(makeRingTrack(1100, 600), sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), false);
+        auto positions = std::make_shared<std::vector<sf::Vector2f>>(makeTrackPositions(size));
+        return [mask, positions]() {
+            std::size_t onRoad = 0;
+            for (const sf::Vector2f& position : *positions) {
+                onRoad += mask->isDrivable(position);
+            }
+            doNotOptimize(onRoad);
+        };
+    });
+
+    suite.add("sf::Image::getPixel + clasificar", kActorCounts, [](std::size_t size) {
+        auto image = std::make_shared<sf::Image>(makeRingTrack(1100, 600));
+        auto positions = std::make_shared<std::vector<sf::Vector2f>>(makeTrackPositions(size));
+        return [image, positions]() {
+            std::size_t onRoad = 0;
+            for (const sf::Vector2f& position : *positions) {
+                if (position.x >= 0.0f && position.y >= 0.0f && position.x < 1100.0f && position.y < 600.0f) {
+                    onRoad += TrackMask::isRoadColor(image->getPixel(static_cast<unsigned int>(position.x),
+                                                                     static_cast<unsigned int>(position.y)));
+                }
+            }
+            doNotOptimize(onRoad);
+        };
+    });
+
+    // Campos de flujo hacia los 9 checkpoints de la pista. `size` es el número de celdas
+    // de la rejilla; cada iteración pone y quita un obstáculo y recalcula los 9 campos.
+    for (unsigned int threads : { 1u, 0u }) {
+        std::string name = threads == 1 ? "FlowField::prepare 9 checkpoints (1 hilo)" : "FlowField::prepare 9 checkpoints (ThreadPool)";
+        suite.add(name, { 1000, 10000, 100000 }, [threads](std::size_t size) {
+            auto mask = std::make_shared<TrackMask>();
+            mask->bake(makeRingTrack(1100, 600), sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), false);
+            float cellSize = std::sqrt(1100.0f * 600.0f / size);
+            auto field = std::make_shared<FlowField>(sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), cellSize, mask.get());
+            field->setCheckpoints(kTrackWaypoints);
+            auto pool = std::make_shared<ThreadPool>(threads);
+            return [field, pool, threads]() {
+                field->addObstacle(sf::FloatRect(0.0f, 0.0f, 1.0f, 1.0f));
+                field->clearObstacles();
+                field->prepare(threads == 1 ? nullptr : pool.get());
+                doNotOptimize(field->getBuildCount());
+            };
+        });
+    }
+
+    // Un pelotón guiado por el campo: una lectura de la rejilla por agente y tick.
+    suite.add("FlowField::getDirections + avance", kActorCounts, [](std::size_t size) {
+        auto mask = std::make_shared<TrackMask>();
+        mask->bake(makeRingTrack(1100, 600), sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), false);
+        auto field = std::make_shared<FlowField>(sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), 8.0f, mask.get());
+        field->setCheckpoints(kTrackWaypoints);
+        field->prepare();
+        auto x = std::make_shared<std::vector<float>>();
+        auto y = std::make_shared<std::vector<float>>();
+        for (const sf::Vector2f& position : makeTrackPositions(size)) {
+            x->push_back(position.x);
+            y->push_back(position.y);
+        }
+        auto directionX = std::make_shared<std::vector<float>>(size);
+        auto directionY = std::make_shared<std::vector<float>>(size);
+        return [field, x, y, directionX, directionY]() {
+            field->getDirections(2, x->data(), y->data(), x->size(), directionX->data(), directionY->data());
+            for (std::size_t i = 0; i < x->size(); ++i) {
+                (*x)[i] += (*directionX)[i] * 120.0f * kStep;
+                (*y)[i] += (*directionY)[i] * 120.0f * kStep;
+            }
+            doNotOptimize(x->data());
+        };
+    });
+
+    // Rutas exactas con A*: `size` rutas por iteración, resueltas por un hilo de trabajo,
+    // con el caché vacío (todas buscan) y con el caché caliente (ninguna busca).
+    for (bool cached : { false, true }) {
+        std::string name = cached ? "PathfindingService::request (caché)" : "PathfindingService::request (A*)";
+        suite.add(name, { 16, 256 }, [cached](std::size_t size) {
+            auto mask = std::make_shared<TrackMask>();
+            mask->bake(makeRingTrack(1100, 600), sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), false);
+            auto service = std::make_shared<PathfindingService>(sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), 10.0f,
+                                                                mask.get(), 1, 512);
+            auto routes = std::make_shared<std::vector<std::pair<sf::Vector2f, sf::Vector2f>>>(makeRingRoutes(size));
+            auto handles = std::make_shared<std::vector<PathfindingService::Handle>>(size);
+            auto path = std::make_shared<std::vector<sf::Vector2f>>();
+            return [cached, service, routes, handles, path]() {
+                if (!cached) {
+                    service->clearCache();
+                }
+                for (std::size_t i = 0; i < routes->size(); ++i) {
+                    (*handles)[i] = service->request((*routes)[i].first, (*routes)[i].second);
+                }
+                service->waitIdle();
+                for (PathfindingService::Handle handle : *handles) {
+                    service->takePath(handle, *path);
+                }
+                doNotOptimize(path->size());
+            };
+        });
+    }
+
+    // Seguimiento de la ruta con la misma rutina que mueve al círculo de la aplicación:
+    // un PathFollower por actor (avance por longitud de arco) y su colocación en el Transform.
+    suite.add("PathFollower + BaseApp::updateMovement", kActorCounts, [](std::size_t size) {
+        auto app = std::make_shared<BaseApp>();
+        auto path = EngineUtilities::MakeShared<WaypointPath>(kTrackWaypoints);
+        auto actors = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Actor>>>(makeActors(size, EMPTY));
+        auto followers = std::make_shared<std::vector<EngineUtilities::TSharedPointer<PathFollower>>>();
+        for (std::size_t i = 0; i < size; ++i) {
+            auto follower = EngineUtilities::MakeShared<PathFollower>(path, 150.0f, path->getLength() * i / size);
+            (*actors)[i]->addComponent(follower);
+            followers->push_back(follower);
+        }
+        return [app, actors, followers]() {
+            for (std::size_t i = 0; i < actors->size(); ++i) {
+                (*followers)[i]->update(kStep);
+                app->updateMovement(kStep, (*actors)[i]);
+            }
+        };
+    });
+
+    // Muestreo a una distancia arbitraria: búsqueda binaria en la polilínea frente a la
+    // tabla de longitud de arco de la línea de carrera (O(1)).
+    suite.add("WaypointPath::progressAt", kActorCounts, [](std::size_t size) {
+        auto path = std::make_shared<WaypointPath>(kTrackWaypoints);
+        auto distances = std::make_shared<std::vector<float>>(size);
+        std::mt19937 random(11);
+        std::uniform_real_distribution<float> along(0.0f, path->getLength());
+        for (float& distance : *distances) distance = along(random);
+        return [path, distances]() {
+            for (float distance : *distances) {
+                doNotOptimize(path->getPosition(path->progressAt(distance)));
+            }
+        };
+    });
+
+    suite.add("RacingLine::sample", kActorCounts, [](std::size_t size) {
+        auto line = std::make_shared<RacingLine>(kTrackWaypoints);
+        auto distances = std::make_shared<std::vector<float>>(size);
+        std::mt19937 random(11);
+        std::uniform_real_distribution<float> along(0.0f, line->getLength());
+        for (float& distance : *distances) distance = along(random);
+        return [line, distances]() {
+            for (float distance : *distances) {
+                doNotOptimize(line->sample(distance));
+            }
+        };
+    });
+
+    suite.add("PathCrowd::update (RacingLine)", kActorCounts, [](std::size_t size) {
+        auto line = EngineUtilities::MakeShared<RacingLine>(kTrackWaypoints);
+        auto crowd = std::make_shared<PathCrowd>(line);
+        for (std::size_t i = 0; i < size; ++i) {
+            crowd->addAgent(line->getLength() * i / size, 120.0f + (i % 50));
+        }
+        return [crowd]() {
+            crowd->update(kStep);
+            doNotOptimize(crowd->getPositionsX().back());
+        };
+    });
+
+    // Los mismos corredores en un PathCrowd: 8 bytes de avance por agente, en un hilo y
+    // repartidos en el ThreadPool.
+    for (unsigned int threads : { 1u, 0u }) {
+        std::string name = threads == 1 ? "PathCrowd::update (1 hilo)" : "PathCrowd::update (ThreadPool)";
+        suite.add(name, kActorCounts, [threads](std::size_t size) {
+            auto path = EngineUtilities::MakeShared<WaypointPath>(kTrackWaypoints);
+            auto crowd = std::make_shared<PathCrowd>(path);
+            for (std::size_t i = 0; i < size; ++i) {
+                crowd->addAgent(path->getLength() * i / size, 120.0f + (i % 50));
+            }
+            auto pool = std::make_shared<ThreadPool>(threads);
+            return [crowd, pool, threads]() {
+                crowd->update(kStep, threads == 1 ? nullptr : pool.get());
+                doNotOptimize(crowd->getPositionsX().back());
+            };
+        });
+    }
+
+    // Física: grupos de 8 cuerpos empujados unos contra otros (un choque de karts por
+    // isla), resueltos en un hilo y con las islas repartidas en el ThreadPool.
+    for (unsigned int threads : { 1u, 0u }) {
+        std::string name = threads == 1 ? "PhysicsWorld::step choques (1 hilo)" : "PhysicsWorld::step choques (ThreadPool)";
+        suite.add(name, { 1000, 10000 }, [threads](std::size_t size) {
+            auto world = std::make_shared<PhysicsWorld>();
+            auto centers = std::make_shared<std::vector<sf::Vector2f>>();
+            makePileUps(*world, size, *centers);
+            auto pool = std::make_shared<ThreadPool>(threads);
+            return [world, centers, pool, threads]() {
+                pushTowardCenters(*world, *centers);
+                world->step(kStep, threads == 1 ? nullptr : pool.get());
+                doNotOptimize(world->getContacts().size());
+            };
+        });
+    }
+
+    // Entrada por lotes: acumular los eventos de un frame y entregar el snapshot del tick.
+    suite.add("InputSystem::processEvents", { 16, 256 }, [](std::size_t size) {
+        auto input = std::make_shared<InputSystem>();
+        auto events = std::make_shared<std::vector<sf::Event>>(size);
+        std::mt19937 random(11);
+        std::uniform_int_distribution<int> key(0, sf::Keyboard::KeyCount - 1);
+        std::uniform_int_distribution<int> coordinate(0, 799);
+        for (std::size_t i = 0; i < size; ++i) {
+            sf::Event& event = (*events)[i];
+            switch (i % 3) {
+            case 0:
+                event.type = sf::Event::MouseMoved;
+                event.mouseMove.x = coordinate(random);
+                event.mouseMove.y = coordinate(random);
+                break;
+            case 1:
+                event.type = sf::Event::KeyPressed;
+                event.key.code = static_cast<sf::Keyboard::Key>(key(random));
+                break;
+            default:
+                event.type = sf::Event::KeyReleased;
+                event.key.code = static_cast<sf::Keyboard::Key>(key(random));
+                break;
+            }
+        }
+        return [input, events]() {
+            input->processEvents(*events);
+            doNotOptimize(input->consumeTick());
+        };
+    });
+
+    suite.add("InputSystem::readLatest", { 1 }, [](std::size_t) {
+        auto input = std::make_shared<InputSystem>();
+        return [input]() {
+            doNotOptimize(input->readLatest());
+        };
+    });
+
+    // Agrupación: interpolar cada actor y juntar su geometría transformada en un solo
+    // arreglo de triángulos, como lo haría un renderizador por lotes.
+    suite.add("Shape batching", kActorCounts, [](std::size_t size) {
+        auto actors = std::make_shared<std::vector<EngineUtilities::TSharedPointer<Actor>>>(makeActors(size, CIRCLE));
+        auto batch = std::make_shared<std::vector<sf::Vertex>>();
+        auto scratch = std::make_shared<std::vector<sf::Vertex>>();
+        return [actors, batch, scratch]() {
+            batch->clear();
+            for (auto& actor : *actors) {
+                actor->interpolate(0.5f);
+                auto shape = actor->getComponent<ShapeFactory>();
+                const sf::Transform& transform = shape->getTransform();
+                shape->getTemplate()->buildVertices(shape->getFillColor(), sf::IntRect(), *scratch);
+
+                // Abanico (centro, contorno, cierre) a triángulos sueltos.
+                for (std::size_t i = 1; i + 1 < scratch->size(); ++i) {
+                    sf::Vertex corners[3] = { (*scratch)[0], (*scratch)[i], (*scratch)[i + 1] };
+                    for (sf::Vertex& vertex : corners) {
+                        vertex.position = transform.transformPoint(vertex.position);
+                        batch->push_back(vertex);
+                    }
+                }
+            }
+            doNotOptimize(batch->back());
+        };
+    });
+
+    // Comprobaciones de --verify.
+    suite.addCheck("SoftwareRasterizer: 1 hilo == 4 hilos", [](std::string& detail) {
+        std::mt19937 random(3);
+        std::uniform_real_distribution<float> coordinate(-20.0f, 276.0f);
+        std::uniform_int_distribution<int> channel(0, 255);
+        std::vector<sf::Vertex> vertices(3 * 500);
+        for (sf::Vertex& vertex : vertices) {
+            vertex.position = sf::Vector2f(coordinate(random), coordinate(random));
+            vertex.color = sf::Color(channel(random), channel(random), channel(random), channel(random));
+        }
+
+        const sf::View view(sf::FloatRect(0.0f, 0.0f, 256.0f, 256.0f));
+        SoftwareRasterizer single(256, 256, 1, 32);
+        SoftwareRasterizer threaded(256, 256, 4, 32);
+        for (SoftwareRasterizer* rasterizer : { &single, &threaded }) {
+            rasterizer->setView(view);
+            rasterizer->clear(sf::Color(20, 30, 40));
+            rasterizer->draw(vertices.data(), vertices.size(), sf::Triangles);
+            rasterizer->flush();
+        }
+        if (std::memcmp(single.getPixels(), threaded.getPixels(), 256 * 256 * 4) != 0) {
+            detail = "los búferes difieren";
+            return false;
+        }
+        return true;
+    });
+
+    suite.addCheck("SoftwareRasterizer: píxeles esperados (cobertura, regla top-left y textura)", [](std::string& detail) {
+        const sf::Color background(20, 30, 40);
+        SoftwareRasterizer rasterizer(16, 8, 1, 4);
+        rasterizer.setView(sf::View(sf::FloatRect(0.0f, 0.0f, 16.0f, 8.0f)));
+        rasterizer.clear(background);
+
+        // Cuadrado semitransparente con los bordes izquierdo y superior sobre centros de
+        // píxel (entran) y los derechos e inferiores también (no entran). La diagonal
+        // compartida por sus dos triángulos pasa por centros: mezclar dos veces se notaría.
+        const sf::Color translucent(200, 100, 50, 128);
+        const sf::Vertex square[4] = {
+            sf::Vertex(sf::Vector2f(1.5f, 1.5f), translucent), sf::Vertex(sf::Vector2f(5.5f, 1.5f), translucent),
+            sf::Vertex(sf::Vector2f(5.5f, 5.5f), translucent), sf::Vertex(sf::Vector2f(1.5f, 5.5f), translucent),
+        };
+        rasterizer.draw(square, 4, sf::Quads);
+
+        // Quad texturizado de 4x4 alineado a píxeles: cada píxel debe tomar exactamente su
+        // texel. El rasterizador solo usa el puntero de la textura como clave, así que no se
+        // crea una `sf::Texture` (necesitaría un contexto de OpenGL).
+        sf::Image texels;
+        texels.create(4, 4, sf::Color::Black);
+        for (unsigned int y = 0; y < 4; ++y) {
+            for (unsigned int x = 0; x < 4; ++x) {
+                texels.setPixel(x, y, sf::Color(static_cast<sf::Uint8>(60 * x + 10), static_cast<sf::Uint8>(60 * y + 20), 90));
+            }
+        }
+        const sf::Texture* textureKey = reinterpret_cast<const sf::Texture*>(&texels);
+        rasterizer.registerTexture(textureKey, texels);
+        const sf::Vertex textured[4] = {
+            sf::Vertex(sf::Vector2f(10.0f, 2.0f), sf::Vector2f(0.0f, 0.0f)), sf::Vertex(sf::Vector2f(14.0f, 2.0f), sf::Vector2f(4.0f, 0.0f)),
+            sf::Vertex(sf::Vector2f(14.0f, 6.0f), sf::Vector2f(4.0f, 4.0f)), sf::Vertex(sf::Vector2f(10.0f, 6.0f), sf::Vector2f(0.0f, 4.0f)),
+        };
+        sf::RenderStates states(textureKey);
+        states.blendMode = sf::BlendNone;
+        rasterizer.draw(textured, 4, sf::Quads, states);
+        rasterizer.flush();
+
+        // Imagen de referencia: alfa 128/255 sobre el fondo, redondeado como la mezcla de SFML.
+        sf::Image golden;
+        golden.create(16, 8, background);
+        for (unsigned int y = 1; y <= 4; ++y) {
+            for (unsigned int x = 1; x <= 4; ++x) {
+                golden.setPixel(x, y, sf::Color(110, 65, 45, 255));
+            }
+        }
+        for (unsigned int y = 0; y < 4; ++y) {
+            for (unsigned int x = 0; x < 4; ++x) {
+                golden.setPixel(10 + x, 2 + y, texels.getPixel(x, y));
+            }
+        }
+
+        std::size_t different = rasterizer.compare(golden);
+        if (different != 0) {
+            detail = std::to_string(different) + " píxeles difieren de la imagen de referencia";
+            return false;
+        }
+        return true;
+    });
+
+#if PROFILER_ENABLED
+    suite.addCheck("TraceExporter: JSON de Chrome Trace con frames, zonas y nombres de hilo", [](std::string& detail) {
+        const std::string path = "trace_check.json";
+        const sf::Uint32 frames = 4;
+        {
+            TraceExporter exporter;
+            if (!exporter.start(path, frames)) {
+                detail = "no se pudo crear " + path;
+                return false;
+            }
+            // Más frames de los pedidos: la captura debe quedarse en `frames`.
+            for (sf::Uint32 i = 0; i < frames + 2; ++i) {
+                {
+                    PROFILE_SCOPE("VerifyTraceZone");
+                }
+                PROFILE_FRAME();
+            }
+            exporter.stop();
+        }
+
+        std::ifstream file(path, std::ios::binary);
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        file.close();
+        std::remove(path.c_str());
+
+        if (!JsonValidator(text).isValid()) {
+            detail = "el archivo no es JSON válido";
+            return false;
+        }
+        const std::string root = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        if (text.compare(0, root.size(), root) != 0) {
+            detail = "falta el objeto raíz con traceEvents";
+            return false;
+        }
+        std::size_t frameEvents = countOccurrences(text, "\"cat\":\"frame\",\"ph\":\"X\"");
+        std::size_t zoneEvents = countOccurrences(text, "\"name\":\"VerifyTraceZone\",\"cat\":\"zone\",\"ph\":\"X\"");
+        if (frameEvents != frames || zoneEvents != frames) {
+            detail = std::to_string(frameEvents) + " frames y " + std::to_string(zoneEvents) +
+                     " zonas (se esperaban " + std::to_string(frames) + " de cada uno)";
+            return false;
+        }
+        if (text.find("\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}") == std::string::npos ||
+            text.find("\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,") == std::string::npos) {
+            detail = "faltan los metadatos thread_name";
+            return false;
+        }
+        return true;
+    });
+#endif
+
+    suite.addCheck("FixedTimestep: ticks, alfa y límite de pasos", [](std::string& detail) {
+        FixedTimestep timestep(60.0f, 5);
+        int ticks = timestep.advance(2.5f / 60.0f);
+        if (ticks != 2 || std::abs(timestep.getAlpha() - 0.5f) > 1e-3f) {
+            detail = "2.5 ticks dieron " + std::to_string(ticks) + " ticks, alfa " + std::to_string(timestep.getAlpha());
+            return false;
+        }
+        ticks = timestep.advance(10.0f);
+        if (ticks != 5 || timestep.getAlpha() < 0.0f || timestep.getAlpha() >= 1.0f) {
+            detail = "una pausa de 10 s dio " + std::to_string(ticks) + " ticks";
+            return false;
+        }
+        return true;
+    });
+
+    suite.addCheck("Transform::Seek: se detiene dentro del rango", [](std::string& detail) {
+        Transform transform;
+        transform.setPosition(sf::Vector2f(0.0f, 0.0f));
+        const sf::Vector2f target(100.0f, 0.0f);
+        for (int i = 0; i < 100; ++i) {
+            transform.Seek(target, 100.0f, 0.1f, 5.0f);
+        }
+        float distance = std::abs(target.x - transform.getPosition().x);
+        if (distance >= 5.0f || transform.getPosition().y != 0.0f) {
+            detail = "distancia final " + std::to_string(distance);
+            return false;
+        }
+        return true;
+    });
+    suite.addCheck("ShapeTemplate: formas iguales comparten una sola plantilla", [](std::string& detail) {
+        // Parámetros que no se habían usado antes, para que la primera creación sí cuente.
+        const sf::Vector2f size(37.25f, 37.25f);
+        const std::size_t before = ShapeTemplate::getCachedCount();
+        std::vector<EngineUtilities::TSharedPointer<Actor>> actors;
+        for (int i = 0; i < 100; ++i) {
+            auto actor = EngineUtilities::MakeShared<Actor>("Template");
+            actor->getComponent<ShapeFactory>()->createShape(CIRCLE, size, 17);
+            actors.push_back(actor);
+        }
+        if (ShapeTemplate::getCachedCount() != before + 1) {
+            detail = "100 círculos iguales crearon " + std::to_string(ShapeTemplate::getCachedCount() - before) + " plantillas";
+            return false;
+        }
+        const ShapeTemplate* shared = actors.front()->getComponent<ShapeFactory>()->getTemplate().get();
+        for (auto& actor : actors) {
+            if (actor->getComponent<ShapeFactory>()->getTemplate().get() != shared) {
+                detail = "un actor no comparte la plantilla";
+                return false;
+            }
+        }
+
+        // Otro número de puntos es otra geometría; repetirla no vuelve a crearla.
+        auto other = EngineUtilities::MakeShared<Actor>("Template");
+        other->getComponent<ShapeFactory>()->createShape(CIRCLE, size, 18);
+        other->getComponent<ShapeFactory>()->createShape(CIRCLE, size, 18);
+        if (ShapeTemplate::getCachedCount() != before + 2 ||
+            other->getComponent<ShapeFactory>()->getTemplate().get() == shared) {
+            detail = "otro número de puntos no crea exactamente una plantilla nueva";
+            return false;
+        }
+        return true;
+    });
+    suite.addCheck("ParticleSystem: emisión acumulada, límite de capacidad y compactación", [](std::string& detail) {
+        // Pasos y tasas potencia de dos: todas las sumas en flotante son exactas.
+        const float step = 1.0f / 16.0f;
+        ParticleSystem::Settings settings;
+        settings.lifetimeMin = 10.0f;
+        settings.lifetimeMax = 10.0f;
+
+        // 8 partículas por segundo a 16 Hz: media partícula por frame se acumula entre frames.
+        ParticleSystem smoke(64);
+        smoke.setSettings(settings);
+        smoke.setEmitter(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(1.0f, 0.0f));
+        smoke.setEmissionRate(8.0f);
+        for (int frame = 1; frame <= 10; ++frame) {
+            smoke.update(step);
+            if (smoke.getParticleCount() != static_cast<std::size_t>(frame / 2)) {
+                detail = "tras " + std::to_string(frame) + " frames hay " + std::to_string(smoke.getParticleCount()) +
+                         " partículas (se esperaban " + std::to_string(frame / 2) + ")";
+                return false;
+            }
+        }
+
+        // Las ráfagas y el emisor continuo se recortan a la capacidad.
+        smoke.emit(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(0.0f, 1.0f), 1000);
+        smoke.update(step);
+        smoke.emit(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(0.0f, 1.0f), 1);
+        if (smoke.getParticleCount() != smoke.getCapacity()) {
+            detail = "la ráfaga dejó " + std::to_string(smoke.getParticleCount()) + " partículas con capacidad 64";
+            return false;
+        }
+
+        // Vida de 0.5 s: la primera ráfaga muere en el segundo paso de 0.25 s y la segunda,
+        // emitida entre ambos, ocupa los huecos y sigue viva hasta el tercero.
+        settings.lifetimeMin = 0.5f;
+        settings.lifetimeMax = 0.5f;
+        ParticleSystem sparks(64);
+        sparks.setSettings(settings);
+        sparks.emit(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(1.0f, 0.0f), 10);
+        sparks.update(0.25f);
+        sparks.emit(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(1.0f, 0.0f), 5);
+        const std::size_t beforeDeath = sparks.getParticleCount();
+        sparks.update(0.25f);
+        const std::size_t afterFirstDeath = sparks.getParticleCount();
+        sparks.update(0.25f);
+        if (beforeDeath != 15 || afterFirstDeath != 5 || sparks.getParticleCount() != 0) {
+            detail = "vivas: " + std::to_string(beforeDeath) + ", " + std::to_string(afterFirstDeath) + ", " +
+                     std::to_string(sparks.getParticleCount()) + " (se esperaban 15, 5, 0)";
+            return false;
+        }
+        return true;
+    });
+    suite.addCheck("Steering: rutas SIMD == Transform::Seek", [](std::string& detail) {
+        // 1003 agentes: cubre los bloques de 8 y 4 y la cola escalar.
+        const std::size_t count = 1003;
+        std::vector<sf::Vector2f> starts;
+        SteeringAgents reference = makeSteeringAgents(count, starts);
+        std::vector<Transform> transforms(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            transforms[i].setPosition(starts[i]);
+        }
+
+        const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE, SimdLevel::AVX2 };
+        const SteeringBehavior behaviors[] = { SteeringBehavior::Seek, SteeringBehavior::Flee, SteeringBehavior::Arrive };
+        for (SteeringBehavior behavior : behaviors) {
+            SteeringParams params;
+            params.behavior = behavior;
+            params.maxSpeed = 200.0f;
+            params.range = behavior == SteeringBehavior::Flee ? 800.0f : 20.0f;
+            params.slowRadius = 300.0f;
+
+            // Referencia: la ruta escalar, que para Seek se compara además con Transform::Seek.
+            SteeringAgents scalar = reference;
+            for (int step = 0; step < 120; ++step) {
+                Steering::update(scalar, params, kStep, SimdLevel::Scalar);
+                if (behavior != SteeringBehavior::Seek) continue;
+                for (std::size_t i = 0; i < count; ++i) {
+                    sf::Vector2f target(reference.targetX[i], reference.targetY[i]);
+                    transforms[i].Seek(target, params.maxSpeed, kStep, params.range);
+                }
+            }
+            if (behavior == SteeringBehavior::Seek) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    sf::Vector2f position = transforms[i].getPosition();
+                    if (std::abs(position.x - scalar.positionX[i]) > 1e-3f || std::abs(position.y - scalar.positionY[i]) > 1e-3f) {
+                        detail = "Scalar difiere de Transform::Seek en el agente " + std::to_string(i);
+                        return false;
+                    }
+                }
+            }
+
+            for (SimdLevel level : levels) {
+                if (level == SimdLevel::Scalar || level > Steering::bestSimdLevel()) continue;
+                for (bool fastRsqrt : { false, true }) {
+                    SteeringAgents simd = reference;
+                    params.fastRsqrt = fastRsqrt;
+                    for (int step = 0; step < 120; ++step) {
+                        Steering::update(simd, params, kStep, level);
+                    }
+                    // rsqrt con un paso de Newton-Raphson: ~22 bits, unos pocos píxeles/1000 tras 120 pasos.
+                    float tolerance = fastRsqrt ? 2e-2f : 1e-3f;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        if (std::abs(simd.positionX[i] - scalar.positionX[i]) > tolerance ||
+                            std::abs(simd.positionY[i] - scalar.positionY[i]) > tolerance) {
+                            detail = std::string(Steering::simdLevelName(level)) + (fastRsqrt ? " rsqrt" : "") +
+                                     " difiere de Scalar en el agente " + std::to_string(i) +
+                                     " (comportamiento " + std::to_string(static_cast<int>(behavior)) + ")";
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    });
+
+    suite.addCheck("FixedSteering: Q16.16 idéntico bit a bit en todas las rutas y compilaciones", [](std::string& detail) {
+        // Aritmética básica con resultados exactos.
+        if (Fixed16::fromFloat(1.5f).raw() != 98304 || (Fixed16::fromFloat(-2.25f) * Fixed16::fromInt(3)).raw() != -442368 ||
+            (Fixed16::fromInt(7) / Fixed16::fromInt(2)).raw() != 229376 || Fixed16::fromInt(2).sqrt().raw() != 92681 ||
+            Fixed16::isqrt(~sf::Uint64(0)) != 0xFFFFFFFFu || FixedVector2(Fixed16::fromInt(3), Fixed16::fromInt(4)).length() != Fixed16::fromInt(5)) {
+            detail = "la aritmética Q16.16 no da los valores exactos";
+            return false;
+        }
+
+        // Entrada generada con enteros de mt19937 (su secuencia está fijada por el estándar,
+        // a diferencia de las distribuciones de punto flotante).
+        const std::size_t count = 1003;
+        std::mt19937 random(11);
+        FixedSteeringAgents reference;
+        reference.resize(count);
+        std::vector<FixedTransform> transforms(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            reference.positionX[i] = static_cast<sf::Int32>(random() % (2000u << 16));
+            reference.positionY[i] = static_cast<sf::Int32>(random() % (2000u << 16));
+            reference.targetX[i] = static_cast<sf::Int32>(random() % (2000u << 16));
+            reference.targetY[i] = static_cast<sf::Int32>(random() % (2000u << 16));
+            transforms[i].setPosition(FixedVector2(Fixed16::fromRaw(reference.positionX[i]), Fixed16::fromRaw(reference.positionY[i])));
+        }
+        const Fixed16 speed = Fixed16::fromInt(200);
+        const Fixed16 range = Fixed16::fromInt(20);
+        const Fixed16 step = Fixed16::fromFloat(kStep);
+
+        FixedSteeringAgents scalar = reference;
+        for (int tick = 0; tick < 120; ++tick) {
+            FixedSteering::update(scalar, speed, range, step, SimdLevel::Scalar);
+            for (std::size_t i = 0; i < count; ++i) {
+                transforms[i].Seek(FixedVector2(Fixed16::fromRaw(reference.targetX[i]), Fixed16::fromRaw(reference.targetY[i])),
+                                   speed, step, range);
+            }
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            if (transforms[i].getPosition() != FixedVector2(Fixed16::fromRaw(scalar.positionX[i]), Fixed16::fromRaw(scalar.positionY[i]))) {
+                detail = "Scalar difiere de FixedTransform::Seek en el agente " + std::to_string(i);
+                return false;
+            }
+        }
+
+        for (SimdLevel level : { SimdLevel::SSE, SimdLevel::AVX2 }) {
+            if (level > Steering::bestSimdLevel()) continue;
+            FixedSteeringAgents simd = reference;
+            for (int tick = 0; tick < 120; ++tick) {
+                FixedSteering::update(simd, speed, range, step, level);
+            }
+            if (simd.positionX != scalar.positionX || simd.positionY != scalar.positionY ||
+                simd.velocityX != scalar.velocityX || simd.velocityY != scalar.velocityY) {
+                detail = std::string(Steering::simdLevelName(level)) + " difiere de Scalar";
+                return false;
+            }
+        }
+
+        // Huella FNV-1a del estado final: cualquier compilación, CPU o ruta debe reproducirla.
+        sf::Uint64 hash = 14695981039346656037ull;
+        for (const std::vector<sf::Int32>* values : { &scalar.positionX, &scalar.positionY, &scalar.velocityX, &scalar.velocityY }) {
+            for (sf::Int32 value : *values) {
+                sf::Uint32 bits = static_cast<sf::Uint32>(value);
+                for (int byte = 0; byte < 4; ++byte) {
+                    hash = (hash ^ ((bits >> (8 * byte)) & 0xFFu)) * 1099511628211ull;
+                }
+            }
+        }
+        const sf::Uint64 expected = 0x38929f0737d8f2e9ull;
+        if (hash != expected) {
+            char text[64];
+            std::snprintf(text, sizeof(text), "huella 0x%016llx", static_cast<unsigned long long>(hash));
+            detail = std::string(text) + " distinta de la esperada";
+            return false;
+        }
+        return true;
+    });
+
+    suite.addCheck("WaypointPath: avance uniforme por longitud de arco", [](std::string& detail) {
+        auto path = EngineUtilities::MakeShared<WaypointPath>(kTrackWaypoints);
+        const float step = 2.5f;
+        const int steps = static_cast<int>(path->getLength() / step);
+
+        // Dentro de un tramo, cada paso recorre exactamente `step` píxeles; al doblar una
+        // esquina la cuerda es más corta, nunca más larga.
+        PathProgress progress;
+        sf::Vector2f previous = path->getPosition(progress);
+        float travelled = 0.0f;
+        for (int i = 0; i < steps; ++i) {
+            sf::Uint32 segment = progress.segment;
+            sf::Vector2f position = path->advance(progress, step);
+            sf::Vector2f chord = position - previous;
+            float length = std::sqrt(chord.x * chord.x + chord.y * chord.y);
+            if (length > step + 1e-3f || (progress.segment == segment && std::abs(length - step) > 1e-2f)) {
+                detail = "paso " + std::to_string(i) + " recorrió " + std::to_string(length) + " píxeles";
+                return false;
+            }
+            previous = position;
+            travelled += step;
+        }
+
+        // Completar la vuelta devuelve al primer waypoint.
+        sf::Vector2f start = path->advance(progress, path->getLength() - travelled);
+        if (std::abs(start.x - kTrackWaypoints[0].x) > 1e-2f || std::abs(start.y - kTrackWaypoints[0].y) > 1e-2f) {
+            detail = "tras una vuelta quedó en (" + std::to_string(start.x) + ", " + std::to_string(start.y) + ")";
+            return false;
+        }
+
+        // Proyectar un punto de la ruta devuelve ese mismo avance.
+        PathProgress middle = path->progressAt(path->getLength() * 0.37f);
+        PathProgress projected = path->closestProgress(path->getPosition(middle));
+        if (std::abs(projected.distance - middle.distance) > 1e-2f) {
+            detail = "closestProgress devolvió " + std::to_string(projected.distance) + " en vez de " + std::to_string(middle.distance);
+            return false;
+        }
+
+        // La pasada paralela da exactamente lo mismo que la secuencial.
+        PathCrowd serial(path);
+        PathCrowd parallel(path);
+        for (std::size_t i = 0; i < 10000; ++i) {
+            serial.addAgent(path->getLength() * i / 10000.0f, 100.0f + (i % 77));
+            parallel.addAgent(path->getLength() * i / 10000.0f, 100.0f + (i % 77));
+        }
+        ThreadPool pool(4);
+        for (int tick = 0; tick < 600; ++tick) {
+            serial.update(kStep);
+            parallel.update(kStep, &pool);
+        }
+        if (serial.getPositionsX() != parallel.getPositionsX() || serial.getPositionsY() != parallel.getPositionsY()) {
+            detail = "PathCrowd con ThreadPool difiere de la pasada secuencial";
+            return false;
+        }
+        return true;
+    });
+
+    suite.addCheck("RacingLine: pasa por los waypoints a rapidez uniforme", [](std::string& detail) {
+        RacingLine line(kTrackWaypoints);
+        const std::vector<RacingLineSample>& table = line.getTable();
+
+        // Catmull-Rom interpola: cada waypoint queda sobre la curva.
+        for (const sf::Vector2f& waypoint : kTrackWaypoints) {
+            float closest = std::numeric_limits<float>::max();
+            for (const RacingLineSample& entry : table) {
+                sf::Vector2f gap = entry.position - waypoint;
+                closest = std::min(closest, std::sqrt(gap.x * gap.x + gap.y * gap.y));
+            }
+            if (closest > 1.0f) {
+                detail = "un waypoint quedó a " + std::to_string(closest) + " píxeles de la curva";
+                return false;
+            }
+        }
+
+        // Pasos iguales de distancia recorren cuerdas casi iguales, con la tangente en la
+        // dirección de avance y la vuelta cerrada.
+        const float step = 4.0f;
+        sf::Vector2f previous = line.getPosition(0.0f);
+        for (float s = step; s < line.getLength(); s += step) {
+            RacingLineSample sample = line.sample(s);
+            sf::Vector2f chord = sample.position - previous;
+            float length = std::sqrt(chord.x * chord.x + chord.y * chord.y);
+            if (std::abs(length - step) > 0.05f * step) {
+                detail = "a s = " + std::to_string(s) + " un paso de " + std::to_string(step) + " recorrió " + std::to_string(length);
+                return false;
+            }
+            if ((chord.x * sample.tangent.x + chord.y * sample.tangent.y) / length < 0.95f) {
+                detail = "tangente desalineada a s = " + std::to_string(s);
+                return false;
+            }
+            previous = sample.position;
+        }
+        sf::Vector2f lap = line.getPosition(line.getLength() + 1.0f) - line.getPosition(1.0f);
+        if (std::abs(lap.x) > 1e-2f || std::abs(lap.y) > 1e-2f) {
+            detail = "la curva no cierra la vuelta";
+            return false;
+        }
+        return true;
+    });
+
+    suite.addCheck("SpatialHashGrid: consultas == búsqueda exhaustiva", [](std::string& detail) {
+        // Coordenadas negativas y celdas pequeñas: muchas celdas comparten cubeta.
+        std::mt19937 random(31);
+        std::uniform_real_distribution<float> coordinate(-500.0f, 500.0f);
+        std::vector<float> x(5000);
+        std::vector<float> y(5000);
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            x[i] = coordinate(random);
+            y[i] = coordinate(random);
+        }
+        SpatialHashGrid grid(10.0f);
+        grid.build(x.data(), y.data(), x.size());
+
+        std::vector<sf::Uint32> found;
+        std::vector<sf::Uint32> expected;
+        for (int query = 0; query < 200; ++query) {
+            sf::Vector2f center(coordinate(random), coordinate(random));
+            float radius = 5.0f + (query % 10) * 12.0f;
+            bool useBox = query % 2 == 1;
+            sf::FloatRect box(center.x - radius, center.y - radius * 0.5f, radius * 2.0f, radius);
+
+            expected.clear();
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                float dx = x[i] - center.x;
+                float dy = y[i] - center.y;
+                bool inside = useBox ? (x[i] >= box.left && x[i] <= box.left + box.width && y[i] >= box.top && y[i] <= box.top + box.height)
+                                     : dx * dx + dy * dy <= radius * radius;
+                if (inside) expected.push_back(static_cast<sf::Uint32>(i));
+            }
+            if (useBox) {
+                grid.queryAABB(box, found);
+            }
+            else {
+                grid.queryRadius(center, radius, found);
+            }
+            std::sort(found.begin(), found.end());
+            if (found != expected) {
+                detail = std::string(useBox ? "queryAABB" : "queryRadius") + " devolvió " + std::to_string(found.size()) +
+                         " entidades en vez de " + std::to_string(expected.size());
+                return false;
+            }
+        }
+        return true;
+    });
+
+    suite.addCheck("Broadphase: pares del árbol == fuerza bruta", [](std::string& detail) {
+        // Cuerpos sueltos rápidos y lentos más actores de las tres formas, girados.
+        MovingBoxes boxes = makeMovingBoxes(2000);
+        for (std::size_t i = 0; i < boxes.x.size(); i += 10) {
+            boxes.velocityX[i] *= 20.0f;
+            boxes.velocityY[i] *= 20.0f;
+        }
+        Broadphase broadphase;
+        for (std::size_t i = 0; i < boxes.x.size(); ++i) broadphase.addBody(boxes.bounds(i));
+
+        std::vector<EngineUtilities::TSharedPointer<Actor>> actors;
+        for (ShapeType type : { ShapeType::CIRCLE, ShapeType::RECTANGLE, ShapeType::TRIANGLE }) {
+            for (auto& actor : makeActors(60, type)) {
+                actor->getComponent<Transform>()->setPosition(actor->getComponent<Transform>()->getPosition() * 0.7f);
+                broadphase.addActor(actor);
+                actors.push_back(actor);
+            }
+        }
+
+        std::vector<AABB> bounds(broadphase.size());
+        std::vector<BroadphasePair> expected;
+        for (int tick = 0; tick < 30; ++tick) {
+            boxes.step();
+            for (std::size_t i = 0; i < boxes.x.size(); ++i) {
+                broadphase.setBounds(static_cast<sf::Uint32>(i), boxes.bounds(i));
+            }
+            for (std::size_t i = 0; i < actors.size(); ++i) {
+                auto transform = actors[i]->getComponent<Transform>();
+                transform->setPosition(transform->getPosition() + sf::Vector2f(3.0f, -1.0f) * static_cast<float>(i % 4));
+                transform->setRotation(transform->getRotation() + 5.0f);
+            }
+            broadphase.update();
+
+            if (!broadphase.getTree().validate()) {
+                detail = "árbol inconsistente en el tick " + std::to_string(tick);
+                return false;
+            }
+            for (std::size_t i = 0; i < bounds.size(); ++i) bounds[i] = broadphase.getBounds(static_cast<sf::Uint32>(i));
+            bruteForcePairs(bounds, expected);
+            const auto& pairs = broadphase.getPairs();
+            bool same = pairs.size() == expected.size() &&
+                        std::equal(pairs.begin(), pairs.end(), expected.begin(), [](const BroadphasePair& a, const BroadphasePair& b) {
+                            return a.first == b.first && a.second == b.second;
+                        });
+            if (!same) {
+                detail = "tick " + std::to_string(tick) + ": " + std::to_string(pairs.size()) + " pares en vez de " +
+                         std::to_string(expected.size());
+                return false;
+            }
+        }
+
+        // Un círculo de radio 10 en (100, 100): caja de (100, 100) a (120, 120).
+        Collider collider;
+        auto circle = makeActors(1, ShapeType::CIRCLE).front();
+        circle->getComponent<Transform>()->setPosition(sf::Vector2f(100.0f, 100.0f));
+        circle->getComponent<Transform>()->setRotation(0.0f);
+        Collider::fromActor(*circle, collider);
+        AABB box = collider.getBounds();
+        if (collider.type != ColliderType::Circle || std::abs(box.min.x - 100.0f) > 0.1f || std::abs(box.max.y - 120.0f) > 0.1f) {
+            detail = "la caja del círculo no coincide con su forma";
+            return false;
+        }
+        return true;
+    });
+
+    suite.addCheck("PhysicsWorld: contactos, rebote e islas en paralelo", [](std::string& detail) {
+        // Fase estrecha con formas conocidas.
+        Collider circleA;
+        circleA.center = sf::Vector2f(0.0f, 0.0f);
+        circleA.radius = 10.0f;
+        Collider circleB = circleA;
+        circleB.center = sf::Vector2f(15.0f, 0.0f);
+        Collider box;
+        box.type = ColliderType::Box;
+        box.center = sf::Vector2f(0.0f, 10.0f);
+        box.halfExtents = sf::Vector2f(20.0f, 5.0f);
+        Collider diamond = box;
+        diamond.center = sf::Vector2f(25.0f, 10.0f);
+        diamond.halfExtents = sf::Vector2f(5.0f, 5.0f);
+        diamond.rotation = 45.0f;
+
+        Contact contact;
+        auto near = [](float a, float b) { return std::abs(a - b) < 1e-3f; };
+        if (!PhysicsWorld::collide(circleA, circleB, contact) || !near(contact.normal.x, 1.0f) || !near(contact.penetration, 5.0f)) {
+            detail = "círculo-círculo: normal o penetración incorrecta";
+            return false;
+        }
+        // El círculo toca la cara superior de la caja (y = 5): 5 px de penetración hacia abajo.
+        if (!PhysicsWorld::collide(circleA, box, contact) || !near(contact.normal.y, 1.0f) || !near(contact.penetration, 5.0f)) {
+            detail = "círculo-caja: normal o penetración incorrecta";
+            return false;
+        }
+        if (!PhysicsWorld::collide(box, circleA, contact) || !near(contact.normal.y, -1.0f)) {
+            detail = "caja-círculo: la normal no se invirtió";
+            return false;
+        }
+        // El rombo (caja de 10x10 girada 45°) llega hasta x = 25 - 7.07: 2.07 px dentro de la caja.
+        if (!PhysicsWorld::collide(box, diamond, contact) || !near(contact.normal.x, 1.0f) ||
+            std::abs(contact.penetration - (20.0f - (25.0f - 5.0f * std::sqrt(2.0f)))) > 1e-3f) {
+            detail = "caja-caja: normal o penetración incorrecta";
+            return false;
+        }
+        diamond.center.x = 30.0f;
+        if (PhysicsWorld::collide(box, diamond, contact)) {
+            detail = "caja-caja: reportó contacto con cajas separadas";
+            return false;
+        }
+
+        // Choque frontal elástico de masas iguales: se intercambian las velocidades.
+        PhysicsWorld world(0.0f);
+        circleB.center = sf::Vector2f(19.5f, 0.0f);
+        sf::Uint32 left = world.addBody(circleA, 1.0f, 1.0f);
+        sf::Uint32 right = world.addBody(circleB, 1.0f, 1.0f);
+        world.setVelocity(left, sf::Vector2f(100.0f, 0.0f));
+        world.setVelocity(right, sf::Vector2f(-100.0f, 0.0f));
+        world.step(kStep);
+        if (!near(world.getVelocity(left).x, -100.0f) || !near(world.getVelocity(right).x, 100.0f)) {
+            detail = "el choque elástico no intercambió las velocidades";
+            return false;
+        }
+
+        // Las islas repartidas en hilos dan exactamente el mismo resultado que en serie.
+        PhysicsWorld serial;
+        PhysicsWorld parallel;
+        std::vector<sf::Vector2f> centers;
+        makePileUps(serial, 4000, centers);
+        makePileUps(parallel, 4000, centers);
+        ThreadPool pool(4);
+        for (int tick = 0; tick < 20; ++tick) {
+            pushTowardCenters(serial, centers);
+            pushTowardCenters(parallel, centers);
+            serial.step(kStep);
+            parallel.step(kStep, &pool);
+        }
+        if (serial.getIslandCount() < 100) {
+            detail = "se esperaban cientos de islas y hubo " + std::to_string(serial.getIslandCount());
+            return false;
+        }
+        for (sf::Uint32 body = 0; body < serial.size(); ++body) {
+            if (serial.getPosition(body) != parallel.getPosition(body) || serial.getVelocity(body) != parallel.getVelocity(body)) {
+                detail = "el cuerpo " + std::to_string(body) + " difiere entre la pasada secuencial y la paralela";
+                return false;
+            }
+        }
+        return true;
+    });
+
+    suite.addCheck("TrackMask: bits == clasificador y distancias exactas", [](std::string& detail) {
+        // La imagen cubre el doble de su tamaño en X: cada píxel es una celda de 2x1 en el mundo.
+        const sf::Image image = makeRingTrack(300, 160);
+        TrackMask mask;
+        if (!mask.bake(image, sf::FloatRect(-50.0f, 20.0f, 600.0f, 160.0f))) {
+            detail = "no se horneó la máscara";
+            return false;
+        }
+        for (unsigned int y = 0; y < 160; ++y) {
+            for (unsigned int x = 0; x < 300; ++x) {
+                sf::Vector2f center(-50.0f + 2.0f * x + 1.0f, 20.0f + y + 0.5f);
+                if (mask.isDrivable(center) != TrackMask::isRoadColor(image.getPixel(x, y))) {
+                    detail = "celda (" + std::to_string(x) + ", " + std::to_string(y) + ") mal clasificada";
+                    return false;
+                }
+            }
+        }
+        for (sf::Vector2f outside : { sf::Vector2f(-51.0f, 100.0f), sf::Vector2f(550.0f, 100.0f),
+                                      sf::Vector2f(200.0f, 19.0f), sf::Vector2f(200.0f, 180.0f) }) {
+            if (mask.isDrivable(outside)) {
+                detail = "una posición fuera de la imagen cuenta como asfalto";
+                return false;
+            }
+        }
+
+        // Campo de distancias contra la búsqueda exhaustiva de la celda opuesta más cercana.
+        for (unsigned int y = 0; y < 160; y += 7) {
+            for (unsigned int x = 0; x < 300; x += 5) {
+                bool road = TrackMask::isRoadColor(image.getPixel(x, y));
+                float best = std::numeric_limits<float>::max();
+                for (unsigned int j = 0; j < 160; ++j) {
+                    for (unsigned int i = 0; i < 300; ++i) {
+                        if (TrackMask::isRoadColor(image.getPixel(i, j)) != road) {
+                            float dx = 2.0f * (static_cast<float>(i) - x);
+                            float dy = static_cast<float>(j) - y;
+                            best = std::min(best, dx * dx + dy * dy);
+                        }
+                    }
+                }
+                float expected = road ? std::sqrt(best) : -std::sqrt(best);
+                sf::Vector2f center(-50.0f + 2.0f * x + 1.0f, 20.0f + y + 0.5f);
+                if (std::abs(mask.getDistance(center) - expected) > 0.25f) {
+                    detail = "distancia en (" + std::to_string(x) + ", " + std::to_string(y) + "): " +
+                             std::to_string(mask.getDistance(center)) + " en vez de " + std::to_string(expected);
+                    return false;
+                }
+            }
+        }
+
+        // En el césped interior, avanzar por el gradiente acerca al asfalto.
+        sf::Vector2f inside(-50.0f + 400.0f, 100.0f);
+        sf::Vector2f gradient = mask.getGradient(inside);
+        if (mask.getDistance(inside + gradient * 6.0f) <= mask.getDistance(inside) + 3.0f) {
+            detail = "el gradiente no apunta hacia la pista";
+            return false;
+        }
+        return true;
+    });
+
+    suite.addCheck("FlowField: caminos al checkpoint, caché y obstáculos", [](std::string& detail) {
+        TrackMask mask;
+        mask.bake(makeRingTrack(1100, 600), sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), false);
+        const sf::FloatRect bounds(0.0f, 0.0f, 1100.0f, 600.0f);
+        const std::vector<sf::Vector2f> checkpoints = { { 550.0f, 45.0f }, { 1000.0f, 300.0f }, { 550.0f, 555.0f }, { 100.0f, 300.0f } };
+
+        // Antes de `prepare`, las consultas devuelven valores neutros en vez de leer campos vacíos.
+        FlowField serial(bounds, 10.0f, &mask);
+        serial.setCheckpoints(checkpoints);
+        float unpreparedX[2] = { 1.0f, 1.0f };
+        float unpreparedY[2] = { 1.0f, 1.0f };
+        const float probeX[2] = { 550.0f, 1000.0f };
+        const float probeY[2] = { 45.0f, 300.0f };
+        serial.getDirections(0, probeX, probeY, 2, unpreparedX, unpreparedY);
+        if (serial.isReady(0) || serial.getDirection(0, checkpoints[1]) != sf::Vector2f(0.0f, 0.0f) ||
+            serial.getDirection(checkpoints.size(), checkpoints[1]) != sf::Vector2f(0.0f, 0.0f) ||
+            unpreparedX[0] != 0.0f || unpreparedY[1] != 0.0f ||
+            !std::isinf(serial.getCost(0, checkpoints[1])) ||
+            serial.getNextCell(0, checkpoints[1]) != checkpoints[1]) {
+            detail = "un campo sin calcular no devuelve dirección cero";
+            return false;
+        }
+
+        // Desde cada celda alcanzable, seguir las direcciones llega al checkpoint bajando de costo.
+        serial.prepare();
+        for (std::size_t checkpoint = 0; checkpoint < checkpoints.size(); ++checkpoint) {
+            if (serial.getCost(checkpoint, checkpoints[checkpoint]) != 0.0f) {
+                detail = "el checkpoint " + std::to_string(checkpoint) + " no tiene costo 0";
+                return false;
+            }
+            for (sf::Uint32 row = 0; row < serial.getRows(); row += 3) {
+                for (sf::Uint32 column = 0; column < serial.getColumns(); column += 3) {
+                    sf::Vector2f position((column + 0.5f) * 10.0f, (row + 0.5f) * 10.0f);
+                    std::size_t steps = 0;
+                    while (serial.getCost(checkpoint, position) > 0.0f && steps < 2000) {
+                        sf::Vector2f next = serial.getNextCell(checkpoint, position);
+                        if (serial.getCost(checkpoint, next) >= serial.getCost(checkpoint, position)) {
+                            detail = "el costo no baja en (" + std::to_string(column) + ", " + std::to_string(row) + ")";
+                            return false;
+                        }
+                        position = next;
+                        ++steps;
+                    }
+                    if (steps == 2000) {
+                        detail = "el camino no llega al checkpoint " + std::to_string(checkpoint);
+                        return false;
+                    }
+                }
+            }
+        }
+
+        // Los campos calculados en paralelo son idénticos.
+        ThreadPool pool(4);
+        FlowField parallel(bounds, 10.0f, &mask);
+        parallel.setCheckpoints(checkpoints);
+        parallel.prepare(&pool);
+        for (std::size_t checkpoint = 0; checkpoint < checkpoints.size(); ++checkpoint) {
+            for (float y = 5.0f; y < 600.0f; y += 10.0f) {
+                for (float x = 5.0f; x < 1100.0f; x += 10.0f) {
+                    if (parallel.getCost(checkpoint, { x, y }) != serial.getCost(checkpoint, { x, y }) ||
+                        parallel.getDirection(checkpoint, { x, y }) != serial.getDirection(checkpoint, { x, y })) {
+                        detail = "el campo paralelo difiere del serial";
+                        return false;
+                    }
+                }
+            }
+        }
+
+        // Caché: sin cambios no se recalcula; un obstáculo nuevo invalida, uno repetido no.
+        std::size_t builds = serial.getBuildCount();
+        serial.setCheckpoints(checkpoints);
+        serial.prepare();
+        const sf::FloatRect wall(500.0f, 0.0f, 20.0f, 120.0f);
+        serial.addObstacle(wall);
+        bool invalidated = !serial.isReady(0);
+        serial.prepare();
+        std::size_t afterWall = serial.getBuildCount();
+        serial.addObstacle(wall);
+        serial.prepare();
+        if (afterWall != builds + checkpoints.size() || !invalidated || serial.getBuildCount() != afterWall) {
+            detail = "el caché recalculó de más o de menos";
+            return false;
+        }
+
+        // Con el muro, el camino al checkpoint 0 desde el otro lado lo rodea.
+        sf::Vector2f position(450.0f, 45.0f);
+        for (int steps = 0; steps < 2000 && serial.getCost(0, position) > 0.0f; ++steps) {
+            position = serial.getNextCell(0, position);
+            if (serial.isBlocked(position)) {
+                detail = "el camino atraviesa el obstáculo";
+                return false;
+            }
+        }
+        if (serial.getCost(0, position) != 0.0f) {
+            detail = "no hay camino alrededor del obstáculo";
+            return false;
+        }
+        return true;
+    });
+
+    suite.addCheck("PathfindingService: A* óptimo, rebanadas, caché LRU y obstáculos", [](std::string& detail) {
+        TrackMask mask;
+        mask.bake(makeRingTrack(1100, 600), sf::FloatRect(0.0f, 0.0f, 1100.0f, 600.0f), false);
+        const sf::FloatRect bounds(0.0f, 0.0f, 1100.0f, 600.0f);
+        const auto routes = makeRingRoutes(24);
+
+        // El costo de A* coincide con el Dijkstra completo del campo de flujo (misma rejilla).
+        FlowField reference(bounds, 10.0f, &mask);
+        std::vector<sf::Vector2f> goals;
+        for (const auto& route : routes) goals.push_back(route.second);
+        reference.setCheckpoints(goals);
+        reference.prepare();
+
+        // Con hilos y rebanadas pequeñas (las búsquedas se turnan) y en el hilo que llama.
+        PathfindingService async(bounds, 10.0f, &mask, 2, 8);
+        async.setSliceBudget(16);
+        PathfindingService stepped(bounds, 10.0f, &mask, 0, 8);
+        std::vector<PathfindingService::Handle> asyncHandles;
+        std::vector<PathfindingService::Handle> inlineHandles;
+        for (const auto& route : routes) {
+            asyncHandles.push_back(async.request(route.first, route.second));
+            inlineHandles.push_back(stepped.request(route.first, route.second));
+        }
+        stepped.update(100);
+        if (stepped.getExpansionCount() > 100) {
+            detail = "update se pasó del presupuesto de expansiones";
+            return false;
+        }
+        async.waitIdle();
+        stepped.waitIdle();
+        for (std::size_t i = 0; i < routes.size(); ++i) {
+            std::vector<sf::Vector2f> asyncPath;
+            std::vector<sf::Vector2f> inlinePath;
+            float asyncCost = 0.0f;
+            float inlineCost = 0.0f;
+            if (!async.takePath(asyncHandles[i], asyncPath, &asyncCost) || !stepped.takePath(inlineHandles[i], inlinePath, &inlineCost)) {
+                detail = "la ruta " + std::to_string(i) + " no se encontró";
+                return false;
+            }
+            float expected = reference.getCost(i, routes[i].first);
+            if (asyncPath != inlinePath || asyncCost != inlineCost || std::abs(asyncCost - expected) > 1e-3f * expected + 1e-3f) {
+                detail = "ruta " + std::to_string(i) + ": costo " + std::to_string(asyncCost) + " en vez de " + std::to_string(expected);
+                return false;
+            }
+            if (asyncPath.front() != routes[i].first || asyncPath.back() != routes[i].second) {
+                detail = "la ruta no empieza y termina en las posiciones pedidas";
+                return false;
+            }
+        }
+        if (async.getStatus(asyncHandles[0]) != PathStatus::Unknown) {
+            detail = "el handle sigue vivo después de entregar la ruta";
+            return false;
+        }
+
+        // Un tramo recto sin obstáculos queda sin puntos intermedios, también al salir del caché.
+        const sf::Vector2f straightStart(905.0f, 255.0f);
+        const sf::Vector2f straightGoal(905.0f, 345.0f);
+        const std::vector<sf::Vector2f> straightPath = { straightStart, straightGoal };
+        for (int pass = 0; pass < 2; ++pass) {
+            std::vector<sf::Vector2f> path;
+            PathfindingService::Handle straight = stepped.request(straightStart, straightGoal);
+            stepped.waitIdle();
+            if (!stepped.takePath(straight, path) || path != straightPath) {
+                detail = "la ruta recta tiene " + std::to_string(path.size()) + " puntos en vez de 2";
+                return false;
+            }
+        }
+
+        // Caché LRU de 2 entradas: A y B guardadas, A se vuelve a usar, C desaloja a B.
+        PathfindingService lru(bounds, 10.0f, &mask, 0, 2);
+        auto solve = [&lru](const std::pair<sf::Vector2f, sf::Vector2f>& route) {
+            std::vector<sf::Vector2f> path;
+            PathfindingService::Handle handle = lru.request(route.first, route.second);
+            lru.waitIdle();
+            return lru.takePath(handle, path);
+        };
+        solve(routes[0]);
+        solve(routes[1]);
+        solve(routes[0]);
+        solve(routes[2]);
+        const std::size_t hitsBefore = lru.getCacheHits();
+        solve(routes[0]);
+        const bool keptRecent = lru.getCacheHits() == hitsBefore + 1;
+        solve(routes[1]);
+        if (!keptRecent || lru.getCacheHits() != hitsBefore + 1 || lru.getCacheSize() != 2 || lru.getCacheMisses() != 4) {
+            detail = "el caché no desalojó la ruta menos usada";
+            return false;
+        }
+
+        // Un muro que corta el anillo de lado a lado: la ruta lo rodea por el césped o no existe.
+        const sf::Vector2f left(200.0f, 300.0f);
+        const sf::Vector2f right(900.0f, 300.0f);
+        async.addObstacle(sf::FloatRect(540.0f, 0.0f, 20.0f, 600.0f));
+        if (async.getCacheSize() != 0) {
+            detail = "el obstáculo no vació el caché";
+            return false;
+        }
+        PathfindingService::Handle blocked = async.request(left, right);
+        async.waitIdle();
+        std::vector<sf::Vector2f> path;
+        if (async.takePath(blocked, path) || !path.empty()) {
+            detail = "encontró una ruta a través de un muro completo";
+            return false;
+        }
+        async.clearObstacles();
+        async.addObstacle(sf::FloatRect(540.0f, 0.0f, 20.0f, 150.0f));
+        PathfindingService::Handle around = async.request(sf::Vector2f(450.0f, 90.0f), sf::Vector2f(650.0f, 90.0f));
+        async.waitIdle();
+        if (!async.takePath(around, path)) {
+            detail = "no encontró la ruta alrededor del obstáculo";
+            return false;
+        }
+        for (std::size_t i = 1; i < path.size(); ++i) {
+            for (float t = 0.0f; t <= 1.0f; t += 0.05f) {
+                sf::Vector2f point = path[i - 1] + (path[i] - path[i - 1]) * t;
+                if (point.x >= 540.0f && point.x < 560.0f && point.y < 150.0f) {
+                    detail = "la ruta atraviesa el obstáculo";
+                    return false;
+                }
+            }
+        }
+        return true;
+    });
+
+    suite.addCheck("InputSystem: flancos por tick y grabación", [](std::string& detail) {
+        sf::Event press;
+        press.type = sf::Event::KeyPressed;
+        press.key.code = sf::Keyboard::Space;
+        sf::Event release = press;
+        release.type = sf::Event::KeyReleased;
+        sf::Event move;
+        move.type = sf::Event::MouseMoved;
+        move.mouseMove.x = 120;
+        move.mouseMove.y = 80;
+
+        const std::string path = "input_check.bin";
+        std::vector<InputSnapshot> live;
+        {
+            InputSystem input;
+            if (!input.startRecording(path)) {
+                detail = "no se pudo grabar";
+                return false;
+            }
+            // Pulsar y soltar dentro del mismo frame: el primer tick ve ambos flancos, el
+            // segundo ya no.
+            input.processEvents({ move, press, release });
+            live.push_back(input.consumeTick());
+            live.push_back(input.consumeTick());
+            input.processEvents({ press });
+            live.push_back(input.consumeTick());
+            input.stop();
+        }
+        if (!live[0].wasKeyPressed(sf::Keyboard::Space) || !live[0].wasKeyReleased(sf::Keyboard::Space) ||
+            live[0].isKeyDown(sf::Keyboard::Space) || live[1].wasKeyPressed(sf::Keyboard::Space) ||
+            !live[2].isKeyDown(sf::Keyboard::Space) || !live[0].mouseInside || live[0].mousePosition.x != 120.0f) {
+            detail = "flancos o posición incorrectos";
+            std::remove(path.c_str());
+            return false;
+        }
+
+        InputSystem replay;
+        bool loaded = replay.startReplay(path);
+        std::remove(path.c_str());
+        if (!loaded) {
+            detail = "no se pudo cargar la grabación";
+            return false;
+        }
+        auto sameInput = [](const InputSnapshot& a, const InputSnapshot& b) {
+            return std::memcmp(a.keysDown, b.keysDown, sizeof(a.keysDown)) == 0 &&
+                   std::memcmp(a.keysPressed, b.keysPressed, sizeof(a.keysPressed)) == 0 &&
+                   std::memcmp(a.keysReleased, b.keysReleased, sizeof(a.keysReleased)) == 0 &&
+                   a.mousePosition == b.mousePosition && a.mouseDelta == b.mouseDelta &&
+                   a.wheelDelta == b.wheelDelta && a.buttonsDown == b.buttonsDown &&
+                   a.buttonsPressed == b.buttonsPressed && a.buttonsReleased == b.buttonsReleased &&
+                   a.mouseInside == b.mouseInside && a.hasFocus == b.hasFocus && a.tick == b.tick;
+        };
+        for (const InputSnapshot& expected : live) {
+            if (!sameInput(replay.consumeTick(), expected)) {
+                detail = "el tick " + std::to_string(expected.tick) + " reproducido difiere";
+                return false;
+            }
+        }
+        InputSnapshot latest = replay.readLatest();
+        if (!sameInput(latest, live[2])) {
+            detail = "readLatest no devuelve el último tick";
+            return false;
+        }
+        return true;
+    });
+}
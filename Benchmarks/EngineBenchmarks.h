@@ -0,0 +1,16 @@
+#pragma once
+#include "Benchmark.h"  // Arnés de microbenchmarks.
+
+/**
+ * @brief Registra los microbenchmarks de las rutas críticas del motor.
+ *
+ * Componentes (`Entity::getComponent`), punteros inteligentes (`TSharedPointer`),
+ * simulación (`Actor::update`, `Transform::Seek`, kernels de steering por lotes en
+ * flotante y en punto fijo, seguimiento de rutas), rejilla hash de proximidad, fase amplia de colisiones, física,
+ * máscara de la pista, campos de flujo, rutas A* y agrupación de geometría de formas con
+ * 1k, 10k y 100k actores. Registra también las comprobaciones de `--verify` sobre resultados
+ * exactos del motor.
+ *
+ * @param suite Suite donde se registran los casos.
+ */
+void registerEngineBenchmarks(BenchmarkSuite& suite);
@@ -0,0 +1,13 @@
+#include "Benchmark.h"
+#include "EngineBenchmarks.h"
+
+int main(int argc, char** argv)
+{
+    BenchmarkSuite suite;
+    if (!suite.parseCommandLine(argc, argv)) {
+        return 1;
+    }
+
+    registerEngineBenchmarks(suite);
+    return suite.run();
+}
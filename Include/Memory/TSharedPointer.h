@@ -30,11 +30,11 @@
 
 namespace EngineUtilities {
 	/**
-	 * @brief Clase TSharedPointer para manejar la gestin de memoria compartida.
+	 * @brief Clase TSharedPointer para manejar la gestión de memoria compartida.
 	 *
 	 * La clase TSharedPointer gestiona la memoria de un objeto de tipo T y lleva un
-	 * recuento de referencias para permitir la comparticin segura de un mismo objeto
-	 * en mltiples instancias de TSharedPointer.
+	 * recuento de referencias para permitir la compartición segura de un mismo objeto
+	 * en múltiples instancias de TSharedPointer.
 	 */
 	template<typename T>
 	class TSharedPointer
@@ -99,7 +99,7 @@ namespace EngineUtilities {
 		}
 
 		/**
-		 * @brief Operador de asignacin de copia.
+		 * @brief Operador de asignación de copia.
 		 *
 		 * Libera el objeto actual, copia el puntero y el recuento de referencias del otro
 		 * TSharedPointer, y aumenta el recuento de referencias.
@@ -129,7 +129,7 @@ namespace EngineUtilities {
 		}
 
 		/**
-		 * @brief Operador de asignacin de movimiento.
+		 * @brief Operador de asignación de movimiento.
 		 *
 		 * Libera el objeto actual, transfiere la propiedad del puntero y el recuento de
 		 * referencias del otro TSharedPointer al actual.
@@ -172,7 +172,7 @@ namespace EngineUtilities {
 		}
 
 		/**
-		 * @brief Operador de desreferenciacin.
+		 * @brief Operador de desreferenciación.
 		 *
 		 * @return Referencia al objeto gestionado.
 		 */
@@ -210,7 +210,7 @@ namespace EngineUtilities {
 		int* refCount; ///< Puntero al recuento de referencias.
 
 		/**
-		 * @brief Mtodo swap.
+		 * @brief Método swap.
 		 *
 		 * Intercambia los datos de dos objetos TSharedPointer.
 		 *
@@ -256,24 +256,24 @@ namespace EngineUtilities {
 			}
 		}
 
-		// Mtodo de conversin para hacer cast dinmico
+		// Método de conversión para hacer cast dinámico
 		template<typename U>
 		TSharedPointer<U> dynamic_pointer_cast() const {
 			// Intenta convertir el puntero de tipo T a U
 			U* castedPtr = dynamic_cast<U*>(ptr);
 			if (castedPtr) {
-				// Si la conversin es exitosa, devuelve un nuevo TSharedPointer<U>
+				// Si la conversión es exitosa, devuelve un nuevo TSharedPointer<U>
 				return TSharedPointer<U>(castedPtr, refCount);
 			}
 			else {
-				// Si falla la conversin, devuelve un TSharedPointer<U> nulo
+				// Si falla la conversión, devuelve un TSharedPointer<U> nulo
 				return TSharedPointer<U>();
 			}
 		}
 	};
 
 	/**
-	 * @brief Funcin de utilidad para crear un TSharedPointer.
+	 * @brief Función de utilidad para crear un TSharedPointer.
 	 *
 	 * @tparam T Tipo del objeto gestionado.
 	 * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
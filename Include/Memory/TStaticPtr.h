@@ -29,20 +29,20 @@
 #pragma once
 namespace EngineUtilities {
   /**
- * @brief Clase TStaticPtr para manejo de un puntero esttico.
+ * @brief Clase TStaticPtr para manejo de un puntero estático.
  *
- * La clase TStaticPtr gestiona un nico objeto esttico y proporciona mtodos
+ * La clase TStaticPtr gestiona un único objeto estático y proporciona métodos
  * para acceder al objeto, verificar si el puntero es nulo y realizar operaciones
- * bsicas de manejo de memoria.
+ * básicas de manejo de memoria.
  */
   template<typename T>
   class TStaticPtr
   {
   public:
     /**
-     * @brief Inicializa el puntero esttico al objeto.
+     * @brief Inicializa el puntero estático al objeto.
      *
-     * Inicializa el puntero esttico a nullptr.
+     * Inicializa el puntero estático a nullptr.
      */
     TStaticPtr() = default;
 
@@ -63,7 +63,7 @@ namespace EngineUtilities {
     /**
      * @brief Destructor.
      *
-     * Libera la memoria del objeto gestionado si es la ltima instancia.
+     * Libera la memoria del objeto gestionado si es la última instancia.
      */
     ~TStaticPtr()
     {
@@ -95,7 +95,7 @@ namespace EngineUtilities {
     }
 
     /**
-     * @brief Reiniciar el puntero esttico con un nuevo objeto.
+     * @brief Reiniciar el puntero estático con un nuevo objeto.
      *
      * Libera la memoria del objeto actual (si existe) y toma la propiedad de un nuevo puntero crudo.
      *
@@ -111,11 +111,11 @@ namespace EngineUtilities {
     }
 
   private:
-    static T* instance; ///< Puntero esttico al objeto gestionado.
+    static T* instance; ///< Puntero estático al objeto gestionado.
   };
 
   /*
-  // Inicializar el puntero esttico
+  // Inicializar el puntero estático
   template<typename T>
   T* TStaticPtr<T>::instance = nullptr;
 
@@ -35,7 +35,7 @@ namespace EngineUtilities {
 		 *
 		 * La clase TWeakPointer proporciona una manera de observar un objeto gestionado por un TSharedPointer
 		 * sin tener influencia sobre el recuento de referencias del objeto. Permite acceder al objeto solo si
-		 * an existe.
+		 * aún existe.
 		 */
 	template<typename T>
 	class TWeakPointer
@@ -49,7 +49,7 @@ namespace EngineUtilities {
 		/**
 		 * @brief Constructor que toma un TSharedPointer.
 		 *
-		 * @param sharedPtr TSharedPointer desde el cual se observar el objeto.
+		 * @param sharedPtr TSharedPointer desde el cual se observará el objeto.
 		 */
 		TWeakPointer(const TSharedPointer<T>& sharedPtr) 
 		: ptr(sharedPtr.ptr), refCount(sharedPtr.refCount) {}
@@ -105,7 +105,7 @@ int main()
 				EngineUtilities::TSharedPointer<MyClass> sp2 = wp1.lock();
 				if (!sp2.isNull())
 				{
-						sp2->display(); // Debera mostrar el valor 10
+						sp2->display(); // Debería mostrar el valor 10
 				}
 				else
 				{
@@ -116,23 +116,23 @@ int main()
 				EngineUtilities::TSharedPointer<MyClass> sp3 = EngineUtilities::MakeShared<MyClass>(20);
 				sp3 = std::move(sp1); // Mueve la propiedad de sp1 a sp3
 
-				// El puntero compartido original (sp1) ahora est vaco
+				// El puntero compartido original (sp1) ahora está vacío
 				EngineUtilities::TSharedPointer<MyClass> sp4 = wp1.lock();
 				if (sp4.isNull())
 				{
 						std::cout << "sp1 has been moved and is now null." << std::endl;
 				}
 
-				// Intentar obtener un TSharedPointer despus del movimiento
+				// Intentar obtener un TSharedPointer después del movimiento
 				if (sp3.isNull())
 				{
 						std::cout << "sp3 is null." << std::endl;
 				}
 				else
 				{
-						sp3->display(); // Debera mostrar el valor 20
+						sp3->display(); // Debería mostrar el valor 20
 				}
-		} // Aqu, tanto sp2 como sp4 se destruyen y la memoria de MyClass se libera automticamente
+		} // Aquí, tanto sp2 como sp4 se destruyen y la memoria de MyClass se libera automáticamente
 
 		return 0;
 }
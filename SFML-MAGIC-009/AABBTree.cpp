@@ -0,0 +1,400 @@
+#include "AABBTree.h"
+
+/**
+ * @brief Constructor.
+ *
+ * @param margin Holgura que se agrega a cada lado de las cajas gordas.
+ * @param displacementScale Cuántos ticks de desplazamiento se anticipan al estirar la caja.
+ */
+AABBTree::AABBTree(float margin, float displacementScale)
+    : m_margin(std::max(margin, 0.0f)), m_displacementScale(std::max(displacementScale, 0.0f)) {
+}
+
+/**
+ * @brief Crea un proxy (hoja) para un objeto.
+ *
+ * @param bounds Caja real del objeto.
+ * @param userData Dato del llamador.
+ * @return Identificador del proxy.
+ */
+sf::Int32 AABBTree::createProxy(const AABB& bounds, sf::Uint32 userData) {
+    sf::Int32 proxyId = allocateNode();
+    m_nodes[proxyId].box = fatten(bounds, sf::Vector2f(0.0f, 0.0f));
+    m_nodes[proxyId].userData = userData;
+    m_nodes[proxyId].height = 0;
+    insertLeaf(proxyId);
+    ++m_proxyCount;
+    return proxyId;
+}
+
+/**
+ * @brief Elimina un proxy.
+ *
+ * @param proxyId Identificador devuelto por `createProxy`.
+ */
+void AABBTree::destroyProxy(sf::Int32 proxyId) {
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+    --m_proxyCount;
+}
+
+/**
+ * @brief Actualiza la caja de un proxy.
+ *
+ * Si la caja gorda todavía contiene a la real (y no quedó exageradamente grande por un
+ * desplazamiento anterior) no se toca el árbol. En otro caso la hoja se saca, se le
+ * calcula una caja gorda nueva y se vuelve a insertar.
+ *
+ * @param proxyId Proxy a mover.
+ * @param bounds Nueva caja real.
+ * @param displacement Desplazamiento del objeto en el tick.
+ * @return true si la hoja se reinsertó.
+ */
+bool AABBTree::moveProxy(sf::Int32 proxyId, const AABB& bounds, const sf::Vector2f& displacement) {
+    const AABB fat = fatten(bounds, displacement);
+    const AABB& current = m_nodes[proxyId].box;
+    if (current.contains(bounds)) {
+        // Una caja que creció para un objeto rápido que luego se detuvo genera pares
+        // falsos: se reinserta si ya no cabe en una versión holgada de la caja nueva.
+        const float slack = 3.0f * m_margin;
+        AABB loose = fat;
+        loose.min -= sf::Vector2f(slack, slack);
+        loose.max += sf::Vector2f(slack, slack);
+        if (loose.contains(current)) {
+            return false;
+        }
+    }
+
+    removeLeaf(proxyId);
+    m_nodes[proxyId].box = fat;
+    insertLeaf(proxyId);
+    return true;
+}
+
+/**
+ * @brief Proxies en el orden en que aparecen en el árbol (recorrido en profundidad).
+ *
+ * @param leaves Recibe los ids de los proxies (se vacía antes).
+ */
+void AABBTree::getLeaves(std::vector<sf::Int32>& leaves) const {
+    leaves.clear();
+    if (m_root == NullNode) {
+        return;
+    }
+
+    static thread_local std::vector<sf::Int32> stack;
+    stack.clear();
+    stack.push_back(m_root);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        sf::Int32 index = stack.back();
+        stack.pop_back();
+        if (node.isLeaf()) {
+            leaves.push_back(index);
+        }
+        else {
+            stack.push_back(node.child2);
+            stack.push_back(node.child1);
+        }
+    }
+}
+
+/**
+ * @brief Suma de los perímetros de los nodos internos.
+ *
+ * @return Costo de superficie total.
+ */
+float AABBTree::getTotalCost() const {
+    float total = 0.0f;
+    for (const Node& node : m_nodes) {
+        if (node.height > 0) {
+            total += node.box.perimeter();
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Comprueba la estructura: enlaces, alturas y que cada caja contenga a sus hijos.
+ *
+ * @return true si el árbol es consistente.
+ */
+bool AABBTree::validate() const {
+    if (m_root == NullNode) {
+        return m_proxyCount == 0;
+    }
+    if (m_nodes[m_root].parent != NullNode) {
+        return false;
+    }
+
+    std::size_t leaves = 0;
+    std::vector<sf::Int32> stack{ m_root };
+    while (!stack.empty()) {
+        sf::Int32 index = stack.back();
+        stack.pop_back();
+        const Node& node = m_nodes[index];
+        if (node.isLeaf()) {
+            if (node.height != 0 || node.child2 != NullNode) {
+                return false;
+            }
+            ++leaves;
+            continue;
+        }
+
+        const Node& child1 = m_nodes[node.child1];
+        const Node& child2 = m_nodes[node.child2];
+        if (child1.parent != index || child2.parent != index) {
+            return false;
+        }
+        if (node.height != 1 + std::max(child1.height, child2.height)) {
+            return false;
+        }
+        if (!node.box.contains(child1.box) || !node.box.contains(child2.box)) {
+            return false;
+        }
+        stack.push_back(node.child1);
+        stack.push_back(node.child2);
+    }
+    return leaves == m_proxyCount;
+}
+
+/**
+ * @brief Toma un nodo de la lista libre (crece el arreglo si hace falta).
+ *
+ * @return Índice del nodo.
+ */
+sf::Int32 AABBTree::allocateNode() {
+    if (m_freeList == NullNode) {
+        m_nodes.emplace_back();
+        return static_cast<sf::Int32>(m_nodes.size() - 1);
+    }
+
+    sf::Int32 node = m_freeList;
+    m_freeList = m_nodes[node].parent;
+    m_nodes[node] = Node();
+    return node;
+}
+
+/**
+ * @brief Devuelve un nodo a la lista libre.
+ *
+ * @param node Índice del nodo.
+ */
+void AABBTree::freeNode(sf::Int32 node) {
+    m_nodes[node].parent = m_freeList;
+    m_nodes[node].child1 = NullNode;
+    m_nodes[node].child2 = NullNode;
+    m_nodes[node].height = -1;
+    m_freeList = node;
+}
+
+/**
+ * @brief Inserta una hoja buscando el hermano más barato.
+ *
+ * En cada nodo interno se compara el costo de colgar la hoja ahí (un padre nuevo cuyo
+ * perímetro es la unión) contra el de bajar a cada hijo, sumando en ambos casos lo que
+ * crecen los ancestros. Es la heurística de superficie de Box2D con perímetros en lugar
+ * de áreas, que es la medida equivalente en 2D.
+ *
+ * @param leaf Hoja a insertar.
+ */
+void AABBTree::insertLeaf(sf::Int32 leaf) {
+    if (m_root == NullNode) {
+        m_root = leaf;
+        m_nodes[leaf].parent = NullNode;
+        return;
+    }
+
+    const AABB leafBox = m_nodes[leaf].box;
+    sf::Int32 index = m_root;
+    while (!m_nodes[index].isLeaf()) {
+        const Node& node = m_nodes[index];
+        const float area = node.box.perimeter();
+        const float combinedArea = AABB::merge(node.box, leafBox).perimeter();
+
+        // Crear un padre nuevo para este nodo y la hoja.
+        const float cost = 2.0f * combinedArea;
+        // Lo que crecen los ancestros si la hoja baja por este nodo.
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](sf::Int32 child) {
+            const Node& childNode = m_nodes[child];
+            float merged = AABB::merge(leafBox, childNode.box).perimeter();
+            return childNode.isLeaf() ? merged + inheritanceCost
+                                      : merged - childNode.box.perimeter() + inheritanceCost;
+        };
+        const float cost1 = descendCost(node.child1);
+        const float cost2 = descendCost(node.child2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const sf::Int32 sibling = index;
+    const sf::Int32 oldParent = m_nodes[sibling].parent;
+    const sf::Int32 newParent = allocateNode();  // Puede reubicar `m_nodes`: no hay referencias vivas.
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].box = AABB::merge(leafBox, m_nodes[sibling].box);
+    m_nodes[newParent].height = m_nodes[sibling].height + 1;
+    m_nodes[newParent].child1 = sibling;
+    m_nodes[newParent].child2 = leaf;
+
+    if (oldParent != NullNode) {
+        if (m_nodes[oldParent].child1 == sibling) {
+            m_nodes[oldParent].child1 = newParent;
+        }
+        else {
+            m_nodes[oldParent].child2 = newParent;
+        }
+    }
+    else {
+        m_root = newParent;
+    }
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    refit(oldParent);
+}
+
+/**
+ * @brief Saca una hoja del árbol (sin liberarla).
+ *
+ * El padre de la hoja desaparece y su hermano ocupa su lugar.
+ *
+ * @param leaf Hoja a quitar.
+ */
+void AABBTree::removeLeaf(sf::Int32 leaf) {
+    if (leaf == m_root) {
+        m_root = NullNode;
+        return;
+    }
+
+    const sf::Int32 parent = m_nodes[leaf].parent;
+    const sf::Int32 grandParent = m_nodes[parent].parent;
+    const sf::Int32 sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grandParent != NullNode) {
+        if (m_nodes[grandParent].child1 == parent) {
+            m_nodes[grandParent].child1 = sibling;
+        }
+        else {
+            m_nodes[grandParent].child2 = sibling;
+        }
+        m_nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        refit(grandParent);
+    }
+    else {
+        m_root = sibling;
+        m_nodes[sibling].parent = NullNode;
+        freeNode(parent);
+    }
+    m_nodes[leaf].parent = NullNode;
+}
+
+/**
+ * @brief Recalcula caja y altura desde un nodo hasta la raíz, rotando donde haga falta.
+ *
+ * Solo se visita la rama que cambió: O(altura) por inserción o eliminación.
+ *
+ * @param node Primer nodo a reajustar.
+ */
+void AABBTree::refit(sf::Int32 node) {
+    while (node != NullNode) {
+        node = balance(node);
+        Node& current = m_nodes[node];
+        const Node& child1 = m_nodes[current.child1];
+        const Node& child2 = m_nodes[current.child2];
+        current.height = 1 + std::max(child1.height, child2.height);
+        current.box = AABB::merge(child1.box, child2.box);
+        node = current.parent;
+    }
+}
+
+/**
+ * @brief Rota un nodo si sus subárboles difieren en altura más de uno.
+ *
+ * El hijo más alto sube al lugar de `a` y `a` adopta el nieto más bajo, como en un árbol
+ * AVL. Así la altura queda en O(log n) aunque los objetos se inserten en orden espacial.
+ *
+ * @param a Nodo a equilibrar.
+ * @return Nodo que queda en la posición de `a`.
+ */
+sf::Int32 AABBTree::balance(sf::Int32 a) {
+    Node& nodeA = m_nodes[a];
+    if (nodeA.isLeaf() || nodeA.height < 2) {
+        return a;
+    }
+
+    const sf::Int32 b = nodeA.child1;
+    const sf::Int32 c = nodeA.child2;
+    const sf::Int32 difference = m_nodes[c].height - m_nodes[b].height;
+    if (difference >= -1 && difference <= 1) {
+        return a;
+    }
+
+    // `up` es el hijo más alto (sube) y `stay` el otro (se queda bajo `a`).
+    const bool rotateRight = difference > 1;
+    const sf::Int32 up = rotateRight ? c : b;
+    const sf::Int32 stay = rotateRight ? b : c;
+    Node& nodeUp = m_nodes[up];
+    const sf::Int32 f = nodeUp.child1;
+    const sf::Int32 g = nodeUp.child2;
+
+    // `up` toma el lugar de `a` bajo el padre de `a`.
+    nodeUp.child1 = a;
+    nodeUp.parent = nodeA.parent;
+    nodeA.parent = up;
+    if (nodeUp.parent != NullNode) {
+        Node& parent = m_nodes[nodeUp.parent];
+        if (parent.child1 == a) {
+            parent.child1 = up;
+        }
+        else {
+            parent.child2 = up;
+        }
+    }
+    else {
+        m_root = up;
+    }
+
+    // El nieto más alto queda junto a `a` bajo `up`; el más bajo pasa a ser hijo de `a`.
+    const bool keepF = m_nodes[f].height > m_nodes[g].height;
+    const sf::Int32 kept = keepF ? f : g;
+    const sf::Int32 moved = keepF ? g : f;
+    nodeUp.child2 = kept;
+    if (rotateRight) {
+        nodeA.child2 = moved;
+    }
+    else {
+        nodeA.child1 = moved;
+    }
+    m_nodes[moved].parent = a;
+
+    nodeA.box = AABB::merge(m_nodes[stay].box, m_nodes[moved].box);
+    nodeA.height = 1 + std::max(m_nodes[stay].height, m_nodes[moved].height);
+    nodeUp.box = AABB::merge(nodeA.box, m_nodes[kept].box);
+    nodeUp.height = 1 + std::max(nodeA.height, m_nodes[kept].height);
+    return up;
+}
+
+/**
+ * @brief Caja gorda para una caja real y su desplazamiento.
+ *
+ * @param bounds Caja real.
+ * @param displacement Desplazamiento del tick.
+ * @return Caja ampliada.
+ */
+AABB AABBTree::fatten(const AABB& bounds, const sf::Vector2f& displacement) const {
+    AABB fat = bounds;
+    fat.min -= sf::Vector2f(m_margin, m_margin);
+    fat.max += sf::Vector2f(m_margin, m_margin);
+
+    // Se estira solo hacia donde va el objeto: los próximos ticks probablemente caigan dentro.
+    const sf::Vector2f predicted = displacement * m_displacementScale;
+    if (predicted.x < 0.0f) fat.min.x += predicted.x; else fat.max.x += predicted.x;
+    if (predicted.y < 0.0f) fat.min.y += predicted.y; else fat.max.y += predicted.y;
+    return fat;
+}
@@ -0,0 +1,284 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+
+/**
+ * @struct AABB
+ * @brief Caja alineada a los ejes, guardada por sus esquinas.
+ */
+struct AABB {
+    sf::Vector2f min;  ///< Esquina superior izquierda.
+    sf::Vector2f max;  ///< Esquina inferior derecha.
+
+    /**
+     * @brief Indica si dos cajas se tocan (bordes incluidos).
+     *
+     * @param other Otra caja.
+     * @return true si se superponen.
+     */
+    bool overlaps(const AABB& other) const {
+        return min.x <= other.max.x && other.min.x <= max.x &&
+               min.y <= other.max.y && other.min.y <= max.y;
+    }
+
+    /**
+     * @brief Indica si otra caja queda completamente dentro de esta.
+     *
+     * @param other Caja a probar.
+     * @return true si la contiene.
+     */
+    bool contains(const AABB& other) const {
+        return min.x <= other.min.x && min.y <= other.min.y &&
+               other.max.x <= max.x && other.max.y <= max.y;
+    }
+
+    /**
+     * @brief Perímetro de la caja: el costo de superficie (SAH) en 2D.
+     *
+     * @return Perímetro en píxeles.
+     */
+    float perimeter() const {
+        return 2.0f * ((max.x - min.x) + (max.y - min.y));
+    }
+
+    /**
+     * @brief Caja mínima que contiene a dos cajas.
+     *
+     * @param a Primera caja.
+     * @param b Segunda caja.
+     * @return Unión de ambas.
+     */
+    static AABB merge(const AABB& a, const AABB& b) {
+        return { sf::Vector2f(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y)),
+                 sf::Vector2f(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y)) };
+    }
+};
+
+/**
+ * @class AABBTree
+ * @brief Árbol dinámico de volúmenes envolventes para la fase amplia de colisiones.
+ *
+ * Cada hoja es un proxy con una caja "gorda": la caja real ampliada con un margen y
+ * estirada en la dirección del desplazamiento. Mientras la caja real siga dentro de la
+ * gorda, mover el objeto no toca el árbol; solo cuando se sale se reinserta la hoja y se
+ * reajustan sus ancestros. Los objetos que se mueven poco (o de forma predecible) casi
+ * nunca cambian la estructura.
+ *
+ * La inserción baja por el árbol eligiendo el hermano que menos aumenta el perímetro
+ * total (heurística de superficie) y al subir aplica rotaciones para mantener la altura
+ * acotada. Los nodos viven en un arreglo contiguo con lista libre, así que crear y
+ * destruir proxies no reserva memoria tras el crecimiento inicial.
+ */
+class AABBTree {
+public:
+    static constexpr sf::Int32 NullNode = -1;  ///< Índice de "sin nodo".
+
+    /**
+     * @brief Constructor.
+     *
+     * @param margin Holgura que se agrega a cada lado de las cajas gordas.
+     * @param displacementScale Cuántos ticks de desplazamiento se anticipan al estirar la caja.
+     */
+    explicit AABBTree(float margin = 4.0f, float displacementScale = 2.0f);
+
+    /**
+     * @brief Crea un proxy (hoja) para un objeto.
+     *
+     * @param bounds Caja real del objeto.
+     * @param userData Dato del llamador (normalmente el handle del objeto).
+     * @return Identificador del proxy.
+     */
+    sf::Int32 createProxy(const AABB& bounds, sf::Uint32 userData);
+
+    /**
+     * @brief Elimina un proxy.
+     *
+     * @param proxyId Identificador devuelto por `createProxy`.
+     */
+    void destroyProxy(sf::Int32 proxyId);
+
+    /**
+     * @brief Actualiza la caja de un proxy.
+     *
+     * @param proxyId Proxy a mover.
+     * @param bounds Nueva caja real.
+     * @param displacement Desplazamiento del objeto en el tick (para estirar la caja gorda).
+     * @return true si la hoja se reinsertó; false si la caja gorda aún la contenía.
+     */
+    bool moveProxy(sf::Int32 proxyId, const AABB& bounds, const sf::Vector2f& displacement);
+
+    /**
+     * @brief Recorre los proxies cuya caja gorda toca una caja.
+     *
+     * @param bounds Caja de la consulta.
+     * @param callback Se llama con el id de cada proxy; si devuelve false la consulta termina.
+     */
+    template<typename Callback>
+    void query(const AABB& bounds, Callback callback) const;
+
+    /**
+     * @brief Proxies en el orden en que aparecen en el árbol (recorrido en profundidad).
+     *
+     * Hojas consecutivas están cerca en el espacio: recorrerlas en este orden hace que
+     * consultas sucesivas visiten casi los mismos nodos, que ya están en caché.
+     *
+     * @param leaves Recibe los ids de los proxies (se vacía antes).
+     */
+    void getLeaves(std::vector<sf::Int32>& leaves) const;
+
+    /**
+     * @brief Caja gorda de un proxy.
+     *
+     * @param proxyId Proxy.
+     * @return Caja guardada en el árbol.
+     */
+    const AABB& getFatAABB(sf::Int32 proxyId) const { return m_nodes[proxyId].box; }
+
+    /**
+     * @brief Dato del llamador asociado a un proxy.
+     *
+     * @param proxyId Proxy.
+     * @return Valor pasado a `createProxy`.
+     */
+    sf::Uint32 getUserData(sf::Int32 proxyId) const { return m_nodes[proxyId].userData; }
+
+    /**
+     * @brief Altura del árbol (0 si está vacío o tiene una sola hoja).
+     *
+     * @return Niveles por debajo de la raíz.
+     */
+    sf::Int32 getHeight() const { return m_root == NullNode ? 0 : m_nodes[m_root].height; }
+
+    /**
+     * @brief Número de proxies vivos.
+     *
+     * @return Hojas del árbol.
+     */
+    std::size_t getProxyCount() const { return m_proxyCount; }
+
+    /**
+     * @brief Suma de los perímetros de los nodos internos (calidad del árbol: menos es mejor).
+     *
+     * @return Costo de superficie total.
+     */
+    float getTotalCost() const;
+
+    /**
+     * @brief Comprueba la estructura: enlaces, alturas y que cada caja contenga a sus hijos.
+     *
+     * @return true si el árbol es consistente.
+     */
+    bool validate() const;
+
+private:
+    /**
+     * @struct Node
+     * @brief Nodo del árbol: hoja (proxy) o nodo interno con dos hijos.
+     */
+    struct Node {
+        AABB box;                       ///< Caja gorda (hoja) o unión de los hijos (interno).
+        sf::Int32 parent = NullNode;    ///< Padre, o siguiente nodo libre si está en la lista libre.
+        sf::Int32 child1 = NullNode;    ///< Primer hijo (NullNode en las hojas).
+        sf::Int32 child2 = NullNode;    ///< Segundo hijo.
+        sf::Int32 height = -1;          ///< 0 en las hojas; -1 si el nodo está libre.
+        sf::Uint32 userData = 0;        ///< Dato del llamador (solo hojas).
+
+        /**
+         * @brief Indica si el nodo es una hoja.
+         */
+        bool isLeaf() const { return child1 == NullNode; }
+    };
+
+    /**
+     * @brief Toma un nodo de la lista libre (crece el arreglo si hace falta).
+     *
+     * @return Índice del nodo.
+     */
+    sf::Int32 allocateNode();
+
+    /**
+     * @brief Devuelve un nodo a la lista libre.
+     *
+     * @param node Índice del nodo.
+     */
+    void freeNode(sf::Int32 node);
+
+    /**
+     * @brief Inserta una hoja buscando el hermano más barato.
+     *
+     * @param leaf Hoja a insertar.
+     */
+    void insertLeaf(sf::Int32 leaf);
+
+    /**
+     * @brief Saca una hoja del árbol (sin liberarla).
+     *
+     * @param leaf Hoja a quitar.
+     */
+    void removeLeaf(sf::Int32 leaf);
+
+    /**
+     * @brief Recalcula caja y altura desde un nodo hasta la raíz, rotando donde haga falta.
+     *
+     * @param node Primer nodo a reajustar.
+     */
+    void refit(sf::Int32 node);
+
+    /**
+     * @brief Rota un nodo si sus subárboles difieren en altura más de uno.
+     *
+     * @param a Nodo a equilibrar.
+     * @return Nodo que queda en la posición de `a`.
+     */
+    sf::Int32 balance(sf::Int32 a);
+
+    /**
+     * @brief Caja gorda para una caja real y su desplazamiento.
+     *
+     * @param bounds Caja real.
+     * @param displacement Desplazamiento del tick.
+     * @return Caja ampliada.
+     */
+    AABB fatten(const AABB& bounds, const sf::Vector2f& displacement) const;
+
+    std::vector<Node> m_nodes;          ///< Todos los nodos (vivos y libres).
+    sf::Int32 m_root = NullNode;        ///< Raíz del árbol.
+    sf::Int32 m_freeList = NullNode;    ///< Primer nodo libre.
+    std::size_t m_proxyCount = 0;       ///< Hojas vivas.
+    float m_margin;                     ///< Holgura de las cajas gordas.
+    float m_displacementScale;          ///< Ticks de desplazamiento anticipados.
+};
+
+/**
+ * @brief Recorre los proxies cuya caja gorda toca una caja.
+ *
+ * Usa una pila por hilo que se reutiliza entre consultas, así que no reserva memoria en
+ * estado estable y varias consultas pueden correr en paralelo sobre el mismo árbol.
+ */
+template<typename Callback>
+void AABBTree::query(const AABB& bounds, Callback callback) const {
+    if (m_root == NullNode) {
+        return;
+    }
+
+    static thread_local std::vector<sf::Int32> stack;
+    const std::size_t base = stack.size();  // Permite consultas anidadas desde el callback.
+    stack.push_back(m_root);
+    while (stack.size() > base) {
+        sf::Int32 index = stack.back();
+        stack.pop_back();
+        const Node& node = m_nodes[index];
+        if (!node.box.overlaps(bounds)) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            if (!callback(index)) {
+                stack.resize(base);
+                return;
+            }
+        }
+        else {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+}
@@ -3,74 +3,109 @@
 
 /*
  * Actor.cpp
- * Implementacin de la clase `Actor`. Esta clase representa cualquier entidad grfica en el juego
- * que puede tener mltiples componentes como formas, transformaciones y comportamientos especficos.
- * Cada actor tiene la capacidad de actualizarse y renderizarse, as como almacenar y gestionar mltiples componentes.
- * Se ha agregado la clase `Transform` para manejar la posicin, rotacin y escala de los actores de manera eficiente.
+ * Implementación de la clase `Actor`. Esta clase representa cualquier entidad gráfica en el juego
+ * que puede tener múltiples componentes como formas, transformaciones y comportamientos específicos.
+ * Cada actor tiene la capacidad de actualizarse y renderizarse, así como almacenar y gestionar múltiples componentes.
+ * Se ha agregado la clase `Transform` para manejar la posición, rotación y escala de los actores de manera eficiente.
  */
 
- // Constructor que inicializa un actor con un nombre especfico.
- // Aqu se define el nombre del actor y se agregan componentes bsicos como `ShapeFactory` y `Transform`.
- // @param actorName Nombre del actor que ser utilizado para su identificacin.
+ // Constructor que inicializa un actor con un nombre específico.
+ // Aquí se define el nombre del actor y se agregan componentes básicos como `ShapeFactory` y `Transform`.
+ // @param actorName Nombre del actor que será utilizado para su identificación.
 Actor::Actor(std::string actorName)
 {
-    // Guardamos el nombre del actor para identificarlo fcilmente durante el desarrollo y la depuracin.
+    // Guardamos el nombre del actor para identificarlo fácilmente durante el desarrollo y la depuración.
     m_name = actorName;
 
-    // Creacin del componente `ShapeFactory` que se encargar de definir las formas geomtricas del actor.
+    // Creación del componente `ShapeFactory` que se encargará de definir las formas geométricas del actor.
     EngineUtilities::TSharedPointer<ShapeFactory> shape = EngineUtilities::MakeShared<ShapeFactory>();
-    addComponent(shape);  // Aadimos `ShapeFactory` a la lista de componentes del actor.
+    addComponent(shape);  // Añadimos `ShapeFactory` a la lista de componentes del actor.
 
-    // Creacin del componente `Transform` que gestiona la posicin, rotacin y escala del actor.
+    // Creación del componente `Transform` que gestiona la posición, rotación y escala del actor.
     // Este componente permite manipular las transformaciones espaciales del actor.
     EngineUtilities::TSharedPointer<Transform> transform = EngineUtilities::MakeShared<Transform>();
     addComponent(transform);  // Agregamos el componente `Transform` al actor para manejar sus transformaciones.
 
     // Actualmente, el actor solo tiene dos componentes: `ShapeFactory` y `Transform`.
     // En el futuro, se pueden agregar otros componentes como `Sprite`, `Physics`, `AudioSource`, etc.,
-    // para extender el comportamiento del actor segn sea necesario.
+    // para extender el comportamiento del actor según sea necesario.
 }
 
-// Funcin `update` que se llama en cada frame para actualizar la lgica interna del actor.
-// @param deltaTime El tiempo transcurrido desde la ltima actualizacin.
-// Este parmetro es til para realizar animaciones y clculos basados en tiempo real.
+// Función `update` que se llama en cada tick de simulación para actualizar la lógica interna del actor.
+// Debe llamarse al inicio del tick, antes de mover al actor: guarda la transformación actual
+// como la del tick anterior para poder interpolar al renderizar.
+// @param deltaTime Duración del tick (fija con el bucle de paso fijo).
 void Actor::update(float deltaTime)
+{
+    auto transform = getComponent<Transform>();
+    if (transform)
+    {
+        transform->savePreviousState();
+    }
+
+    // El resto de los componentes (por ejemplo, partículas) se actualizan por su cuenta.
+    for (unsigned int i = 0; i < components.size(); i++)
+    {
+        if (components[i]->getType() != ComponentType::SHAPE && components[i]->getType() != ComponentType::TRANSFORM)
+        {
+            components[i]->update(deltaTime);
+        }
+    }
+}
+
+// Coloca la forma en la transformación interpolada entre el tick anterior y el actual.
+// @param alpha Fracción de tick transcurrida desde el último tick simulado.
+void Actor::interpolate(float alpha)
 {
     // Obtener el componente de transformaciones y el de forma del actor
     auto transform = getComponent<Transform>();
     auto shape = getComponent<ShapeFactory>();
 
-    // Actualizar la posicin, rotacin y escala del actor si ambos componentes estn presentes
+    // Actualizar la posición, rotación y escala de la forma si ambos componentes están presentes
     if (transform && shape)
     {
-        shape->setPosition(transform->getPosition());   // Actualiza la posicin de la forma basada en el componente de Transform
-        shape->setRotation(transform->getRotation());   // Actualiza la rotacin de la forma
-        shape->setScale(transform->getScale());         // Actualiza la escala de la forma
+        shape->setPosition(transform->getInterpolatedPosition(alpha));
+        shape->setRotation(transform->getInterpolatedRotation(alpha));
+        shape->setScale(transform->getInterpolatedScale(alpha));
     }
 }
 
-// Renderiza todos los componentes grficos del actor en la ventana especificada.
-// @param window Referencia a la ventana donde se dibujarn los componentes grficos del actor.
+// Renderiza todos los componentes gráficos del actor en la ventana especificada.
+// @param window Referencia a la ventana donde se dibujarán los componentes gráficos del actor.
 void Actor::render(Window& window)
 {
-    // Recorremos todos los componentes asociados al actor y verificamos si son de tipo `ShapeFactory`.
-    // Si lo son, obtenemos la forma (`Shape`) y la dibujamos en la ventana.
+    // Cada componente decide cómo dibujarse: la forma usa su geometría (horneada o no),
+    // las partículas envían todos sus sprites en una sola llamada y `Transform` no dibuja nada.
     for (unsigned int i = 0; i < components.size(); i++)
     {
-        // `dynamic_pointer_cast` se usa para convertir de manera segura el componente a `ShapeFactory`.
-        // Si la conversin es exitosa, se dibuja la forma correspondiente.
-        if (components[i].dynamic_pointer_cast<ShapeFactory>())
-        {
-            window.draw(*components[i].dynamic_pointer_cast<ShapeFactory>()->getShape());
-        }
+        components[i]->render(window);
+    }
+}
+
+// Marca el actor como estático reenviando la bandera a su componente de forma.
+// @param isStatic true si la geometría debe hornearse una sola vez.
+void Actor::setStatic(bool isStatic)
+{
+    auto shape = getComponent<ShapeFactory>();
+    if (shape)
+    {
+        shape->setStatic(isStatic);
     }
 }
 
+// Indica si el actor está marcado como estático.
+// @return true si su componente de forma dibuja la geometría horneada.
+bool Actor::isStatic()
+{
+    auto shape = getComponent<ShapeFactory>();
+    return shape && shape->isStatic();
+}
+
 // Destruye el actor y libera todos los recursos asociados a sus componentes.
-// La liberacin de recursos es crucial para evitar fugas de memoria y mantener el rendimiento del juego.
-// En esta implementacin, la gestin de memoria se realiza de manera automtica gracias a los punteros inteligentes.
+// La liberación de recursos es crucial para evitar fugas de memoria y mantener el rendimiento del juego.
+// En esta implementación, la gestión de memoria se realiza de manera automática gracias a los punteros inteligentes.
 void Actor::destroy()
 {
-    // Esta funcin est preparada para liberar cualquier recurso adicional si es necesario.
+    // Esta función está preparada para liberar cualquier recurso adicional si es necesario.
     // Actualmente, no es necesario liberar manualmente los componentes porque se manejan con `TSharedPointer`.
 }
@@ -7,20 +7,20 @@
 /*
  * Actor.h
  * La clase `Actor` es una subclase de `Entity` que representa cualquier objeto del juego que tenga
- * un nombre y un conjunto de comportamientos especficos. Imagina que cada personaje, enemigo o
- * elemento del escenario es un "Actor" con su propio conjunto de componentes que definen cmo se ve,
- * cmo se mueve y qu hace en el juego.
+ * un nombre y un conjunto de comportamientos específicos. Imagina que cada personaje, enemigo o
+ * elemento del escenario es un "Actor" con su propio conjunto de componentes que definen cómo se ve,
+ * cómo se mueve y qué hace en el juego.
  *
- * Aqu puedes aadir componentes como formas geomtricas, fsicas, audio y ms, y la clase `Actor`
- * se encargar de gestionar cmo se actualizan y se dibujan en la pantalla.
+ * Aquí puedes añadir componentes como formas geométricas, físicas, audio y más, y la clase `Actor`
+ * se encargará de gestionar cómo se actualizan y se dibujan en la pantalla.
  */
 class Actor : public Entity
 {
 public:
-    // Constructor por defecto. Solo inicializa la clase sin configuraciones especficas.
+    // Constructor por defecto. Solo inicializa la clase sin configuraciones específicas.
     Actor() = default;
 
-    // Constructor con nombre. Crea un actor y le asigna un nombre especfico.
+    // Constructor con nombre. Crea un actor y le asigna un nombre específico.
     // @param actorName Nombre del actor (puede ser cualquier cadena de texto).
     Actor(std::string actorName);
 
@@ -28,46 +28,62 @@ public:
     ~Actor() = default;
 
     // Actualiza el actor cada frame.
-    // Aqu es donde se define la lgica de actualizacin, como mover el actor o gestionar su comportamiento.
-    // @param deltaTime El tiempo transcurrido desde la ltima actualizacin (til para animaciones y movimientos suaves).
+    // Aquí es donde se define la lógica de actualización, como mover el actor o gestionar su comportamiento.
+    // @param deltaTime El tiempo transcurrido desde la última actualización (útil para animaciones y movimientos suaves).
     void update(float deltaTime) override;
 
+    // Coloca la forma del actor entre su transformación del tick anterior y la actual.
+    // Se llama antes de `render` para que el movimiento se vea suave aunque la simulación
+    // avance a pasos fijos distintos a la frecuencia de pantalla.
+    // @param alpha Fracción de tick transcurrida desde el último tick simulado.
+    void interpolate(float alpha);
+
     // Renderiza el actor en la ventana dada.
-    // Se asegura de que todos los componentes grficos del actor se dibujen en la pantalla.
+    // Se asegura de que todos los componentes gráficos del actor se dibujen en la pantalla.
     // @param window La ventana donde se va a dibujar el actor.
     void render(Window& window) override;
 
     // Destruye el actor y libera todos los recursos asociados.
-    // Se debe llamar a esta funcin cuando el actor ya no es necesario en la escena.
+    // Se debe llamar a esta función cuando el actor ya no es necesario en la escena.
     void destroy();
 
-    // Obtiene un componente especfico del actor segn el tipo que buscamos.
-    // Si el actor tiene, por ejemplo, un componente de tipo `Shape`, esta funcin lo devuelve.
+    // Marca el actor como estático (por ejemplo, la pista).
+    // La geometría de un actor estático se hornea una vez en un buffer de vértices de la GPU
+    // y cada frame se dibuja con una sola llamada, en lugar de reconstruirse y reenviarse.
+    // @param isStatic true si el actor no se mueve ni cambia de aspecto.
+    void setStatic(bool isStatic);
+
+    // Indica si el actor está marcado como estático.
+    // @return true si la geometría del actor está horneada.
+    bool isStatic();
+
+    // Obtiene un componente específico del actor según el tipo que buscamos.
+    // Si el actor tiene, por ejemplo, un componente de tipo `Shape`, esta función lo devuelve.
     // @tparam T Tipo del componente que queremos obtener (debe derivar de `Component`).
     // @return Un puntero compartido al componente, o `nullptr` si no se encuentra.
     template <typename T>
     EngineUtilities::TSharedPointer<T> getComponent();
 
 private:
-    std::string m_name = "Actor";  // Nombre del actor (til para identificarlo en el juego).
+    std::string m_name = "Actor";  // Nombre del actor (útil para identificarlo en el juego).
 };
 
-// Implementacin del mtodo `getComponent()`.
-// Este mtodo recorre todos los componentes asociados al actor y busca uno que coincida con el tipo `T`.
-// Si encuentra el componente, lo devuelve. De lo contrario, devuelve un puntero vaco (`nullptr`).
+// Implementación del método `getComponent()`.
+// Este método recorre todos los componentes asociados al actor y busca uno que coincida con el tipo `T`.
+// Si encuentra el componente, lo devuelve. De lo contrario, devuelve un puntero vacío (`nullptr`).
 template<typename T>
 inline EngineUtilities::TSharedPointer<T> Actor::getComponent()
 {
     // Recorre todos los componentes del actor.
     for (auto& component : components)
     {
-        // Intenta convertir el componente al tipo especfico que buscamos.
+        // Intenta convertir el componente al tipo específico que buscamos.
         EngineUtilities::TSharedPointer<T> specificComponent = component.template dynamic_pointer_cast<T>();
         if (specificComponent)
         {
             return specificComponent;  // Si lo encuentra, lo devuelve.
         }
     }
-    // Devuelve un puntero vaco si no se encuentra un componente del tipo `T`.
+    // Devuelve un puntero vacío si no se encuentra un componente del tipo `T`.
     return EngineUtilities::TSharedPointer<T>();
 }
@@ -0,0 +1,85 @@
+#include "AppConfig.h"
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * @brief Construye la configuración a partir de los argumentos del programa.
+ *
+ * @param argc Número de argumentos.
+ * @param argv Argumentos del programa.
+ * @return Configuración resultante.
+ */
+AppConfig AppConfig::fromCommandLine(int argc, char** argv) {
+    AppConfig config;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (option == "--headless") {
+            config.headless = true;
+        }
+        else if (option == "--ticks" && hasValue) {
+            config.headlessTicks = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (option == "--tick-rate" && hasValue) {
+            float tickRate = std::strtof(argv[++i], nullptr);
+            if (tickRate > 0.0f) {
+                config.tickRate = tickRate;
+            }
+            else {
+                std::cerr << "AppConfig : frecuencia de ticks inválida, se mantiene " << config.tickRate << "\n";
+            }
+        }
+        else if (option == "--software") {
+            config.softwareRendering = true;
+        }
+        else if (option == "--no-render-thread") {
+            config.renderThread = false;
+        }
+        else if (option == "--pacing" && hasValue) {
+            std::string mode = argv[++i];
+            if (!FramePacer::fromString(mode, config.pacing)) {
+                std::cerr << "AppConfig : modo de ritmo '" << mode << "' desconocido, se esperaba vsync, limit o uncapped\n";
+            }
+        }
+        else if (option == "--fps" && hasValue) {
+            float frameRate = std::strtof(argv[++i], nullptr);
+            if (frameRate > 0.0f) {
+                config.targetFrameRate = frameRate;
+            }
+            else {
+                std::cerr << "AppConfig : frames por segundo inválidos, se mantienen " << config.targetFrameRate << "\n";
+            }
+        }
+        else if (option == "--trace" && hasValue) {
+            config.traceFile = argv[++i];
+        }
+        else if (option == "--trace-frames" && hasValue) {
+            unsigned long frames = std::strtoul(argv[++i], nullptr, 10);
+            if (frames > 0) {
+                config.traceFrames = static_cast<sf::Uint32>(frames);
+            }
+            else {
+                std::cerr << "AppConfig : número de frames de traza inválido, se mantiene " << config.traceFrames << "\n";
+            }
+        }
+        else if (option == "--record" && hasValue) {
+            config.inputRecordFile = argv[++i];
+        }
+        else if (option == "--replay" && hasValue) {
+            config.inputReplayFile = argv[++i];
+        }
+        else if (option == "--assets" && hasValue) {
+            config.assetsPath = argv[++i];
+            if (!config.assetsPath.empty() && config.assetsPath.back() != '/' && config.assetsPath.back() != '\\') {
+                config.assetsPath += '/';
+            }
+        }
+        else {
+            std::cerr << "AppConfig : se ignora la opción desconocida o incompleta '" << option << "'\n";
+        }
+    }
+
+    return config;
+}
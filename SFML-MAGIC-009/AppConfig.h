@@ -0,0 +1,48 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "FramePacer.h"     // Modos de ritmo de presentación.
+
+/**
+ * @struct AppConfig
+ * @brief Opciones de ejecución de la aplicación, normalmente leídas de la línea de comandos.
+ *
+ * Opciones reconocidas:
+ * - `--headless`: simula sin ventana, ImGui ni texturas, tan rápido como sea posible.
+ * - `--ticks N`: ticks a simular en modo headless.
+ * - `--tick-rate HZ`: ticks de simulación por segundo.
+ * - `--software`: rasteriza por CPU en lugar de OpenGL.
+ * - `--no-render-thread`: presenta los frames desde el hilo principal.
+ * - `--assets DIR`: carpeta con las texturas de la pista y los personajes (por defecto
+ *   `bin/MarioKart sprite-png/`, relativa a la raíz del repositorio).
+ * - `--pacing vsync|limit|uncapped`: cómo se espacian los frames presentados.
+ * - `--fps N`: frames por segundo del limitador (`--pacing limit`).
+ * - `--trace FILE`: guarda las zonas del perfilador en formato Chrome Trace Event JSON.
+ * - `--trace-frames N`: frames a capturar con `--trace`.
+ * - `--record FILE`: graba la entrada de cada tick para reproducirla después.
+ * - `--replay FILE`: alimenta los ticks con una grabación de `--record`.
+ */
+struct AppConfig {
+    bool headless = false;           ///< Ejecutar sin ventana.
+    sf::Uint64 headlessTicks = 3600; ///< Ticks a simular en modo headless.
+    float tickRate = 60.0f;          ///< Ticks de simulación por segundo.
+    bool softwareRendering = false;  ///< Rasterizar por CPU.
+    bool renderThread = true;        ///< Presentar desde un hilo de render dedicado.
+    FramePacingMode pacing = FramePacingMode::VSync;  ///< Ritmo de presentación.
+    float targetFrameRate = 60.0f;   ///< Objetivo del limitador de frames.
+    std::string traceFile;           ///< Archivo de traza (vacío = sin captura).
+    sf::Uint32 traceFrames = 300;    ///< Frames a capturar en la traza.
+    std::string inputRecordFile;     ///< Grabación de la entrada (vacío = no grabar).
+    std::string inputReplayFile;     ///< Entrada a reproducir (vacío = entrada real).
+    std::string assetsPath = "bin/MarioKart sprite-png/";  ///< Carpeta de texturas (relativa al directorio de trabajo).
+
+    /**
+     * @brief Construye la configuración a partir de los argumentos del programa.
+     *
+     * Las opciones desconocidas o mal formadas se reportan y se ignoran.
+     *
+     * @param argc Número de argumentos.
+     * @param argv Argumentos (el primero es el nombre del programa).
+     * @return Configuración resultante.
+     */
+    static AppConfig fromCommandLine(int argc, char** argv);
+};
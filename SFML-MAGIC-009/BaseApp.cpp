@@ -1,46 +1,151 @@
 #include "BaseApp.h"
+#include <iostream>
 
 /**
- * @brief Mtodo principal que ejecuta la aplicacin.
+ * @brief Constructor con opciones de ejecución.
  *
- * Este mtodo mantiene la aplicacin en un bucle continuo, manejando eventos,
- * actualizando la lgica del juego y renderizando los actores hasta que se cierre la ventana.
+ * @param config Opciones leídas de la línea de comandos.
+ */
+BaseApp::BaseApp(const AppConfig& config)
+    : m_config(config) {
+    m_timestep.setTickRate(config.tickRate);
+}
+
+/**
+ * @brief Método principal que ejecuta la aplicación.
  *
- * @return int Cdigo de salida (0 si la ejecucin fue exitosa).
+ * Este método mantiene la aplicación en un bucle continuo, manejando eventos,
+ * actualizando la lógica del juego y renderizando los actores hasta que se cierre la ventana.
+ *
+ * @return int Código de salida (0 si la ejecución fue exitosa).
  */
 int BaseApp::run() {
     if (!initialize()) {
         ERROR("BaseApp", "run", "Initialization failed. Check method validations.");
     }
+
+    PROFILE_THREAD("Principal");
+    if (!m_config.traceFile.empty()) {
+#if PROFILER_ENABLED
+        m_traceExporter.start(m_config.traceFile, m_config.traceFrames);
+#else
+        std::cerr << "BaseApp : se ignora --trace, compilado con PROFILER_ENABLED=0\n";
+#endif
+    }
+
+    if (!m_config.inputReplayFile.empty()) {
+        m_input.startReplay(m_config.inputReplayFile);
+    }
+    else if (!m_config.inputRecordFile.empty()) {
+        m_input.startRecording(m_config.inputRecordFile);
+    }
+
+    if (m_config.headless) {
+        return runHeadless();
+    }
+
     while (m_window->isOpen()) {
-        m_window->handleEvents();
-        update();
-        render();
+        {
+            PROFILE_SCOPE("Window::handleEvents");
+            m_window->handleEvents();
+            m_input.processEvents(m_window->getFrameEvents());
+        }
+        m_window->update();
+
+        // Simular a paso fijo lo que corresponde al tiempo real del frame y dibujar
+        // interpolando con la fracción de tick que quedó pendiente.
+        int ticks = m_timestep.advance(m_window->deltaTime.asSeconds());
+        for (int i = 0; i < ticks; ++i) {
+            update(m_timestep.getStepTime());
+        }
+        render(m_timestep.getAlpha());
+        m_hud.endFrame(*m_window);
+
+        PROFILE_FRAME();
     }
     cleanup();
     return 0;
 }
 
+/**
+ * @brief Ejecuta la simulación sin ventana.
+ *
+ * El reloj es simulado: cada iteración avanza exactamente un tick, sin esperar ni medir
+ * el tiempo real, así que la corrida es determinista y va tan rápido como permita la CPU.
+ *
+ * @return int Código de salida (0 si la ejecución fue exitosa).
+ */
+int BaseApp::runHeadless() {
+    const float step = m_timestep.getStepTime();
+    double simulatedTime = 0.0;
+
+    sf::Clock wallClock;
+    for (sf::Uint64 tick = 0; tick < m_config.headlessTicks; ++tick) {
+        update(step);
+        simulatedTime += step;
+        PROFILE_FRAME();
+    }
+    float wallSeconds = wallClock.getElapsedTime().asSeconds();
+
+    std::cout << "Headless: " << m_config.headlessTicks << " ticks (" << simulatedTime
+              << " s simulados) en " << wallSeconds << " s reales";
+    if (wallSeconds > 0.0f) {
+        std::cout << ", " << static_cast<double>(m_config.headlessTicks) / wallSeconds << " ticks/s";
+    }
+    std::cout << std::endl;
+
+    cleanup();
+    return 0;
+}
+
 /**
  * @brief Inicializa los recursos necesarios, como actores y texturas.
  *
  * Se encarga de crear la ventana, cargar las texturas del circuito y los personajes,
- * as como inicializar los actores con las transformaciones y texturas correspondientes.
+ * así como inicializar los actores con las transformaciones y texturas correspondientes.
+ * En modo headless no se crean la ventana ni las texturas: solo los actores.
  *
- * @return true Si la inicializacin fue exitosa, false si ocurri un error.
+ * @return true Si la inicialización fue exitosa, false si ocurrió un error.
  */
 bool BaseApp::initialize() {
-    // Crear la ventana principal.
-    m_window = new Window(800, 600, "SFML-MAGIC-009");
-    if (!m_window) {
-        ERROR("BaseApp", "initialize", "Error al crear la ventana.");
-        return false;
-    }
+    sf::Image circuitPixels;
+    if (!m_config.headless) {
+        // Crear la ventana principal.
+        m_window = new Window(800, 600, "SFML-MAGIC-009");
+        if (!m_window) {
+            ERROR("BaseApp", "initialize", "Error al crear la ventana.");
+            return false;
+        }
 
-    // Cargar la textura del circuito.
-    if (!texture.loadFromFile("C:/Users/kevin/OneDrive/Documentos/GitHub/SFML-MAGIC-009/bin/MarioKart sprite-png/Circuit.png")) {
-        std::cout << "Error al cargar la textura del circuito" << std::endl;
-        return false;
+        // El backend por software debe activarse antes de cargar texturas para registrarlas.
+        m_window->setSoftwareRendering(m_config.softwareRendering);
+        m_window->setFramePacing(m_config.pacing, m_config.targetFrameRate);
+
+        // Cargar la textura del circuito.
+        if (!loadTexture(texture, m_config.assetsPath + "Circuit.png", &circuitPixels)) {
+            std::cout << "Error al cargar la textura del circuito" << std::endl;
+            return false;
+        }
+
+        // Lista de personajes y sus rutas de textura.
+        std::vector<std::pair<EngineUtilities::TUniquePtr<sf::Texture>*, std::string>> characters = {
+            {&Mario, "tile000.png"}, {&Luigi, "tile001.png"},
+            {&Peach, "tile002.png"}, {&Toad, "tile003.png"},
+            {&Yoshi, "tile004.png"}, {&DonkeyKong, "tile005.png"},
+            {&Wario, "tile006.png"}
+        };
+
+        // Cargar texturas de los personajes.
+        for (const auto& [character, path] : characters) {
+            if (!loadTexture(*character, m_config.assetsPath + path)) {
+                std::cout << "Error al cargar la textura de " << path << std::endl;
+                return false;
+            }
+        }
+    }
+    else if (!circuitPixels.loadFromFile(m_config.assetsPath + "Circuit.png")) {
+        // Sin la imagen no hay máscara: la simulación sigue, pero sin distinguir el asfalto.
+        std::cout << "Circuit.png no disponible: se simula sin máscara de pista" << std::endl;
     }
 
     // Crear y configurar el Track (pista).
@@ -51,30 +156,17 @@ bool BaseApp::initialize() {
         trackTransform->setPosition(sf::Vector2f(0.0f, 0.0f));
         trackTransform->setRotation(0.0f);
         trackTransform->setScale(sf::Vector2f(11.0f, 12.0f));
-        Track->getComponent<ShapeFactory>()->getShape()->setTexture(&texture);
-    }
+        Track->getComponent<ShapeFactory>()->setTexture(texture.get());
 
-    // Funcin lambda para cargar y asignar texturas a personajes.
-    auto loadCharacter = [this](sf::Texture& texture, const std::string& path, const std::string& name) {
-        if (!texture.loadFromFile(path)) {
-            std::cout << "Error al cargar la textura de " << name << std::endl;
-            return false;
-        }
-        return true;
-        };
+        // La pista no se mueve: su geometría se hornea una vez en un buffer de la GPU.
+        Track->setStatic(true);
 
-    // Lista de personajes y sus rutas de textura.
-    std::vector<std::pair<sf::Texture*, std::string>> characters = {
-        {&Mario, "tile000.png"}, {&Luigi, "tile001.png"},
-        {&Peach, "tile002.png"}, {&Toad, "tile003.png"},
-        {&Yoshi, "tile004.png"}, {&DonkeyKong, "tile005.png"},
-        {&Wario, "tile006.png"}
-    };
-
-    // Cargar texturas de los personajes.
-    for (const auto& [texture, path] : characters) {
-        if (!loadCharacter(*texture, "C:/Users/kevin/OneDrive/Documentos/GitHub/SFML-MAGIC-009/bin/MarioKart sprite-png/" + path, path)) {
-            return false;
+        // Y la imagen del circuito, una vez en la máscara de asfalto: durante la carrera
+        // saber si un corredor está en la pista es leer un bit.
+        Collider trackCollider;
+        if (circuitPixels.getSize().x > 0 && Collider::fromActor(*Track, trackCollider)) {
+            const AABB bounds = trackCollider.getBounds();
+            m_trackMask.bake(circuitPixels, sf::FloatRect(bounds.min, bounds.max - bounds.min));
         }
     }
 
@@ -86,101 +178,267 @@ bool BaseApp::initialize() {
         circleTransform->setPosition(sf::Vector2f(200.0f, 200.0f));
         circleTransform->setRotation(0.0f);
         circleTransform->setScale(sf::Vector2f(1.0f, 1.0f));
-        Circle->getComponent<ShapeFactory>()->getShape()->setTexture(&Mario);
+        Circle->getComponent<ShapeFactory>()->setTexture(Mario.get());
+    }
+
+    // Una sola ruta inmutable para todos: cada corredor guarda solo su avance sobre ella.
+    m_racingPath = EngineUtilities::MakeShared<WaypointPath>(waypoints);
+    if (!Circle.isNull()) {
+        auto follower = EngineUtilities::MakeShared<PathFollower>(m_racingPath, m_circleSpeed);
+        follower->rejoin(Circle->getComponent<Transform>()->getPosition());
+        Circle->addComponent(follower);
+    }
+
+    // Karts de la IA: el resto de los personajes, repartidos a lo largo de una línea de
+    // carrera suave que pasa por los mismos waypoints.
+    m_racingLine = EngineUtilities::MakeShared<RacingLine>(waypoints);
+    std::vector<std::pair<EngineUtilities::TSharedPointer<Actor>*, sf::Texture*>> racers = {
+        {&LuigiHead, Luigi.get()}, {&PeachHead, Peach.get()}, {&ToadHead, Toad.get()},
+        {&YoshiHead, Yoshi.get()}, {&DonkeyKongHead, DonkeyKong.get()}, {&WarioHead, Wario.get()}
+    };
+    m_aiCrowd = EngineUtilities::MakeUnique<PathCrowd>(m_racingLine);
+    for (std::size_t i = 0; i < racers.size(); ++i) {
+        auto& [head, headTexture] = racers[i];
+        *head = EngineUtilities::MakeShared<Actor>("AIKart");
+        (*head)->getComponent<ShapeFactory>()->createShape(ShapeType::CIRCLE);
+        (*head)->getComponent<ShapeFactory>()->setTexture(headTexture);
+
+        float spacing = m_racingLine->getLength() / (racers.size() + 1);
+        std::size_t index = m_aiCrowd->addAgent(spacing * (i + 1), 120.0f + 10.0f * i);
+        auto headTransform = (*head)->getComponent<Transform>();
+        headTransform->setPosition(m_aiCrowd->getPosition(index));
+        headTransform->setScale(sf::Vector2f(1.0f, 1.0f));
+        m_aiKarts.push_back(*head);
+    }
+
+    // Los corredores chocan entre sí. Los karts de la IA siguen su línea sin desviarse
+    // (cinemáticos); el círculo rebota contra ellos y luego vuelve a la ruta.
+    if (!Circle.isNull()) {
+        m_physics.addActor(Circle, 1.0f, 0.6f);
+    }
+    for (auto& kart : m_aiKarts) {
+        m_physics.addActor(kart, 0.0f);
+    }
+
+    // Humo que deja el círculo al moverse: un solo sistema de partículas, una sola llamada de dibujo.
+    DriftSmoke = EngineUtilities::MakeShared<Actor>("DriftSmoke");
+    if (!DriftSmoke.isNull() && !Circle.isNull()) {
+        DriftSmoke->addComponent(EngineUtilities::MakeShared<ParticleSystem>(4096));
+        m_lastCirclePosition = Circle->getComponent<Transform>()->getPosition();
+    }
+
+    // Las posiciones iniciales no deben interpolarse desde el origen en el primer frame.
+    for (auto& actor : { Track, Circle }) {
+        if (!actor.isNull()) {
+            actor->getComponent<Transform>()->savePreviousState();
+        }
+    }
+    for (auto& kart : m_aiKarts) {
+        kart->getComponent<Transform>()->savePreviousState();
+    }
+
+    if (m_window != nullptr) {
+        // La interfaz se construye en el mismo hilo que presenta los frames.
+        m_window->setUICallback([this]() { renderUI(); });
+
+        // Con las texturas ya cargadas, el contexto de OpenGL pasa al hilo de render: la
+        // simulación del frame N+1 se solapa con el envío de comandos del frame N.
+        m_window->setRenderThreadEnabled(m_config.renderThread);
     }
 
     return true;
 }
 
 /**
- * @brief Actualiza la lgica del juego cada frame.
+ * @brief Simula un tick del juego.
+ *
+ * Este método maneja la actualización de los actores, la posición del ratón y el movimiento del círculo.
  *
- * Este mtodo maneja la actualizacin de los actores, la posicin del ratn y el movimiento del crculo.
+ * @param deltaTime Duración fija del tick en segundos.
  */
-void BaseApp::update() {
-    m_window->update();
+void BaseApp::update(float deltaTime) {
+    PROFILE_SCOPE("BaseApp::update");
 
-    sf::Vector2i mousePosition = sf::Mouse::getPosition(*m_window->getWindow());
-    sf::Vector2f mousePosF(static_cast<float>(mousePosition.x), static_cast<float>(mousePosition.y));
+    // El ratón sale del snapshot del tick, no de una consulta al sistema. Sin ventana (o
+    // con el ratón fuera de ella) el círculo solo sigue los waypoints, salvo que se esté
+    // reproduciendo una grabación.
+    const InputSnapshot input = m_input.consumeTick();
+    bool hasMouse = input.mouseInside;
+    sf::Vector2f mousePosF = input.mousePosition;
 
-    if (!Track.isNull()) Track->update(m_window->deltaTime.asSeconds());
-    if (!Triangle.isNull()) Triangle->update(m_window->deltaTime.asSeconds());
+    if (!Track.isNull()) Track->update(deltaTime);
+    if (!Triangle.isNull()) Triangle->update(deltaTime);
+
+    // Karts de la IA: una pasada por lotes sobre la línea de carrera compartida.
+    if (!m_aiCrowd.isNull()) {
+        for (auto& kart : m_aiKarts) {
+            kart->update(deltaTime);
+        }
+        m_aiCrowd->update(deltaTime);
+        for (std::size_t i = 0; i < m_aiKarts.size(); ++i) {
+            m_aiKarts[i]->getComponent<Transform>()->setPosition(m_aiCrowd->getPosition(i));
+        }
+    }
 
     if (!Circle.isNull()) {
-        Circle->update(m_window->deltaTime.asSeconds());
+        Circle->update(deltaTime);
 
+        // Fuera del asfalto el círculo va a la mitad de rapidez (la máscara se mira en su centro).
         sf::Vector2f currentPosition = Circle->getComponent<Transform>()->getPosition();
-        float mouseDistance = std::sqrt(
-            std::pow(mousePosF.x - currentPosition.x, 2) + std::pow(mousePosF.y - currentPosition.y, 2)
-        );
+        bool isOnRoad = m_trackMask.isEmpty() || m_trackMask.isDrivable(currentPosition + sf::Vector2f(10.0f, 10.0f));
+        float grip = isOnRoad ? 1.0f : 0.5f;
+        Circle->getComponent<PathFollower>()->setSpeed(m_circleSpeed * grip);
 
-        if (mouseDistance < 100.0f) {
+        // Comparar distancias al cuadrado: ni raíz ni std::pow para una prueba de radio.
+        sf::Vector2f toMouse = mousePosF - currentPosition;
+        float mouseDistanceSquared = toMouse.x * toMouse.x + toMouse.y * toMouse.y;
+
+        if (hasMouse && mouseDistanceSquared < 100.0f * 100.0f) {
             isFollowingMouse = true;
-            sf::Vector2f newPos = currentPosition + (mousePosF - currentPosition) * m_window->deltaTime.asSeconds();
+            sf::Vector2f newPos = currentPosition + (mousePosF - currentPosition) * (deltaTime * grip);
             Circle->getComponent<Transform>()->setPosition(newPos);
         }
         else {
+            if (isFollowingMouse) {
+                // Al soltarlo, retoma la ruta desde el punto más cercano y no desde donde
+                // habría llegado mientras seguía al ratón.
+                Circle->getComponent<PathFollower>()->rejoin(currentPosition);
+            }
             isFollowingMouse = false;
-            updateMovement(m_window->deltaTime.asSeconds(), Circle);
+            updateMovement(deltaTime, Circle);
+        }
+
+        // El emisor sigue al centro del círculo y lanza el humo en sentido contrario al avance.
+        if (!DriftSmoke.isNull()) {
+            sf::Vector2f position = Circle->getComponent<Transform>()->getPosition();
+            sf::Vector2f motion = position - m_lastCirclePosition;
+            m_lastCirclePosition = position;
+
+            auto smoke = DriftSmoke->getComponent<ParticleSystem>();
+            bool isMoving = motion.x != 0.0f || motion.y != 0.0f;
+            smoke->setEmitter(position + sf::Vector2f(10.0f, 10.0f), -motion);
+            smoke->setEmissionRate(isMoving ? 120.0f : 0.0f);
+            DriftSmoke->update(deltaTime);
         }
     }
+
+    // Con todos los corredores en su posición del tick, se resuelven los choques.
+    m_physics.step(deltaTime);
 }
 
 /**
- * @brief Renderiza los actores y la interfaz grfica de ImGui.
+ * @brief Renderiza los actores y la interfaz gráfica de ImGui.
+ *
+ * @param alpha Fracción de tick transcurrida desde el último tick simulado.
  */
-void BaseApp::render() {
+void BaseApp::render(float alpha) {
+    PROFILE_SCOPE("BaseApp::render");
+
+    // Colocar las formas entre el tick anterior y el actual.
+    if (!Track.isNull()) Track->interpolate(alpha);
+    if (!Circle.isNull()) Circle->interpolate(alpha);
+    if (!Triangle.isNull()) Triangle->interpolate(alpha);
+    for (auto& kart : m_aiKarts) kart->interpolate(alpha);
+
     m_window->clear();
 
     if (!Track.isNull()) Track->render(*m_window);
+    if (!DriftSmoke.isNull()) DriftSmoke->render(*m_window);
+    for (auto& kart : m_aiKarts) kart->render(*m_window);
     if (!Circle.isNull()) Circle->render(*m_window);
     if (!Triangle.isNull()) Triangle->render(*m_window);
 
-    ImGui::Begin("Hello, world!");
-    ImGui::Text("This is a simple example.");
-    ImGui::End();
-
     m_window->render();
     m_window->display();
 }
 
 /**
- * @brief Libera los recursos utilizados por la aplicacin.
+ * @brief Construye la interfaz de ImGui.
+ */
+void BaseApp::renderUI() {
+    m_hud.draw(*m_window, m_input);
+
+#if PROFILER_ENABLED
+    Profiler::getInstance().drawImGui();
+#endif
+}
+
+/**
+ * @brief Carga una textura desde un archivo pasando por una `sf::Image`.
+ *
+ * @param texture Textura a crear.
+ * @param path Ruta del archivo de imagen.
+ * @param pixels Si no es nulo, recibe una copia de la imagen.
+ * @return true si la textura se cargó correctamente.
+ */
+bool BaseApp::loadTexture(EngineUtilities::TUniquePtr<sf::Texture>& texture, const std::string& path,
+                          sf::Image* pixels) {
+    sf::Image image;
+    if (!image.loadFromFile(path)) {
+        return false;
+    }
+
+    texture.reset(new sf::Texture());
+    if (!texture->loadFromImage(image)) {
+        texture.reset();
+        return false;
+    }
+
+    // El rasterizador por software no puede leer la textura de la GPU: se le dan los píxeles.
+    if (m_window->isSoftwareRendering()) {
+        m_window->getSoftwareRasterizer()->registerTexture(texture.get(), image);
+    }
+    if (pixels != nullptr) {
+        *pixels = image;
+    }
+    return true;
+}
+
+/**
+ * @brief Libera los recursos utilizados por la aplicación.
  *
- * Este mtodo destruye la ventana y libera la memoria asignada.
+ * Este método destruye la ventana y libera la memoria asignada.
  */
 void BaseApp::cleanup() {
-    m_window->destroy();
-    delete m_window;
+#if PROFILER_ENABLED
+    // Cierra la traza aunque no se hayan alcanzado los frames pedidos.
+    m_traceExporter.stop();
+#endif
+    m_input.stop();
+
+    if (m_window != nullptr) {
+        // Reporte final del ritmo de presentación logrado.
+        FramePacer::Stats stats = m_window->getFrameStats();
+        if (stats.samples > 0) {
+            std::cout << "Ritmo de frames (" << FramePacer::toString(stats.mode) << "): "
+                      << stats.averageMs << " ms medio, p99 " << stats.p99Ms
+                      << " ms, jitter " << stats.jitterMs << " ms" << std::endl;
+        }
+
+        m_window->destroy();
+        delete m_window;
+        m_window = nullptr;
+    }
 }
 
 /**
- * @brief Controla el movimiento del crculo entre puntos predefinidos.
+ * @brief Coloca un actor sobre la ruta que recorre su `PathFollower`.
  *
- * Si el crculo no sigue al ratn, se mueve automticamente entre waypoints.
+ * Si el círculo no sigue al ratón, avanza por la ruta de waypoints a rapidez constante.
  *
- * @param deltaTime Tiempo transcurrido desde el ltimo frame.
- * @param circle Actor del crculo a mover.
+ * @param deltaTime Duración del tick de simulación.
+ * @param circle Actor a mover (sin `PathFollower` no hace nada).
  */
 void BaseApp::updateMovement(float deltaTime, EngineUtilities::TSharedPointer<Actor> circle) {
     if (circle.isNull()) return;
 
-    auto transform = circle->getComponent<Transform>();
-    sf::Vector2f currentPos = transform->getPosition();
-    sf::Vector2f targetPos = waypoints[currentWaypoint];
-
-    sf::Vector2f direction = targetPos - currentPos;
-    float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
-
-    if (distance > 0.0f) direction /= distance;
+    auto follower = circle->getComponent<PathFollower>();
+    if (follower.isNull()) return;
 
-    float speed = 150.0f;  // Velocidad del crculo.
-    sf::Vector2f newPos = currentPos + direction * speed * deltaTime;
-
-    if (distance < 10.0f) {
-        currentWaypoint = (currentWaypoint + 1) % waypoints.size();
-    }
-    else {
-        transform->setPosition(newPos);
+    // Sobre la ruta se copia la posición del seguidor; fuera de ella, Seek hacia él.
+    auto transform = circle->getComponent<Transform>();
+    sf::Vector2f onPath = follower->getPosition();
+    if (!transform->Seek(onPath, follower->getSpeed() * 2.0f, deltaTime, 10.0f)) {
+        transform->setPosition(onPath);
     }
 }
@@ -1,25 +1,44 @@
 #pragma once
 #include "Prerequisites.h"  // Importa las dependencias necesarias.
 #include "Window.h"  // Maneja la ventana principal donde se renderiza el contenido.
-#include "ShapeFactory.h"  // Provee utilidades para crear formas geomtricas.
-#include "Actor.h"  // Define los actores que se dibujarn en pantalla.
+#include "ShapeFactory.h"  // Provee utilidades para crear formas geométricas.
+#include "Actor.h"  // Define los actores que se dibujarán en pantalla.
+#include "ParticleSystem.h"  // Partículas de humo detrás de los karts.
+#include "FixedTimestep.h"  // Acumulador para simular a paso fijo.
+#include "AppConfig.h"  // Opciones de ejecución (headless, backend de render, etc.).
+#include "Profiler.h"  // Zonas de perfilado de CPU.
+#include "TraceExporter.h"  // Exportación de zonas a Chrome Trace Event JSON.
+#include "PerformanceHUD.h"  // Estadísticas de rendimiento en ImGui.
+#include "InputSystem.h"  // Entrada por lotes, snapshots por tick y grabación.
+#include "PathFollower.h"  // Recorrido de la ruta de waypoints (círculo y karts de la IA).
+#include "PhysicsComponent.h"  // Choques entre los corredores.
+#include "TrackMask.h"  // Asfalto / fuera de pista horneado del circuito.
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
 
 /**
  * @class BaseApp
- * @brief Clase principal que controla el flujo de la aplicacin.
+ * @brief Clase principal que controla el flujo de la aplicación.
  *
- * Esta clase gestiona la ventana, los actores (como el tringulo, crculo y pista),
- * y contiene la lgica para la actualizacin, renderizado, movimiento y liberacin de recursos.
+ * Esta clase gestiona la ventana, los actores (como el triángulo, círculo y pista),
+ * y contiene la lógica para la actualización, renderizado, movimiento y liberación de recursos.
  */
 class BaseApp {
 public:
     /**
      * @brief Constructor por defecto.
      *
-     * No realiza ninguna inicializacin adicional en este caso.
+     * No realiza ninguna inicialización adicional en este caso.
      */
     BaseApp() = default;
 
+    /**
+     * @brief Constructor con opciones de ejecución.
+     *
+     * @param config Opciones leídas de la línea de comandos.
+     */
+    explicit BaseApp(const AppConfig& config);
+
     /**
      * @brief Destructor por defecto.
      *
@@ -28,59 +47,101 @@ public:
     ~BaseApp() = default;
 
     /**
-     * @brief Ejecuta la aplicacin desde la funcin principal.
+     * @brief Ejecuta la aplicación desde la función principal.
      *
-     * Llama a las funciones de inicializacin, actualizacin por frame, renderizado
-     * y liberacin de recursos al final de la ejecucin.
-     * @return int Cdigo de salida (0 si todo sali bien).
+     * Llama a las funciones de inicialización, actualización por frame, renderizado
+     * y liberación de recursos al final de la ejecución.
+     * @return int Código de salida (0 si todo salió bien).
      */
     int run();
 
     /**
-     * @brief Inicializa los recursos necesarios para la aplicacin.
+     * @brief Ejecuta la simulación sin ventana.
+     *
+     * Simula `AppConfig::headlessTicks` ticks con un reloj simulado, tan rápido como sea
+     * posible, y reporta el rendimiento obtenido. No crea ventana ni ImGui ni texturas.
+     *
+     * @return int Código de salida (0 si todo salió bien).
+     */
+    int runHeadless();
+
+    /**
+     * @brief Inicializa los recursos necesarios para la aplicación.
      *
      * Crea la ventana principal y los actores, estableciendo sus posiciones iniciales.
-     * @return true Si la inicializacin fue exitosa, false en caso de error.
+     * @return true Si la inicialización fue exitosa, false en caso de error.
      */
     bool initialize();
 
     /**
-     * @brief Actualiza la lgica de la aplicacin en cada frame.
+     * @brief Simula un tick de la aplicación.
      *
-     * Se encarga de gestionar el movimiento de los actores, el seguimiento del ratn,
-     * y cualquier otra actualizacin requerida por frame.
+     * Se encarga de gestionar el movimiento de los actores, el seguimiento del ratón,
+     * y cualquier otra actualización de la simulación. Se llama cero o más veces por
+     * frame con una duración fija, de modo que el resultado no depende de los FPS.
+     *
+     * @param deltaTime Duración fija del tick en segundos.
      */
-    void update();
+    void update(float deltaTime);
 
     /**
      * @brief Renderiza los actores en la ventana.
      *
-     * Dibuja los actores en la pantalla en cada frame despus de la actualizacin.
+     * Dibuja los actores en la pantalla en cada frame, interpolados entre el último
+     * tick simulado y el anterior.
+     *
+     * @param alpha Fracción de tick transcurrida desde el último tick simulado.
      */
-    void render();
+    void render(float alpha);
 
     /**
-     * @brief Libera los recursos utilizados por la aplicacin.
+     * @brief Construye la interfaz de ImGui del frame.
      *
-     * Se encarga de limpiar la memoria y liberar los recursos al cerrar la aplicacin.
+     * La ventana la llama entre la actualización y el render de ImGui; con el hilo de
+     * render activo se ejecuta en ese hilo.
+     */
+    void renderUI();
+
+    /**
+     * @brief Libera los recursos utilizados por la aplicación.
+     *
+     * Se encarga de limpiar la memoria y liberar los recursos al cerrar la aplicación.
      */
     void cleanup();
 
     /**
-     * @brief Actualiza el movimiento del crculo entre waypoints.
+     * @brief Coloca un actor sobre la ruta que recorre su `PathFollower`.
      *
-     * Si el ratn no est cerca, el crculo se mover automticamente entre los waypoints.
+     * El `PathFollower` ya avanzó en `Actor::update`. Si el actor está a menos de 10 píxeles
+     * de su punto de la ruta, se coloca en él; si se desvió (por ejemplo, siguiendo al
+     * ratón), vuelve hacia la ruta al doble de la rapidez del seguidor.
      * @param deltaTime Tiempo entre frames utilizado para calcular el movimiento.
-     * @param circle Puntero inteligente al actor del crculo.
+     * @param circle Puntero inteligente al actor (sin `PathFollower` no hace nada).
      */
     void updateMovement(float deltaTime, EngineUtilities::TSharedPointer<Actor> circle);
 
 private:
-    Window* m_window;  ///< Puntero a la ventana principal de la aplicacin.
+    /**
+     * @brief Carga una textura desde un archivo pasando por una `sf::Image`.
+     *
+     * Si el backend de render por software está activo, también registra los píxeles
+     * para que el rasterizador pueda muestrear la textura.
+     *
+     * @param texture Textura a crear.
+     * @param path Ruta del archivo de imagen.
+     * @param pixels Si no es nulo, recibe una copia de la imagen (para hornear datos de ella).
+     * @return true si la textura se cargó correctamente.
+     */
+    bool loadTexture(EngineUtilities::TUniquePtr<sf::Texture>& texture, const std::string& path,
+                     sf::Image* pixels = nullptr);
+
+    AppConfig m_config;           ///< Opciones de ejecución.
+    Window* m_window = nullptr;   ///< Puntero a la ventana principal (nulo en modo headless).
 
-    EngineUtilities::TSharedPointer<Actor> Triangle;  ///< Actor que representa el tringulo.
-    EngineUtilities::TSharedPointer<Actor> Circle;    ///< Actor que representa el crculo.
+    EngineUtilities::TSharedPointer<Actor> Triangle;  ///< Actor que representa el triángulo.
+    EngineUtilities::TSharedPointer<Actor> Circle;    ///< Actor que representa el círculo.
     EngineUtilities::TSharedPointer<Actor> Track;     ///< Actor que representa la pista.
+    EngineUtilities::TSharedPointer<Actor> DriftSmoke;  ///< Actor con el humo que deja el círculo.
 
     // Actores para las cabezas de los personajes.
     EngineUtilities::TSharedPointer<Actor> MarioHead;
@@ -91,23 +152,39 @@ private:
     EngineUtilities::TSharedPointer<Actor> DonkeyKongHead;
     EngineUtilities::TSharedPointer<Actor> WarioHead;
 
-    // Texturas para los personajes.
-    sf::Texture texture;    ///< Textura para la pista.
-    sf::Texture Mario;      ///< Textura para Mario.
-    sf::Texture Luigi;      ///< Textura para Luigi.
-    sf::Texture Peach;      ///< Textura para Peach.
-    sf::Texture Toad;       ///< Textura para Toad.
-    sf::Texture Yoshi;      ///< Textura para Yoshi.
-    sf::Texture DonkeyKong; ///< Textura para DonkeyKong.
-    sf::Texture Wario;      ///< Textura para Wario.
+    // Texturas para los personajes. Se crean al cargarlas: construir una `sf::Texture`
+    // requiere un contexto de OpenGL, que no existe en modo headless.
+    EngineUtilities::TUniquePtr<sf::Texture> texture;    ///< Textura para la pista.
+    EngineUtilities::TUniquePtr<sf::Texture> Mario;      ///< Textura para Mario.
+    EngineUtilities::TUniquePtr<sf::Texture> Luigi;      ///< Textura para Luigi.
+    EngineUtilities::TUniquePtr<sf::Texture> Peach;      ///< Textura para Peach.
+    EngineUtilities::TUniquePtr<sf::Texture> Toad;       ///< Textura para Toad.
+    EngineUtilities::TUniquePtr<sf::Texture> Yoshi;      ///< Textura para Yoshi.
+    EngineUtilities::TUniquePtr<sf::Texture> DonkeyKong; ///< Textura para DonkeyKong.
+    EngineUtilities::TUniquePtr<sf::Texture> Wario;      ///< Textura para Wario.
+
+    FixedTimestep m_timestep{ 60.0f, 5 };  ///< Simulación a paso fijo, máximo 5 ticks por frame.
+    PerformanceHUD m_hud;  ///< Ventana de estadísticas de rendimiento.
+    InputSystem m_input;  ///< Entrada de cada tick (real, grabada o reproducida).
+#if PROFILER_ENABLED
+    TraceExporter m_traceExporter;  ///< Captura de zonas a disco (`--trace`).
+#endif
+
+    sf::Vector2f m_lastCirclePosition;  ///< Posición del círculo en el frame anterior (para orientar el humo).
 
-    int currentWaypoint = 0;  ///< ndice del waypoint actual en la trayectoria del crculo.
-    bool isFollowingMouse = false;  ///< Indica si el crculo est siguiendo al ratn.
+    EngineUtilities::TSharedPointer<WaypointPath> m_racingPath;  ///< Ruta compartida por el círculo y los karts de la IA.
+    EngineUtilities::TSharedPointer<RacingLine> m_racingLine;    ///< Versión suave de la ruta que siguen los karts de la IA.
+    EngineUtilities::TUniquePtr<PathCrowd> m_aiCrowd;            ///< Avance de los karts de la IA sobre la línea de carrera.
+    std::vector<EngineUtilities::TSharedPointer<Actor>> m_aiKarts;  ///< Actor de cada kart de la IA (mismo orden que `m_aiCrowd`).
+    PhysicsWorld m_physics;  ///< Choques del círculo contra los karts de la IA.
+    TrackMask m_trackMask;   ///< Asfalto del circuito (vacía si no se pudo leer Circuit.png).
+    float m_circleSpeed = 150.0f;  ///< Rapidez del círculo sobre el asfalto (la mitad fuera de pista).
+    bool isFollowingMouse = false;  ///< Indica si el círculo está siguiendo al ratón.
 
     /**
-     * @brief Lista de waypoints que el crculo seguir.
+     * @brief Lista de waypoints que el círculo seguirá.
      *
-     * Cada waypoint es un `sf::Vector2f` que representa una posicin en la ventana.
+     * Cada waypoint es un `sf::Vector2f` que representa una posición en la ventana.
      */
     std::vector<sf::Vector2f> waypoints = {
         {720.0f, 350.0f}, {720.0f, 260.0f}, {125.0f, 50.0f},
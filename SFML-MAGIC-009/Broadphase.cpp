@@ -0,0 +1,168 @@
+#include "Broadphase.h"
+#include "Profiler.h"
+#include <SFML/Graphics/Transform.hpp>
+#include <iostream>
+
+namespace {
+/**
+ * @brief Centro de una caja.
+ */
+sf::Vector2f centerOf(const AABB& box) {
+    return (box.min + box.max) * 0.5f;
+}
+}
+
+/**
+ * @brief Caja alineada a los ejes que envuelve la forma.
+ *
+ * @return Límites de la forma.
+ */
+AABB Collider::getBounds() const {
+    sf::Vector2f extents(radius, radius);
+    if (type == ColliderType::Box) {
+        const float radians = rotation * 3.14159265f / 180.0f;
+        const float c = std::abs(std::cos(radians));
+        const float s = std::abs(std::sin(radians));
+        extents = sf::Vector2f(c * halfExtents.x + s * halfExtents.y, s * halfExtents.x + c * halfExtents.y);
+    }
+    return { center - extents, center + extents };
+}
+
+/**
+ * @brief Forma de colisión de un actor según el tipo de su `ShapeFactory`.
+ *
+ * @param actor Actor con `Transform` y `ShapeFactory`.
+ * @param collider Recibe la forma.
+ * @return false si el actor no tiene forma o transformación.
+ */
+bool Collider::fromActor(Actor& actor, Collider& collider) {
+    auto transform = actor.getComponent<Transform>();
+    auto shape = actor.getComponent<ShapeFactory>();
+    if (!transform || !shape || shape->getTemplate().isNull()) {
+        return false;
+    }
+
+    // Misma composición que `sf::Transformable` (origen en la esquina de la forma).
+    const sf::Vector2f& scale = transform->getScale();
+    sf::Transform world;
+    world.translate(transform->getPosition()).rotate(transform->getRotation()).scale(scale);
+
+    const sf::FloatRect& local = shape->getTemplate()->getLocalBounds();
+    const sf::Vector2f size(local.width * std::abs(scale.x), local.height * std::abs(scale.y));
+    collider.center = world.transformPoint(local.left + local.width * 0.5f, local.top + local.height * 0.5f);
+    collider.rotation = transform->getRotation();
+
+    if (shape->getShapeType() == ShapeType::CIRCLE) {
+        collider.type = ColliderType::Circle;
+        collider.radius = 0.5f * std::max(size.x, size.y);
+        collider.halfExtents = sf::Vector2f(collider.radius, collider.radius);
+    }
+    else {
+        collider.type = ColliderType::Box;
+        collider.halfExtents = size * 0.5f;
+        collider.radius = std::sqrt(collider.halfExtents.x * collider.halfExtents.x +
+                                    collider.halfExtents.y * collider.halfExtents.y);
+    }
+    return true;
+}
+
+/**
+ * @brief Constructor.
+ *
+ * @param margin Holgura de las cajas gordas del árbol.
+ */
+Broadphase::Broadphase(float margin)
+    : m_tree(margin) {
+}
+
+/**
+ * @brief Agrega un cuerpo con una caja dada.
+ *
+ * @param bounds Caja inicial.
+ * @return Handle del cuerpo.
+ */
+sf::Uint32 Broadphase::addBody(const AABB& bounds) {
+    const sf::Uint32 handle = static_cast<sf::Uint32>(m_bounds.size());
+    m_proxies.push_back(m_tree.createProxy(bounds, handle));
+    m_bounds.push_back(bounds);
+    m_displacements.emplace_back(0.0f, 0.0f);
+    m_colliders.emplace_back();
+    m_actors.emplace_back();
+    return handle;
+}
+
+/**
+ * @brief Agrega un actor; su caja se recalcula en cada `update`.
+ *
+ * @param actor Actor con `Transform` y `ShapeFactory`.
+ * @return Handle del cuerpo.
+ */
+sf::Uint32 Broadphase::addActor(EngineUtilities::TSharedPointer<Actor> actor) {
+    Collider collider;
+    if (actor.isNull() || !Collider::fromActor(*actor, collider)) {
+        std::cerr << "Broadphase : el actor no tiene forma ni transformación; se agrega sin caja.\n";
+    }
+    sf::Uint32 handle = addBody(collider.getBounds());
+    m_colliders[handle] = collider;
+    m_actors[handle] = actor;
+    return handle;
+}
+
+/**
+ * @brief Cambia la caja de un cuerpo suelto.
+ *
+ * @param handle Cuerpo.
+ * @param bounds Caja nueva.
+ */
+void Broadphase::setBounds(sf::Uint32 handle, const AABB& bounds) {
+    m_displacements[handle] += centerOf(bounds) - centerOf(m_bounds[handle]);
+    m_bounds[handle] = bounds;
+}
+
+/**
+ * @brief Recalcula las cajas de los actores y los pares del tick.
+ *
+ * Mover un proxy que sigue dentro de su caja gorda es una sola prueba de contención. La
+ * consulta usa la caja real y cada par se guarda una sola vez (desde el cuerpo de menor
+ * handle), así que no hace falta eliminar duplicados.
+ */
+void Broadphase::update() {
+    PROFILE_SCOPE("Broadphase::update");
+
+    const std::size_t count = m_bounds.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!m_actors[i].isNull() && Collider::fromActor(*m_actors[i], m_colliders[i])) {
+            setBounds(static_cast<sf::Uint32>(i), m_colliders[i].getBounds());
+        }
+    }
+
+    m_reinserted = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (m_tree.moveProxy(m_proxies[i], m_bounds[i], m_displacements[i])) {
+            ++m_reinserted;
+        }
+        m_displacements[i] = sf::Vector2f(0.0f, 0.0f);
+    }
+
+    // Las consultas siguen el orden de las hojas en el árbol y no el de los handles:
+    // cuerpos vecinos en el espacio recorren los mismos nodos, que siguen en caché.
+    m_tree.getLeaves(m_order);
+    m_pairs.clear();
+    for (sf::Int32 leaf : m_order) {
+        const sf::Uint32 self = m_tree.getUserData(leaf);
+        const AABB& box = m_bounds[self];
+        m_tree.query(box, [&](sf::Int32 proxy) {
+            const sf::Uint32 other = m_tree.getUserData(proxy);
+            if (other != self && box.overlaps(m_bounds[other])) {
+                // Cada par aparece desde sus dos cuerpos; se guarda solo desde el menor.
+                if (self < other) {
+                    m_pairs.push_back({ self, other });
+                }
+            }
+            return true;
+        });
+    }
+    std::sort(m_pairs.begin(), m_pairs.end(), [](const BroadphasePair& a, const BroadphasePair& b) {
+        return a.first != b.first ? a.first < b.first : a.second < b.second;
+    });
+}
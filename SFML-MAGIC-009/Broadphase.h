@@ -0,0 +1,162 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "AABBTree.h"       // Árbol dinámico de cajas.
+#include "Actor.h"          // Actores cuya forma define su caja.
+
+/**
+ * @enum ColliderType
+ * @brief Forma de colisión de un actor.
+ */
+enum class ColliderType {
+    Circle,  ///< Círculo (formas `CIRCLE`).
+    Box      ///< Caja orientada (formas `RECTANGLE` y `TRIANGLE`).
+};
+
+/**
+ * @struct Collider
+ * @brief Forma de colisión en coordenadas del mundo.
+ */
+struct Collider {
+    ColliderType type = ColliderType::Circle;  ///< Forma.
+    sf::Vector2f center;                       ///< Centro en el mundo.
+    float radius = 0.0f;                       ///< Radio (círculos).
+    sf::Vector2f halfExtents;                  ///< Mitad del ancho y del alto (cajas).
+    float rotation = 0.0f;                     ///< Giro de la caja en grados.
+
+    /**
+     * @brief Caja alineada a los ejes que envuelve la forma.
+     *
+     * @return Límites de la forma.
+     */
+    AABB getBounds() const;
+
+    /**
+     * @brief Forma de colisión de un actor según el tipo de su `ShapeFactory`.
+     *
+     * Los círculos conservan su radio; rectángulos y triángulos se aproximan con la caja
+     * de su geometría local, orientada con el giro del actor. La forma se toma del estado
+     * simulado (`Transform`), no del interpolado que se dibuja.
+     *
+     * @param actor Actor con `Transform` y `ShapeFactory`.
+     * @param collider Recibe la forma.
+     * @return false si el actor no tiene forma o transformación.
+     */
+    static bool fromActor(Actor& actor, Collider& collider);
+};
+
+/**
+ * @struct BroadphasePair
+ * @brief Par de cuerpos cuyas cajas se superponen (`first < second`).
+ */
+struct BroadphasePair {
+    sf::Uint32 first;   ///< Handle del primer cuerpo.
+    sf::Uint32 second;  ///< Handle del segundo cuerpo.
+};
+
+/**
+ * @class Broadphase
+ * @brief Fase amplia de colisiones: pares de cuerpos cuyas cajas se tocan en cada tick.
+ *
+ * Cada cuerpo es un proxy de un `AABBTree`. `update` mueve los proxies (el árbol solo
+ * cambia para los que salieron de su caja gorda), consulta el árbol con la caja real de
+ * cada cuerpo y confirma los candidatos contra sus cajas reales. El costo es O(n log n) en
+ * lugar de las n²/2 pruebas de comparar todos contra todos.
+ *
+ * Los cuerpos pueden ser cajas sueltas (`addBody`/`setBounds`) o actores (`addActor`),
+ * cuya caja se deriva de su forma en cada `update`.
+ */
+class Broadphase {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param margin Holgura de las cajas gordas del árbol.
+     */
+    explicit Broadphase(float margin = 4.0f);
+
+    /**
+     * @brief Agrega un cuerpo con una caja dada.
+     *
+     * @param bounds Caja inicial.
+     * @return Handle del cuerpo (índice consecutivo).
+     */
+    sf::Uint32 addBody(const AABB& bounds);
+
+    /**
+     * @brief Agrega un actor; su caja se recalcula en cada `update`.
+     *
+     * @param actor Actor con `Transform` y `ShapeFactory`.
+     * @return Handle del cuerpo.
+     */
+    sf::Uint32 addActor(EngineUtilities::TSharedPointer<Actor> actor);
+
+    /**
+     * @brief Cambia la caja de un cuerpo suelto.
+     *
+     * El árbol se actualiza en el siguiente `update`.
+     *
+     * @param handle Cuerpo.
+     * @param bounds Caja nueva (el desplazamiento se deduce de la anterior).
+     */
+    void setBounds(sf::Uint32 handle, const AABB& bounds);
+
+    /**
+     * @brief Recalcula las cajas de los actores y los pares del tick.
+     */
+    void update();
+
+    /**
+     * @brief Pares del último `update`, ordenados por `first` y luego `second`.
+     *
+     * @return Pares de cuerpos cuyas cajas se superponen.
+     */
+    const std::vector<BroadphasePair>& getPairs() const { return m_pairs; }
+
+    /**
+     * @brief Caja actual de un cuerpo.
+     *
+     * @param handle Cuerpo.
+     * @return Caja real (no la gorda del árbol).
+     */
+    const AABB& getBounds(sf::Uint32 handle) const { return m_bounds[handle]; }
+
+    /**
+     * @brief Forma de colisión de un cuerpo que es un actor.
+     *
+     * @param handle Cuerpo.
+     * @return Forma calculada en el último `update` (círculo vacío si es un cuerpo suelto).
+     */
+    const Collider& getCollider(sf::Uint32 handle) const { return m_colliders[handle]; }
+
+    /**
+     * @brief Número de cuerpos.
+     *
+     * @return Cuerpos registrados.
+     */
+    std::size_t size() const { return m_bounds.size(); }
+
+    /**
+     * @brief Hojas reinsertadas en el último `update` (las demás no tocaron el árbol).
+     *
+     * @return Proxies que salieron de su caja gorda.
+     */
+    std::size_t getReinsertedCount() const { return m_reinserted; }
+
+    /**
+     * @brief Árbol subyacente (para estadísticas y depuración).
+     *
+     * @return Árbol de la fase amplia.
+     */
+    const AABBTree& getTree() const { return m_tree; }
+
+private:
+    AABBTree m_tree;                        ///< Árbol dinámico con un proxy por cuerpo.
+    std::vector<sf::Int32> m_proxies;       ///< Proxy de cada cuerpo.
+    std::vector<AABB> m_bounds;             ///< Caja real de cada cuerpo.
+    std::vector<sf::Vector2f> m_displacements;  ///< Desplazamiento acumulado desde el último `update`.
+    std::vector<Collider> m_colliders;      ///< Forma de cada cuerpo (solo actores).
+    std::vector<EngineUtilities::TSharedPointer<Actor>> m_actors;  ///< Actor de cada cuerpo (nulo en los sueltos).
+    std::vector<sf::Int32> m_order;         ///< Proxies en orden del árbol (temporal de `update`).
+    std::vector<BroadphasePair> m_pairs;    ///< Pares del último tick.
+    std::size_t m_reinserted = 0;           ///< Reinserciones del último tick.
+};
@@ -0,0 +1,2 @@
+// Unidad que genera el encabezado precompilado en Visual Studio (/Yc"EnginePCH.h").
+#include "EnginePCH.h"
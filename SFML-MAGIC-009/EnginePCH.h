@@ -0,0 +1,36 @@
+#pragma once
+/**
+ * @file EnginePCH.h
+ * @brief Encabezado precompilado del motor y de los ejecutables que lo enlazan.
+ *
+ * Agrupa las dependencias pesadas y estables (biblioteca estándar, SFML e ImGui) para
+ * que se compilen una sola vez. El build lo fuerza en cada unidad de traducción
+ * (`target_precompile_headers` en CMake, `/Yu` + `/FI` en Visual Studio), así que el
+ * código no debe incluirlo directamente: cada archivo sigue incluyendo lo que usa y
+ * compila igual sin encabezado precompilado.
+ */
+
+// Librerías estándar (STD)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Librerías externas (Third Parties)
+#include <SFML/Graphics.hpp>
+#include "../Include/IMGUI/imgui.h"
+#include "../Include/IMGUI/imgui-SFML.h"
@@ -1,35 +1,50 @@
 #pragma once
 #include "Prerequisites.h"
 #include "Component.h"
+#include <atomic>
 
-// Declaracin anticipada de la clase Window para evitar problemas de dependencias circulares.
+// Declaración anticipada de la clase Window para evitar problemas de dependencias circulares.
 class Window;
 
 /*
  * Entity.h
  * La clase `Entity` es como el esqueleto de todos los objetos del juego (personajes, enemigos, etc.).
  * Imagina a una entidad como un contenedor que puede tener varias "partes" o "componentes",
- * como movimiento, apariencia, sonido, etc. Este archivo define la estructura bsica
+ * como movimiento, apariencia, sonido, etc. Este archivo define la estructura básica
  * de cualquier entidad que quieras crear en el juego.
  */
 class Entity
 {
 public:
+    // Constructor: cuenta la entidad como viva (para el HUD de rendimiento).
+    Entity() { s_liveCount.fetch_add(1, std::memory_order_relaxed); }
+
+    // Constructor de copia: la copia también es una entidad viva.
+    Entity(const Entity& other)
+        : isActived(other.isActived), id(other.id), components(other.components) {
+        s_liveCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Entity& operator=(const Entity& other) = default;
+
     // Destructor virtual para asegurarse de que cualquier recurso de las subclases se limpie correctamente.
-    virtual ~Entity() = default;
+    virtual ~Entity() { s_liveCount.fetch_sub(1, std::memory_order_relaxed); }
+
+    // Número de entidades vivas en este momento (se puede leer desde cualquier hilo).
+    static std::size_t getLiveCount() { return s_liveCount.load(std::memory_order_relaxed); }
 
     // Actualiza la entidad en cada frame. 
-    // Es un mtodo virtual puro, lo que significa que cada entidad debe definir cmo se actualiza.
-    // @param deltaTime El tiempo transcurrido desde la ltima actualizacin (para animaciones y lgica).
+    // Es un método virtual puro, lo que significa que cada entidad debe definir cómo se actualiza.
+    // @param deltaTime El tiempo transcurrido desde la última actualización (para animaciones y lógica).
     virtual void update(float deltaTime) = 0;
 
     // Dibuja la entidad en la pantalla.
-    // Este mtodo es abstracto y cada entidad debe implementar cmo se quiere renderizar.
-    // @param window La ventana donde se dibujar la entidad.
+    // Este método es abstracto y cada entidad debe implementar cómo se quiere renderizar.
+    // @param window La ventana donde se dibujará la entidad.
     virtual void render(Window& window) = 0;
 
     // Agrega un nuevo componente a la entidad.
-    // Los componentes son como las "partes" de la entidad que definen cmo se comporta (fsica, grficos, etc.)
+    // Los componentes son como las "partes" de la entidad que definen cómo se comporta (física, gráficos, etc.)
     // @tparam T Tipo de componente que queremos agregar (debe derivar de `Component`).
     // @param component Puntero compartido al componente que se quiere agregar.
     template<typename T>
@@ -41,8 +56,8 @@ public:
         components.push_back(component.template dynamic_pointer_cast<Component>());
     }
 
-    // Obtiene un componente especfico de la entidad segn el tipo que buscamos.
-    // Esto es til cuando queremos interactuar con un componente en particular, como un `PhysicsComponent`.
+    // Obtiene un componente específico de la entidad según el tipo que buscamos.
+    // Esto es útil cuando queremos interactuar con un componente en particular, como un `PhysicsComponent`.
     // @tparam T El tipo de componente que queremos obtener.
     // @return Un puntero compartido al componente, o `nullptr` si no se encuentra.
     template<typename T>
@@ -51,21 +66,24 @@ public:
         // Recorremos todos los componentes asociados a la entidad.
         for (auto& component : components)
         {
-            // Intentamos convertir cada componente al tipo especfico que buscamos.
+            // Intentamos convertir cada componente al tipo específico que buscamos.
             EngineUtilities::TSharedPointer<T> specificComponent = component.template dynamic_pointer_cast<T>();
             if (specificComponent)
             {
                 return specificComponent;  // Si lo encontramos, lo devolvemos.
             }
         }
-        // Si no se encuentra, devolvemos un puntero vaco.
+        // Si no se encuentra, devolvemos un puntero vacío.
         return EngineUtilities::TSharedPointer<T>();
     }
 
 protected:
-    bool isActived;  // Indica si la entidad est activa o no (puede ser til para habilitar/deshabilitar entidades).
-    int id;  // Identificador nico de la entidad (til para identificarla en el juego).
+    bool isActived;  // Indica si la entidad está activa o no (puede ser útil para habilitar/deshabilitar entidades).
+    int id;  // Identificador único de la entidad (útil para identificarla en el juego).
 
     // Vector que almacena todos los componentes asociados a esta entidad.
     std::vector<EngineUtilities::TSharedPointer<Component>> components;
+
+private:
+    static inline std::atomic<std::size_t> s_liveCount{ 0 };  // Entidades creadas y aún no destruidas.
 };
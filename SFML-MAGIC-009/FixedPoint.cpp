@@ -0,0 +1,236 @@
+#include "FixedPoint.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGIC_FIXED_X86 1
+#include <immintrin.h>
+#else
+#define MAGIC_FIXED_X86 0
+#endif
+
+// Igual que en SteeringKernels.cpp: GCC y Clang solo aceptan intrínsecos AVX2 en funciones
+// marcadas para ese conjunto.
+#if MAGIC_FIXED_X86 && (defined(__GNUC__) || defined(__clang__))
+#define MAGIC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MAGIC_TARGET_AVX2
+#endif
+
+/**
+ * @brief Raíz cuadrada entera exacta: el mayor `r` con `r * r <= value`.
+ *
+ * @param value Radicando.
+ * @return Parte entera de la raíz.
+ */
+sf::Uint64 Fixed16::isqrt(sf::Uint64 value) {
+    // La raíz en doble precisión queda a lo sumo a una unidad del valor exacto; la
+    // corrección con productos enteros fija el resultado sin depender del redondeo.
+    sf::Uint64 result = static_cast<sf::Uint64>(std::sqrt(static_cast<double>(value)));
+    result = std::min<sf::Uint64>(result, 0xFFFFFFFFu);
+    while (result * result > value) --result;
+    while (result < 0xFFFFFFFFu && (result + 1) * (result + 1) <= value) ++result;
+    return result;
+}
+
+namespace {
+/**
+ * @brief División entera redondeada hacia menos infinito (el divisor debe ser positivo).
+ */
+sf::Int64 floorDivide(sf::Int64 numerator, sf::Int64 divisor) {
+    sf::Int64 quotient = numerator / divisor;
+    if (numerator % divisor != 0 && numerator < 0) --quotient;
+    return quotient;
+}
+}
+
+/**
+ * @brief Paso de seek en punto fijo sobre valores crudos.
+ *
+ * @param positionX Posición X cruda (se actualiza).
+ * @param positionY Posición Y cruda (se actualiza).
+ * @param targetX Objetivo X crudo.
+ * @param targetY Objetivo Y crudo.
+ * @param speed Velocidad cruda en píxeles por segundo.
+ * @param range Radio de parada crudo.
+ * @param deltaTime Duración cruda del paso en segundos.
+ * @param velocityX Velocidad X cruda calculada (cero si no se mueve).
+ * @param velocityY Velocidad Y cruda calculada (cero si no se mueve).
+ * @return false si ya estaba dentro del rango o sobre el objetivo (no se movió).
+ */
+bool fixedSeekStep(sf::Int32& positionX, sf::Int32& positionY, sf::Int32 targetX, sf::Int32 targetY,
+                   sf::Int32 speed, sf::Int32 range, sf::Int32 deltaTime,
+                   sf::Int32& velocityX, sf::Int32& velocityY) {
+    sf::Int64 dx = static_cast<sf::Int64>(targetX) - positionX;
+    sf::Int64 dy = static_cast<sf::Int64>(targetY) - positionY;
+    sf::Int64 distance = static_cast<sf::Int64>(Fixed16::isqrt(static_cast<sf::Uint64>(dx * dx + dy * dy)));
+    if (distance == 0 || distance < range) {
+        velocityX = 0;
+        velocityY = 0;
+        return false;
+    }
+
+    // Dirección por velocidad en una sola división: delta * speed / distance.
+    velocityX = static_cast<sf::Int32>(floorDivide(dx * speed, distance));
+    velocityY = static_cast<sf::Int32>(floorDivide(dy * speed, distance));
+    positionX += static_cast<sf::Int32>((static_cast<sf::Int64>(velocityX) * deltaTime) >> Fixed16::kFractionBits);
+    positionY += static_cast<sf::Int32>((static_cast<sf::Int64>(velocityY) * deltaTime) >> Fixed16::kFractionBits);
+    return true;
+}
+
+/**
+ * @brief Cambia el número de agentes (los nuevos quedan en el origen y quietos).
+ *
+ * @param count Número de agentes.
+ */
+void FixedSteeringAgents::resize(std::size_t count) {
+    positionX.resize(count, 0);
+    positionY.resize(count, 0);
+    velocityX.resize(count, 0);
+    velocityY.resize(count, 0);
+    targetX.resize(count, 0);
+    targetY.resize(count, 0);
+}
+
+namespace {
+/**
+ * @brief Paso escalar de un rango de agentes; también procesa la cola de la ruta AVX2.
+ */
+void seekFixedScalar(FixedSteeringAgents& agents, std::size_t begin, std::size_t end,
+                     sf::Int32 speed, sf::Int32 range, sf::Int32 deltaTime) {
+    for (std::size_t i = begin; i < end; ++i) {
+        fixedSeekStep(agents.positionX[i], agents.positionY[i], agents.targetX[i], agents.targetY[i],
+                      speed, range, deltaTime, agents.velocityX[i], agents.velocityY[i]);
+    }
+}
+
+#if MAGIC_FIXED_X86
+/**
+ * @brief Junta la mitad baja de cada carril de 64 bits en 4 enteros de 32 bits.
+ */
+MAGIC_TARGET_AVX2
+inline __m128i packLow32(__m256i value) {
+    const __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(value, lowHalves));
+}
+
+/**
+ * @brief Corrige una estimación `q` (a ±1 del valor exacto) hasta `floor(numerator / divisor)`.
+ *
+ * Todo en carriles de 64 bits; `q` y `divisor` caben en 32 bits con signo.
+ */
+MAGIC_TARGET_AVX2
+inline __m256i fixFloorQuotient(__m256i quotient, __m256i numerator, __m256i divisor) {
+    const __m256i one = _mm256_set1_epi64x(1);
+    __m256i product = _mm256_mul_epi32(quotient, divisor);
+    __m256i tooBig = _mm256_cmpgt_epi64(product, numerator);
+    // (q + 1) * d <= n  <=>  n > q * d + d - 1.
+    __m256i tooSmall = _mm256_cmpgt_epi64(numerator, _mm256_sub_epi64(_mm256_add_epi64(product, divisor), one));
+    // Las máscaras valen -1: sumar una resta 1 y restar la otra suma 1.
+    return _mm256_sub_epi64(_mm256_add_epi64(quotient, tooBig), tooSmall);
+}
+
+/**
+ * @brief Paso AVX2: 4 agentes por iteración. Devuelve el primer agente no procesado.
+ *
+ * La raíz y los cocientes se estiman en doble precisión (error muy por debajo de una
+ * unidad) y se corrigen con productos enteros exactos, de modo que cada carril termina con
+ * los mismos bits que `fixedSeekStep`.
+ */
+MAGIC_TARGET_AVX2
+std::size_t seekFixedAVX2(FixedSteeringAgents& agents, std::size_t begin, std::size_t end,
+                          sf::Int32 speed, sf::Int32 range, sf::Int32 deltaTime) {
+    sf::Int32* px = agents.positionX.data();
+    sf::Int32* py = agents.positionY.data();
+    sf::Int32* vx = agents.velocityX.data();
+    sf::Int32* vy = agents.velocityY.data();
+    const sf::Int32* tx = agents.targetX.data();
+    const sf::Int32* ty = agents.targetY.data();
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i speedLanes = _mm256_set1_epi64x(speed);
+    const __m256i rangeLanes = _mm256_set1_epi64x(range);
+    const __m256i dtLanes = _mm256_set1_epi64x(deltaTime);
+    const __m256d speedD = _mm256_set1_pd(static_cast<double>(speed));
+
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(px + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(py + i));
+        __m128i dx32 = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tx + i)), x);
+        __m128i dy32 = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ty + i)), y);
+        __m256i dx = _mm256_cvtepi32_epi64(dx32);
+        __m256i dy = _mm256_cvtepi32_epi64(dy32);
+        __m256d dxD = _mm256_cvtepi32_pd(dx32);
+        __m256d dyD = _mm256_cvtepi32_pd(dy32);
+
+        // Distancia: r = trunc(sqrt) y corrección a ±1 con r² y (r + 1)² exactos.
+        __m256i squared = _mm256_add_epi64(_mm256_mul_epi32(dx, dx), _mm256_mul_epi32(dy, dy));
+        __m256d squaredD = _mm256_add_pd(_mm256_mul_pd(dxD, dxD), _mm256_mul_pd(dyD, dyD));
+        __m256i distance = _mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(_mm256_sqrt_pd(squaredD)));
+        __m256i distanceSquared = _mm256_mul_epi32(distance, distance);
+        __m256i tooBig = _mm256_cmpgt_epi64(distanceSquared, squared);
+        // (r + 1)² <= s  <=>  s > r² + 2r.
+        __m256i tooSmall = _mm256_cmpgt_epi64(squared, _mm256_add_epi64(distanceSquared, _mm256_add_epi64(distance, distance)));
+        distance = _mm256_sub_epi64(_mm256_add_epi64(distance, tooBig), tooSmall);
+
+        // Se mueve si distance > 0 y distance >= range; el resto divide entre 1 y queda en cero.
+        __m256i moving = _mm256_andnot_si256(_mm256_cmpgt_epi64(rangeLanes, distance), _mm256_cmpgt_epi64(distance, zero));
+        __m256i divisor = _mm256_blendv_epi8(one, distance, moving);
+        __m256d divisorD = _mm256_cvtepi32_pd(packLow32(divisor));
+
+        __m256d estimateX = _mm256_floor_pd(_mm256_div_pd(_mm256_mul_pd(dxD, speedD), divisorD));
+        __m256d estimateY = _mm256_floor_pd(_mm256_div_pd(_mm256_mul_pd(dyD, speedD), divisorD));
+        __m256i velX = fixFloorQuotient(_mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(estimateX)),
+                                        _mm256_mul_epi32(dx, speedLanes), divisor);
+        __m256i velY = fixFloorQuotient(_mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(estimateY)),
+                                        _mm256_mul_epi32(dy, speedLanes), divisor);
+        velX = _mm256_and_si256(velX, moving);
+        velY = _mm256_and_si256(velY, moving);
+
+        // (vel * dt) >> 16: el desplazamiento cabe en 32 bits, así que los 32 bits bajos del
+        // desplazamiento lógico coinciden con los del aritmético.
+        __m128i moveX = packLow32(_mm256_srli_epi64(_mm256_mul_epi32(velX, dtLanes), Fixed16::kFractionBits));
+        __m128i moveY = packLow32(_mm256_srli_epi64(_mm256_mul_epi32(velY, dtLanes), Fixed16::kFractionBits));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(vx + i), packLow32(velX));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(vy + i), packLow32(velY));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(px + i), _mm_add_epi32(x, moveX));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(py + i), _mm_add_epi32(y, moveY));
+    }
+    return i;
+}
+#endif
+}
+
+/**
+ * @brief Avanza un paso todos los agentes con la mejor ruta disponible.
+ *
+ * @param agents Agentes a actualizar.
+ * @param speed Velocidad en píxeles por segundo.
+ * @param range Radio de parada.
+ * @param deltaTime Duración del paso en segundos.
+ */
+void FixedSteering::update(FixedSteeringAgents& agents, Fixed16 speed, Fixed16 range, Fixed16 deltaTime) {
+    update(agents, speed, range, deltaTime, Steering::bestSimdLevel());
+}
+
+/**
+ * @brief Avanza un paso todos los agentes con una ruta concreta.
+ *
+ * @param agents Agentes a actualizar.
+ * @param speed Velocidad en píxeles por segundo.
+ * @param range Radio de parada.
+ * @param deltaTime Duración del paso en segundos.
+ * @param level Ruta a usar.
+ */
+void FixedSteering::update(FixedSteeringAgents& agents, Fixed16 speed, Fixed16 range, Fixed16 deltaTime,
+                           SimdLevel level) {
+    level = std::min(level, Steering::bestSimdLevel());
+    std::size_t next = 0;
+#if MAGIC_FIXED_X86
+    if (level == SimdLevel::AVX2) {
+        next = seekFixedAVX2(agents, next, agents.size(), speed.raw(), range.raw(), deltaTime.raw());
+    }
+#endif
+    seekFixedScalar(agents, next, agents.size(), speed.raw(), range.raw(), deltaTime.raw());
+}
@@ -0,0 +1,332 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "SteeringKernels.h"
+
+/**
+ * @class Fixed16
+ * @brief Número en punto fijo Q16.16: 16 bits de parte entera y 16 de fracción sobre un `sf::Int32`.
+ *
+ * Todos los resultados están definidos con aritmética entera (la raíz solo estima en
+ * doble precisión y se corrige hasta el valor exacto), así que son los mismos bit a bit con
+ * cualquier compilador, nivel de optimización o CPU (sin contracción a FMA, sin x87 y sin
+ * reordenar sumas). Es la base del modo determinista para repeticiones y lockstep.
+ *
+ * El rango es ±32768 con una resolución de 1/65536. El producto redondea hacia menos
+ * infinito y el cociente trunca hacia cero; ninguna operación comprueba desbordamientos.
+ */
+class Fixed16 {
+public:
+    static constexpr int kFractionBits = 16;            ///< Bits de la parte fraccionaria.
+    static constexpr sf::Int32 kOne = 1 << kFractionBits;  ///< Valor crudo de 1.0.
+
+    /**
+     * @brief Construye el cero.
+     */
+    constexpr Fixed16() = default;
+
+    /**
+     * @brief Construye a partir del valor crudo (ya escalado por 65536).
+     *
+     * @param raw Valor crudo.
+     * @return Número en punto fijo.
+     */
+    static constexpr Fixed16 fromRaw(sf::Int32 raw) {
+        Fixed16 value;
+        value.m_raw = raw;
+        return value;
+    }
+
+    /**
+     * @brief Convierte un entero.
+     *
+     * @param value Entero dentro de ±32767.
+     * @return Número en punto fijo.
+     */
+    static constexpr Fixed16 fromInt(int value) { return fromRaw(value * kOne); }
+
+    /**
+     * @brief Convierte un flotante redondeando al crudo más cercano.
+     *
+     * Multiplicar por 65536 en doble precisión es exacto y `std::lround` no depende del
+     * modo de redondeo, así que la conversión también es determinista.
+     *
+     * @param value Valor en flotante.
+     * @return Número en punto fijo.
+     */
+    static Fixed16 fromFloat(float value) {
+        return fromRaw(static_cast<sf::Int32>(std::lround(static_cast<double>(value) * kOne)));
+    }
+
+    /**
+     * @brief Valor crudo (escalado por 65536).
+     *
+     * @return Valor crudo.
+     */
+    constexpr sf::Int32 raw() const { return m_raw; }
+
+    /**
+     * @brief Convierte a flotante (solo para presentar; la simulación sigue en punto fijo).
+     *
+     * @return Valor aproximado en flotante.
+     */
+    float toFloat() const { return static_cast<float>(static_cast<double>(m_raw) / kOne); }
+
+    /**
+     * @brief Raíz cuadrada entera exacta: el mayor `r` con `r * r <= value`.
+     *
+     * Estima con `std::sqrt` en doble precisión y corrige con productos enteros, así que
+     * el resultado es exacto aunque la estimación cambie de una compilación a otra.
+     *
+     * @param value Radicando.
+     * @return Parte entera de la raíz.
+     */
+    static sf::Uint64 isqrt(sf::Uint64 value);
+
+    /**
+     * @brief Raíz cuadrada (redondea hacia abajo al crudo anterior).
+     *
+     * @return Raíz del valor; cero si el valor es negativo.
+     */
+    Fixed16 sqrt() const {
+        if (m_raw <= 0) return Fixed16();
+        // sqrt(raw / 2^16) * 2^16 = sqrt(raw * 2^16).
+        return fromRaw(static_cast<sf::Int32>(isqrt(static_cast<sf::Uint64>(m_raw) << kFractionBits)));
+    }
+
+    Fixed16 operator-() const { return fromRaw(-m_raw); }
+    Fixed16 operator+(Fixed16 other) const { return fromRaw(m_raw + other.m_raw); }
+    Fixed16 operator-(Fixed16 other) const { return fromRaw(m_raw - other.m_raw); }
+    Fixed16 operator*(Fixed16 other) const {
+        // Producto de 64 bits y desplazamiento aritmético: redondea hacia menos infinito.
+        return fromRaw(static_cast<sf::Int32>((static_cast<sf::Int64>(m_raw) * other.m_raw) >> kFractionBits));
+    }
+    Fixed16 operator/(Fixed16 other) const {
+        return fromRaw(static_cast<sf::Int32>(static_cast<sf::Int64>(m_raw) * kOne / other.m_raw));
+    }
+    Fixed16& operator+=(Fixed16 other) { m_raw += other.m_raw; return *this; }
+    Fixed16& operator-=(Fixed16 other) { m_raw -= other.m_raw; return *this; }
+    Fixed16& operator*=(Fixed16 other) { return *this = *this * other; }
+    Fixed16& operator/=(Fixed16 other) { return *this = *this / other; }
+
+    bool operator==(Fixed16 other) const { return m_raw == other.m_raw; }
+    bool operator!=(Fixed16 other) const { return m_raw != other.m_raw; }
+    bool operator<(Fixed16 other) const { return m_raw < other.m_raw; }
+    bool operator<=(Fixed16 other) const { return m_raw <= other.m_raw; }
+    bool operator>(Fixed16 other) const { return m_raw > other.m_raw; }
+    bool operator>=(Fixed16 other) const { return m_raw >= other.m_raw; }
+
+private:
+    sf::Int32 m_raw = 0;  ///< Valor escalado por 65536.
+};
+
+/**
+ * @struct FixedVector2
+ * @brief Vector 2D en Q16.16, equivalente determinista de `sf::Vector2f`.
+ */
+struct FixedVector2 {
+    Fixed16 x;  ///< Componente X.
+    Fixed16 y;  ///< Componente Y.
+
+    FixedVector2() = default;
+    FixedVector2(Fixed16 x, Fixed16 y) : x(x), y(y) {}
+
+    /**
+     * @brief Convierte un vector flotante (ver `Fixed16::fromFloat`).
+     *
+     * @param value Vector en flotante.
+     * @return Vector en punto fijo.
+     */
+    static FixedVector2 fromVector2f(const sf::Vector2f& value) {
+        return FixedVector2(Fixed16::fromFloat(value.x), Fixed16::fromFloat(value.y));
+    }
+
+    /**
+     * @brief Convierte a `sf::Vector2f` para dibujar.
+     *
+     * @return Vector aproximado en flotante.
+     */
+    sf::Vector2f toVector2f() const { return sf::Vector2f(x.toFloat(), y.toFloat()); }
+
+    /**
+     * @brief Longitud exacta (redondeada hacia abajo al crudo anterior).
+     *
+     * Los cuadrados se suman en 64 bits, así que no se desborda mientras cada componente
+     * quepa en Q16.16.
+     *
+     * @return Longitud del vector.
+     */
+    Fixed16 length() const {
+        sf::Int64 rx = x.raw();
+        sf::Int64 ry = y.raw();
+        return Fixed16::fromRaw(static_cast<sf::Int32>(Fixed16::isqrt(static_cast<sf::Uint64>(rx * rx + ry * ry))));
+    }
+
+    FixedVector2 operator+(const FixedVector2& other) const { return FixedVector2(x + other.x, y + other.y); }
+    FixedVector2 operator-(const FixedVector2& other) const { return FixedVector2(x - other.x, y - other.y); }
+    FixedVector2 operator*(Fixed16 factor) const { return FixedVector2(x * factor, y * factor); }
+    FixedVector2& operator+=(const FixedVector2& other) { x += other.x; y += other.y; return *this; }
+    FixedVector2& operator-=(const FixedVector2& other) { x -= other.x; y -= other.y; return *this; }
+    bool operator==(const FixedVector2& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const FixedVector2& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Paso de seek en punto fijo sobre valores crudos; lo comparten `FixedTransform::Seek`
+ * y las rutas del kernel `FixedSteering`.
+ *
+ * Calcula la distancia exacta al objetivo, la velocidad `delta * speed / distance` (división
+ * entera redondeada hacia menos infinito) y mueve `velocity * deltaTime`. Las coordenadas
+ * deben quedar dentro de ±8192 píxeles para que ningún producto intermedio se desborde.
+ *
+ * @param positionX Posición X cruda (se actualiza).
+ * @param positionY Posición Y cruda (se actualiza).
+ * @param targetX Objetivo X crudo.
+ * @param targetY Objetivo Y crudo.
+ * @param speed Velocidad cruda en píxeles por segundo.
+ * @param range Radio de parada crudo.
+ * @param deltaTime Duración cruda del paso en segundos.
+ * @param velocityX Velocidad X cruda calculada (cero si no se mueve).
+ * @param velocityY Velocidad Y cruda calculada (cero si no se mueve).
+ * @return false si ya estaba dentro del rango o sobre el objetivo (no se movió).
+ */
+bool fixedSeekStep(sf::Int32& positionX, sf::Int32& positionY, sf::Int32 targetX, sf::Int32 targetY,
+                   sf::Int32 speed, sf::Int32 range, sf::Int32 deltaTime,
+                   sf::Int32& velocityX, sf::Int32& velocityY);
+
+/**
+ * @class FixedTransform
+ * @brief Posición en Q16.16 con la misma interfaz de movimiento que `Transform`.
+ *
+ * Pensado para el código de movimiento y física que debe repetirse igual en cualquier
+ * compilación (repeticiones, lockstep en red): el estado vive en punto fijo y solo se
+ * convierte a flotante para dibujar.
+ */
+class FixedTransform {
+public:
+    FixedTransform() = default;
+
+    /**
+     * @brief Construye en una posición dada.
+     *
+     * @param position Posición inicial.
+     */
+    explicit FixedTransform(const FixedVector2& position) : m_position(position), m_previousPosition(position) {}
+
+    /**
+     * @brief Establece la posición.
+     *
+     * @param position Nueva posición.
+     */
+    void setPosition(const FixedVector2& position) { m_position = position; }
+
+    /**
+     * @brief Posición actual.
+     *
+     * @return Posición en punto fijo.
+     */
+    const FixedVector2& getPosition() const { return m_position; }
+
+    /**
+     * @brief Guarda la posición actual como la del tick anterior.
+     */
+    void savePreviousState() { m_previousPosition = m_position; }
+
+    /**
+     * @brief Posición interpolada para dibujar (el resultado ya no es determinista).
+     *
+     * @param alpha Fracción de tick transcurrida.
+     * @return Posición en flotante.
+     */
+    sf::Vector2f getInterpolatedPosition(float alpha) const {
+        sf::Vector2f previous = m_previousPosition.toVector2f();
+        return previous + (m_position.toVector2f() - previous) * alpha;
+    }
+
+    /**
+     * @brief Mueve hacia un objetivo; versión determinista de `Transform::Seek`.
+     *
+     * @param targetPosition Posición objetivo.
+     * @param speed Velocidad en píxeles por segundo.
+     * @param deltaTime Duración del paso en segundos.
+     * @param range Distancia mínima antes de detener el movimiento.
+     * @return false si ya estaba dentro del rango (no se movió).
+     */
+    bool Seek(const FixedVector2& targetPosition, Fixed16 speed, Fixed16 deltaTime, Fixed16 range) {
+        sf::Int32 x = m_position.x.raw();
+        sf::Int32 y = m_position.y.raw();
+        sf::Int32 velocityX = 0;
+        sf::Int32 velocityY = 0;
+        bool moved = fixedSeekStep(x, y, targetPosition.x.raw(), targetPosition.y.raw(),
+                                   speed.raw(), range.raw(), deltaTime.raw(), velocityX, velocityY);
+        m_position = FixedVector2(Fixed16::fromRaw(x), Fixed16::fromRaw(y));
+        return moved;
+    }
+
+private:
+    FixedVector2 m_position;          ///< Posición del tick actual.
+    FixedVector2 m_previousPosition;  ///< Posición al inicio del tick (para interpolar).
+};
+
+/**
+ * @struct FixedSteeringAgents
+ * @brief Agentes en SoA con valores crudos Q16.16 (análogo a `SteeringAgents`).
+ */
+struct FixedSteeringAgents {
+    std::vector<sf::Int32> positionX;  ///< Posición X cruda de cada agente.
+    std::vector<sf::Int32> positionY;  ///< Posición Y cruda de cada agente.
+    std::vector<sf::Int32> velocityX;  ///< Velocidad X cruda calculada en el último paso.
+    std::vector<sf::Int32> velocityY;  ///< Velocidad Y cruda calculada en el último paso.
+    std::vector<sf::Int32> targetX;    ///< Objetivo X crudo de cada agente.
+    std::vector<sf::Int32> targetY;    ///< Objetivo Y crudo de cada agente.
+
+    /**
+     * @brief Cambia el número de agentes (los nuevos quedan en el origen y quietos).
+     *
+     * @param count Número de agentes.
+     */
+    void resize(std::size_t count);
+
+    /**
+     * @brief Número de agentes.
+     *
+     * @return Tamaño de los arreglos.
+     */
+    std::size_t size() const { return positionX.size(); }
+};
+
+/**
+ * @class FixedSteering
+ * @brief Kernel por lotes de seek en punto fijo: `FixedTransform::Seek` para miles de agentes.
+ *
+ * La ruta escalar llama a `fixedSeekStep`. La ruta AVX2 procesa 4 agentes por iteración:
+ * estima la raíz y el cociente en doble precisión y los corrige con productos enteros de
+ * 64 bits hasta el valor exacto, así que el resultado es idéntico bit a bit al escalar.
+ * SSE2 no tiene productos de 32 por 32 bits con signo y resultado de 64 ni comparaciones de 64 bits, de modo que el
+ * nivel SSE usa la ruta escalar.
+ */
+class FixedSteering {
+public:
+    /**
+     * @brief Avanza un paso todos los agentes con la mejor ruta disponible.
+     *
+     * @param agents Agentes a actualizar.
+     * @param speed Velocidad en píxeles por segundo.
+     * @param range Radio de parada.
+     * @param deltaTime Duración del paso en segundos.
+     */
+    static void update(FixedSteeringAgents& agents, Fixed16 speed, Fixed16 range, Fixed16 deltaTime);
+
+    /**
+     * @brief Avanza un paso todos los agentes con una ruta concreta.
+     *
+     * Si la CPU no soporta la ruta pedida se usa la mejor disponible.
+     *
+     * @param agents Agentes a actualizar.
+     * @param speed Velocidad en píxeles por segundo.
+     * @param range Radio de parada.
+     * @param deltaTime Duración del paso en segundos.
+     * @param level Ruta a usar.
+     */
+    static void update(FixedSteeringAgents& agents, Fixed16 speed, Fixed16 range, Fixed16 deltaTime,
+                       SimdLevel level);
+};
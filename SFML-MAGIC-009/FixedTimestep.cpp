@@ -0,0 +1,112 @@
+#include "FixedTimestep.h"
+
+/**
+ * @brief Constructor.
+ *
+ * @param tickRate Ticks de simulación por segundo.
+ * @param maxSteps Máximo de ticks simulados en un mismo frame.
+ */
+FixedTimestep::FixedTimestep(float tickRate, int maxSteps)
+    : m_stepTime(1.0f / 60.0f), m_maxSteps(std::max(1, maxSteps)) {
+    setTickRate(tickRate);
+}
+
+/**
+ * @brief Suma el tiempo real de un frame al acumulador.
+ *
+ * El acumulador es `double` para que el error de redondeo no se acumule en sesiones
+ * largas.
+ *
+ * @param frameTime Segundos transcurridos desde el frame anterior.
+ * @return Número de ticks que deben simularse en este frame.
+ */
+int FixedTimestep::advance(float frameTime) {
+    m_accumulator += std::max(0.0f, frameTime);
+
+    int steps = static_cast<int>(m_accumulator / m_stepTime);
+    m_accumulator -= static_cast<double>(steps) * m_stepTime;
+
+    if (steps > m_maxSteps) {
+        m_droppedTicks += static_cast<sf::Uint64>(steps - m_maxSteps);
+        steps = m_maxSteps;
+    }
+
+    m_tickCount += static_cast<sf::Uint64>(steps);
+    return steps;
+}
+
+/**
+ * @brief Fracción de tick pendiente en el acumulador.
+ *
+ * @return Valor en [0, 1).
+ */
+float FixedTimestep::getAlpha() const {
+    return std::min(0.999999f, static_cast<float>(m_accumulator / m_stepTime));
+}
+
+/**
+ * @brief Cambia la frecuencia de simulación.
+ *
+ * @param tickRate Ticks por segundo.
+ */
+void FixedTimestep::setTickRate(float tickRate) {
+    if (tickRate <= 0.0f) {
+        ERROR("FixedTimestep", "setTickRate", "TICK RATE MUST BE POSITIVE");
+        return;
+    }
+    m_stepTime = 1.0f / tickRate;
+}
+
+/**
+ * @brief Frecuencia de simulación.
+ *
+ * @return Ticks por segundo.
+ */
+float FixedTimestep::getTickRate() const {
+    return 1.0f / m_stepTime;
+}
+
+/**
+ * @brief Duración de un tick.
+ *
+ * @return Segundos por tick.
+ */
+float FixedTimestep::getStepTime() const {
+    return m_stepTime;
+}
+
+/**
+ * @brief Cambia el máximo de ticks por frame.
+ *
+ * @param maxSteps Ticks máximos por frame.
+ */
+void FixedTimestep::setMaxSteps(int maxSteps) {
+    m_maxSteps = std::max(1, maxSteps);
+}
+
+/**
+ * @brief Máximo de ticks por frame.
+ *
+ * @return Ticks máximos por frame.
+ */
+int FixedTimestep::getMaxSteps() const {
+    return m_maxSteps;
+}
+
+/**
+ * @brief Ticks simulados desde el inicio.
+ *
+ * @return Total de ticks.
+ */
+sf::Uint64 FixedTimestep::getTickCount() const {
+    return m_tickCount;
+}
+
+/**
+ * @brief Ticks descartados por superar el máximo por frame.
+ *
+ * @return Total de ticks descartados.
+ */
+sf::Uint64 FixedTimestep::getDroppedTicks() const {
+    return m_droppedTicks;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+
+/**
+ * @class FixedTimestep
+ * @brief Acumulador para simular con un paso de tiempo fijo.
+ *
+ * Cada frame se suma el tiempo real transcurrido y `advance` indica cuántos ticks de
+ * duración fija deben simularse. El tiempo sobrante (menor a un tick) queda en el
+ * acumulador y `getAlpha` lo expresa como fracción de tick para interpolar el render
+ * entre el estado anterior y el actual.
+ *
+ * Para no entrar en una espiral de ticks tras una pausa larga (carga, depurador, ventana
+ * arrastrada), se simulan como máximo `maxSteps` ticks por frame y el resto se descarta.
+ */
+class FixedTimestep {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param tickRate Ticks de simulación por segundo.
+     * @param maxSteps Máximo de ticks simulados en un mismo frame.
+     */
+    explicit FixedTimestep(float tickRate = 60.0f, int maxSteps = 5);
+
+    /**
+     * @brief Suma el tiempo real de un frame al acumulador.
+     *
+     * @param frameTime Segundos transcurridos desde el frame anterior.
+     * @return Número de ticks que deben simularse en este frame.
+     */
+    int advance(float frameTime);
+
+    /**
+     * @brief Fracción de tick pendiente en el acumulador.
+     *
+     * @return Valor en [0, 1) para interpolar entre el tick anterior y el actual.
+     */
+    float getAlpha() const;
+
+    /**
+     * @brief Cambia la frecuencia de simulación.
+     *
+     * @param tickRate Ticks por segundo (mayor que cero).
+     */
+    void setTickRate(float tickRate);
+
+    /**
+     * @brief Frecuencia de simulación.
+     *
+     * @return Ticks por segundo.
+     */
+    float getTickRate() const;
+
+    /**
+     * @brief Duración de un tick.
+     *
+     * @return Segundos por tick (el `deltaTime` que recibe la simulación).
+     */
+    float getStepTime() const;
+
+    /**
+     * @brief Cambia el máximo de ticks por frame.
+     *
+     * @param maxSteps Ticks máximos que se simulan para ponerse al día.
+     */
+    void setMaxSteps(int maxSteps);
+
+    /**
+     * @brief Máximo de ticks por frame.
+     *
+     * @return Ticks máximos que se simulan para ponerse al día.
+     */
+    int getMaxSteps() const;
+
+    /**
+     * @brief Ticks simulados desde el inicio.
+     *
+     * @return Total de ticks devueltos por `advance`.
+     */
+    sf::Uint64 getTickCount() const;
+
+    /**
+     * @brief Ticks descartados por superar el máximo por frame.
+     *
+     * @return Total de ticks perdidos tras pausas largas.
+     */
+    sf::Uint64 getDroppedTicks() const;
+
+private:
+    float m_stepTime;           ///< Duración de un tick en segundos.
+    int m_maxSteps;             ///< Máximo de ticks por frame.
+    double m_accumulator = 0.0; ///< Tiempo real pendiente de simular.
+    sf::Uint64 m_tickCount = 0;     ///< Ticks simulados.
+    sf::Uint64 m_droppedTicks = 0;  ///< Ticks descartados.
+};
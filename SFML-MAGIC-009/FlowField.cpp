@@ -0,0 +1,348 @@
+#include "FlowField.h"
+#include "ThreadPool.h"
+#include "TrackMask.h"
+#include <cmath>
+#include <limits>
+#include <queue>
+
+namespace {
+    constexpr sf::Uint8 kBlocked = 255;  // Costo de paso de una celda intransitable.
+    constexpr float kUnreachable = std::numeric_limits<float>::infinity();
+
+    // Vecinos en el orden de las direcciones: 4 ortogonales y luego 4 diagonales.
+    constexpr int kOffsetX[8] = { 1, 0, -1, 0, 1, -1, -1, 1 };
+    constexpr int kOffsetY[8] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+    constexpr float kStep[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.41421356f, 1.41421356f, 1.41421356f, 1.41421356f };
+    constexpr float kDiagonal = 0.70710678f;
+
+    // Vector unitario de cada dirección; la novena entrada es "sin dirección".
+    constexpr float kDirectionX[9] = { 1.0f, 0.0f, -1.0f, 0.0f, kDiagonal, -kDiagonal, -kDiagonal, kDiagonal, 0.0f };
+    constexpr float kDirectionY[9] = { 0.0f, 1.0f, 0.0f, -1.0f, kDiagonal, kDiagonal, -kDiagonal, -kDiagonal, 0.0f };
+
+    /**
+     * @brief Dirección opuesta (del vecino de vuelta a la celda).
+     *
+     * @param direction Dirección 0-7.
+     * @return Dirección contraria.
+     */
+    sf::Uint8 opposite(int direction) {
+        return static_cast<sf::Uint8>(direction < 4 ? (direction + 2) % 4 : 4 + (direction - 4 + 2) % 4);
+    }
+}
+
+/**
+ * @brief Constructor. Lee el suelo de cada celda de la máscara.
+ *
+ * @param bounds Rectángulo del mundo que cubre la rejilla.
+ * @param cellSize Lado de cada celda.
+ * @param mask Máscara de la pista (nula o vacía = todo es asfalto).
+ * @param offRoadCost Costo relativo de una celda fuera de pista.
+ */
+FlowField::FlowField(const sf::FloatRect& bounds, float cellSize, const TrackMask* mask, float offRoadCost)
+    : m_origin(bounds.left, bounds.top),
+      m_cellSize(std::max(cellSize, 1.0f)),
+      m_inverseCellSize(1.0f / std::max(cellSize, 1.0f)) {
+    m_columns = static_cast<sf::Uint32>(std::max(1.0f, std::ceil(bounds.width * m_inverseCellSize)));
+    m_rows = static_cast<sf::Uint32>(std::max(1.0f, std::ceil(bounds.height * m_inverseCellSize)));
+
+    // El suelo se lee de la máscara en el centro de cada celda, una sola vez.
+    const sf::Uint8 offRoad = static_cast<sf::Uint8>(std::max(1.0f, std::min(254.0f, std::round(offRoadCost))));
+    const bool hasMask = mask != nullptr && !mask->isEmpty();
+    m_ground.resize(static_cast<std::size_t>(m_columns) * m_rows);
+    for (sf::Uint32 y = 0; y < m_rows; ++y) {
+        for (sf::Uint32 x = 0; x < m_columns; ++x) {
+            sf::Vector2f center = m_origin + sf::Vector2f((x + 0.5f) * m_cellSize, (y + 0.5f) * m_cellSize);
+            m_ground[static_cast<std::size_t>(y) * m_columns + x] = !hasMask || mask->isDrivable(center) ? 1 : offRoad;
+        }
+    }
+    m_obstacles.assign(m_ground.size(), 0);
+    updateTerrain();
+}
+
+/**
+ * @brief Cambia los checkpoints conservando los campos que no cambian.
+ *
+ * @param checkpoints Destinos, en orden de la carrera.
+ */
+void FlowField::setCheckpoints(const std::vector<sf::Vector2f>& checkpoints) {
+    m_fields.resize(checkpoints.size());
+    for (std::size_t i = 0; i < checkpoints.size(); ++i) {
+        if (m_fields[i].goal != checkpoints[i] || m_fields[i].cost.empty()) {
+            m_fields[i].goal = checkpoints[i];
+            m_fields[i].valid = false;
+        }
+    }
+}
+
+/**
+ * @brief Bloquea las celdas que toca un rectángulo.
+ *
+ * @param area Rectángulo del obstáculo en el mundo.
+ */
+void FlowField::addObstacle(const sf::FloatRect& area) {
+    const float left = std::max(0.0f, std::floor((area.left - m_origin.x) * m_inverseCellSize));
+    const float top = std::max(0.0f, std::floor((area.top - m_origin.y) * m_inverseCellSize));
+    const float right = std::min(m_columns - 1.0f, std::floor((area.left + area.width - m_origin.x) * m_inverseCellSize));
+    const float bottom = std::min(m_rows - 1.0f, std::floor((area.top + area.height - m_origin.y) * m_inverseCellSize));
+    if (left > right || top > bottom) {
+        return;
+    }
+
+    bool changed = false;
+    for (sf::Uint32 y = static_cast<sf::Uint32>(top); y <= static_cast<sf::Uint32>(bottom); ++y) {
+        for (sf::Uint32 x = static_cast<sf::Uint32>(left); x <= static_cast<sf::Uint32>(right); ++x) {
+            sf::Uint8& obstacle = m_obstacles[static_cast<std::size_t>(y) * m_columns + x];
+            changed |= obstacle == 0;
+            obstacle = 1;
+        }
+    }
+    if (changed) {
+        updateTerrain();
+        invalidate();
+    }
+}
+
+/**
+ * @brief Quita todos los obstáculos.
+ */
+void FlowField::clearObstacles() {
+    if (std::find(m_obstacles.begin(), m_obstacles.end(), 1) == m_obstacles.end()) {
+        return;
+    }
+    std::fill(m_obstacles.begin(), m_obstacles.end(), 0);
+    updateTerrain();
+    invalidate();
+}
+
+/**
+ * @brief Calcula los campos invalidados, uno por tarea.
+ *
+ * @param pool Hilos para repartir los checkpoints (nullptr = en el hilo actual).
+ */
+void FlowField::prepare(ThreadPool* pool) {
+    std::vector<std::size_t> stale;
+    for (std::size_t i = 0; i < m_fields.size(); ++i) {
+        if (!m_fields[i].valid) {
+            stale.push_back(i);
+        }
+    }
+    if (stale.empty()) {
+        return;
+    }
+
+    // Cada campo es independiente: un Dijkstra por tarea, sin datos compartidos que escribir.
+    auto build = [this, &stale](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            buildField(m_fields[stale[i]]);
+        }
+    };
+    if (pool != nullptr && stale.size() > 1) {
+        pool->parallelFor(stale.size(), build, 1);
+    }
+    else {
+        build(0, stale.size());
+    }
+    m_buildCount += stale.size();
+}
+
+/**
+ * @brief Dijkstra desde el checkpoint: costo y dirección de cada celda.
+ *
+ * @param field Campo a calcular.
+ */
+void FlowField::buildField(Field& field) const {
+    const std::size_t cells = static_cast<std::size_t>(m_columns) * m_rows;
+    field.cost.assign(cells, kUnreachable);
+    field.direction.assign(cells, NoDirection);
+    field.valid = true;
+
+    const sf::Int32 goal = cellOf(field.goal);
+    if (goal < 0 || m_terrain[goal] == kBlocked) {
+        return;
+    }
+
+    using Entry = std::pair<float, sf::Uint32>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    field.cost[goal] = 0.0f;
+    open.push({ 0.0f, static_cast<sf::Uint32>(goal) });
+    while (!open.empty()) {
+        const auto [cost, cell] = open.top();
+        open.pop();
+        if (cost > field.cost[cell]) {
+            continue;  // Entrada vieja: la celda ya salió con un costo menor.
+        }
+
+        const int x = static_cast<int>(cell % m_columns);
+        const int y = static_cast<int>(cell / m_columns);
+        for (int direction = 0; direction < 8; ++direction) {
+            const int nx = x + kOffsetX[direction];
+            const int ny = y + kOffsetY[direction];
+            if (nx < 0 || ny < 0 || nx >= static_cast<int>(m_columns) || ny >= static_cast<int>(m_rows)) {
+                continue;
+            }
+            const std::size_t neighbor = static_cast<std::size_t>(ny) * m_columns + nx;
+            if (m_terrain[neighbor] == kBlocked) {
+                continue;
+            }
+            // En diagonal no se corta la esquina de una celda bloqueada.
+            if (direction >= 4 && (m_terrain[static_cast<std::size_t>(y) * m_columns + nx] == kBlocked ||
+                                   m_terrain[static_cast<std::size_t>(ny) * m_columns + x] == kBlocked)) {
+                continue;
+            }
+
+            // Costo del tramo: la mitad en cada celda, según su terreno.
+            const float stepCost = kStep[direction] * m_cellSize * 0.5f * (m_terrain[cell] + m_terrain[neighbor]);
+            const float candidate = cost + stepCost;
+            if (candidate < field.cost[neighbor]) {
+                field.cost[neighbor] = candidate;
+                field.direction[neighbor] = opposite(direction);
+                open.push({ candidate, static_cast<sf::Uint32>(neighbor) });
+            }
+        }
+    }
+}
+
+/**
+ * @brief Dirección hacia un checkpoint desde una posición.
+ *
+ * @param checkpoint Índice del checkpoint.
+ * @param position Posición en el mundo.
+ * @return Vector unitario, o cero si no hay dirección.
+ */
+sf::Vector2f FlowField::getDirection(std::size_t checkpoint, const sf::Vector2f& position) const {
+    const Field* field = bakedField(checkpoint);
+    const sf::Int32 cell = cellOf(position);
+    if (field == nullptr || cell < 0) {
+        return sf::Vector2f(0.0f, 0.0f);
+    }
+    const sf::Uint8 direction = field->direction[cell];
+    return sf::Vector2f(kDirectionX[direction], kDirectionY[direction]);
+}
+
+/**
+ * @brief Dirección de un lote de agentes hacia el mismo checkpoint (sin ramas por agente).
+ *
+ * @param checkpoint Índice del checkpoint.
+ * @param x Coordenadas X de los agentes.
+ * @param y Coordenadas Y de los agentes.
+ * @param count Número de agentes.
+ * @param directionX Recibe la componente X de cada dirección.
+ * @param directionY Recibe la componente Y de cada dirección.
+ */
+void FlowField::getDirections(std::size_t checkpoint, const float* x, const float* y, std::size_t count,
+                              float* directionX, float* directionY) const {
+    const Field* field = bakedField(checkpoint);
+    if (field == nullptr) {
+        std::fill(directionX, directionX + count, 0.0f);
+        std::fill(directionY, directionY + count, 0.0f);
+        return;
+    }
+    const sf::Uint8* directions = field->direction.data();
+    const float columns = static_cast<float>(m_columns);
+    const float rows = static_cast<float>(m_rows);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float cellX = (x[i] - m_origin.x) * m_inverseCellSize;
+        const float cellY = (y[i] - m_origin.y) * m_inverseCellSize;
+        const bool inside = cellX >= 0.0f && cellY >= 0.0f && cellX < columns && cellY < rows;
+        const std::size_t cell = inside
+            ? static_cast<std::size_t>(cellY) * m_columns + static_cast<std::size_t>(cellX)
+            : 0;
+        const sf::Uint8 direction = inside ? directions[cell] : NoDirection;
+        directionX[i] = kDirectionX[direction];
+        directionY[i] = kDirectionY[direction];
+    }
+}
+
+/**
+ * @brief Costo del camino más barato hasta un checkpoint.
+ *
+ * @param checkpoint Índice del checkpoint.
+ * @param position Posición en el mundo.
+ * @return Costo, o infinito si no hay camino.
+ */
+float FlowField::getCost(std::size_t checkpoint, const sf::Vector2f& position) const {
+    const Field* field = bakedField(checkpoint);
+    const sf::Int32 cell = cellOf(position);
+    return field == nullptr || cell < 0 ? kUnreachable : field->cost[cell];
+}
+
+/**
+ * @brief Centro de la siguiente celda del camino.
+ *
+ * @param checkpoint Índice del checkpoint.
+ * @param position Posición en el mundo.
+ * @return Centro de la celda vecina, o la misma posición si no hay dirección.
+ */
+sf::Vector2f FlowField::getNextCell(std::size_t checkpoint, const sf::Vector2f& position) const {
+    const Field* field = bakedField(checkpoint);
+    const sf::Int32 cell = cellOf(position);
+    if (field == nullptr || cell < 0 || field->direction[cell] == NoDirection) {
+        return position;
+    }
+    const sf::Uint8 direction = field->direction[cell];
+    const sf::Uint32 x = cell % m_columns + kOffsetX[direction];
+    const sf::Uint32 y = cell / m_columns + kOffsetY[direction];
+    return m_origin + sf::Vector2f((x + 0.5f) * m_cellSize, (y + 0.5f) * m_cellSize);
+}
+
+/**
+ * @brief Indica si una posición cae en una celda bloqueada o fuera de la rejilla.
+ *
+ * @param position Posición en el mundo.
+ * @return true si está bloqueada.
+ */
+bool FlowField::isBlocked(const sf::Vector2f& position) const {
+    const sf::Int32 cell = cellOf(position);
+    return cell < 0 || m_terrain[cell] == kBlocked;
+}
+
+/**
+ * @brief Campo de un checkpoint si ya se calculó para la rejilla actual.
+ *
+ * @param checkpoint Índice del checkpoint.
+ * @return Campo consultable, o nullptr antes de `prepare` o con un índice inválido.
+ */
+const FlowField::Field* FlowField::bakedField(std::size_t checkpoint) const {
+    if (checkpoint >= m_fields.size()) {
+        return nullptr;
+    }
+    const Field& field = m_fields[checkpoint];
+    if (field.direction.empty() || field.direction.size() != static_cast<std::size_t>(m_columns) * m_rows) {
+        return nullptr;
+    }
+    return &field;
+}
+
+/**
+ * @brief Celda de una posición.
+ *
+ * @param position Posición en el mundo.
+ * @return Índice de la celda, o -1 fuera de la rejilla.
+ */
+sf::Int32 FlowField::cellOf(const sf::Vector2f& position) const {
+    const float cellX = (position.x - m_origin.x) * m_inverseCellSize;
+    const float cellY = (position.y - m_origin.y) * m_inverseCellSize;
+    if (!(cellX >= 0.0f && cellY >= 0.0f && cellX < m_columns && cellY < m_rows)) {
+        return -1;
+    }
+    return static_cast<sf::Int32>(static_cast<sf::Uint32>(cellY) * m_columns + static_cast<sf::Uint32>(cellX));
+}
+
+/**
+ * @brief Combina el suelo con los obstáculos.
+ */
+void FlowField::updateTerrain() {
+    m_terrain.resize(m_ground.size());
+    for (std::size_t i = 0; i < m_ground.size(); ++i) {
+        m_terrain[i] = m_obstacles[i] ? kBlocked : m_ground[i];
+    }
+}
+
+/**
+ * @brief Marca todos los campos para recalcular.
+ */
+void FlowField::invalidate() {
+    for (Field& field : m_fields) {
+        field.valid = false;
+    }
+}
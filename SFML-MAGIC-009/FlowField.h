@@ -0,0 +1,204 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <SFML/Graphics/Rect.hpp>
+
+class ThreadPool;
+class TrackMask;
+
+/**
+ * @class FlowField
+ * @brief Campos de flujo sobre la pista: una dirección por celda hacia cada checkpoint.
+ *
+ * La pista se divide en celdas de `cellSize`. Cada celda tiene un costo de paso: 1 sobre
+ * el asfalto, `offRoadCost` fuera de pista (según la `TrackMask`) y bloqueada bajo un
+ * obstáculo. Para cada checkpoint se corre un Dijkstra desde la celda del checkpoint
+ * hacia afuera (8 vecinos, sin cortar esquinas bloqueadas) y cada celda guarda en un byte
+ * hacia qué vecino queda el camino más barato. Con el campo listo, todo un pelotón de la
+ * IA se guía con una lectura por agente, sin importar cuántos corredores haya.
+ *
+ * Los campos se guardan por checkpoint y solo se recalculan cuando un obstáculo cambia
+ * alguna celda. `prepare` recalcula los que falten, uno por tarea de un `ThreadPool`.
+ */
+class FlowField {
+public:
+    static constexpr sf::Uint8 NoDirection = 8;  ///< Celda sin dirección (checkpoint, bloqueada o inalcanzable).
+
+    /**
+     * @brief Constructor.
+     *
+     * @param bounds Rectángulo del mundo que cubre la rejilla.
+     * @param cellSize Lado de cada celda en píxeles del mundo.
+     * @param mask Máscara de la pista (nula o vacía = todo es asfalto).
+     * @param offRoadCost Costo relativo de cruzar una celda fuera de pista (1 a 254).
+     */
+    FlowField(const sf::FloatRect& bounds, float cellSize, const TrackMask* mask = nullptr, float offRoadCost = 4.0f);
+
+    /**
+     * @brief Cambia los checkpoints. Los campos de checkpoints que no cambian se conservan.
+     *
+     * @param checkpoints Destinos, en orden de la carrera.
+     */
+    void setCheckpoints(const std::vector<sf::Vector2f>& checkpoints);
+
+    /**
+     * @brief Bloquea las celdas que toca un rectángulo.
+     *
+     * Invalida los campos solo si alguna celda pasó de libre a bloqueada.
+     *
+     * @param area Rectángulo del obstáculo en el mundo.
+     */
+    void addObstacle(const sf::FloatRect& area);
+
+    /**
+     * @brief Quita todos los obstáculos (invalida los campos si había alguno).
+     */
+    void clearObstacles();
+
+    /**
+     * @brief Calcula los campos invalidados.
+     *
+     * @param pool Hilos para calcular varios checkpoints a la vez (nullptr = en el hilo actual).
+     */
+    void prepare(ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Indica si el campo de un checkpoint está calculado y vigente.
+     *
+     * @param checkpoint Índice del checkpoint.
+     * @return true si se puede consultar.
+     */
+    bool isReady(std::size_t checkpoint) const { return checkpoint < m_fields.size() && m_fields[checkpoint].valid; }
+
+    /**
+     * @brief Dirección hacia un checkpoint desde una posición.
+     *
+     * @param checkpoint Índice del checkpoint.
+     * @param position Posición en el mundo.
+     * @return Vector unitario, o cero en el checkpoint, fuera de la rejilla, sin camino o
+     *         si el campo aún no se calculó.
+     */
+    sf::Vector2f getDirection(std::size_t checkpoint, const sf::Vector2f& position) const;
+
+    /**
+     * @brief Dirección de un lote de agentes hacia el mismo checkpoint.
+     *
+     * @param checkpoint Índice del checkpoint (sin campo calculado, todas las direcciones son cero).
+     * @param x Coordenadas X de los agentes.
+     * @param y Coordenadas Y de los agentes.
+     * @param count Número de agentes.
+     * @param directionX Recibe la componente X de cada dirección.
+     * @param directionY Recibe la componente Y de cada dirección.
+     */
+    void getDirections(std::size_t checkpoint, const float* x, const float* y, std::size_t count,
+                       float* directionX, float* directionY) const;
+
+    /**
+     * @brief Costo del camino más barato hasta un checkpoint.
+     *
+     * @param checkpoint Índice del checkpoint (su campo debe estar listo).
+     * @param position Posición en el mundo.
+     * @return Costo en píxeles ponderados, o infinito si no hay camino.
+     */
+    float getCost(std::size_t checkpoint, const sf::Vector2f& position) const;
+
+    /**
+     * @brief Centro de la celda vecina hacia la que apunta una posición.
+     *
+     * @param checkpoint Índice del checkpoint (su campo debe estar listo).
+     * @param position Posición en el mundo.
+     * @return Centro de la siguiente celda del camino (la misma posición si no hay dirección).
+     */
+    sf::Vector2f getNextCell(std::size_t checkpoint, const sf::Vector2f& position) const;
+
+    /**
+     * @brief Indica si una posición cae en una celda bloqueada por un obstáculo.
+     *
+     * @param position Posición en el mundo.
+     * @return true si está bloqueada (fuera de la rejilla también cuenta).
+     */
+    bool isBlocked(const sf::Vector2f& position) const;
+
+    /**
+     * @brief Número de checkpoints.
+     *
+     * @return Campos guardados.
+     */
+    std::size_t getCheckpointCount() const { return m_fields.size(); }
+
+    /**
+     * @brief Campos calculados desde que se creó la rejilla (para medir el caché).
+     *
+     * @return Ejecuciones de Dijkstra.
+     */
+    std::size_t getBuildCount() const { return m_buildCount; }
+
+    /**
+     * @brief Columnas de la rejilla.
+     *
+     * @return Celdas en X.
+     */
+    sf::Uint32 getColumns() const { return m_columns; }
+
+    /**
+     * @brief Filas de la rejilla.
+     *
+     * @return Celdas en Y.
+     */
+    sf::Uint32 getRows() const { return m_rows; }
+
+private:
+    /**
+     * @struct Field
+     * @brief Campo de un checkpoint.
+     */
+    struct Field {
+        sf::Vector2f goal;                   ///< Posición del checkpoint.
+        std::vector<float> cost;             ///< Costo acumulado hasta el checkpoint por celda.
+        std::vector<sf::Uint8> direction;    ///< Vecino hacia el checkpoint por celda (0-7 o `NoDirection`).
+        bool valid = false;                  ///< false si hay que recalcularlo.
+    };
+
+    /**
+     * @brief Corre Dijkstra desde el checkpoint de un campo.
+     *
+     * @param field Campo a calcular.
+     */
+    void buildField(Field& field) const;
+
+    /**
+     * @brief Campo de un checkpoint si ya se calculó alguna vez para la rejilla actual.
+     *
+     * @param checkpoint Índice del checkpoint.
+     * @return Campo consultable, o nullptr antes de `prepare` o con un índice inválido.
+     */
+    const Field* bakedField(std::size_t checkpoint) const;
+
+    /**
+     * @brief Celda de una posición.
+     *
+     * @param position Posición en el mundo.
+     * @return Índice de la celda, o -1 fuera de la rejilla.
+     */
+    sf::Int32 cellOf(const sf::Vector2f& position) const;
+
+    /**
+     * @brief Recalcula el costo de paso de cada celda (terreno más obstáculos).
+     */
+    void updateTerrain();
+
+    /**
+     * @brief Marca todos los campos para recalcular.
+     */
+    void invalidate();
+
+    sf::Vector2f m_origin;               ///< Esquina del mundo de la celda (0, 0).
+    float m_cellSize;                    ///< Lado de las celdas.
+    float m_inverseCellSize;             ///< 1 / `m_cellSize`.
+    sf::Uint32 m_columns = 0;            ///< Celdas en X.
+    sf::Uint32 m_rows = 0;               ///< Celdas en Y.
+    std::vector<sf::Uint8> m_ground;     ///< Costo del suelo por celda (sin obstáculos).
+    std::vector<sf::Uint8> m_obstacles;  ///< 1 en las celdas bajo un obstáculo.
+    std::vector<sf::Uint8> m_terrain;    ///< Costo de paso por celda (255 = intransitable).
+    std::vector<Field> m_fields;         ///< Un campo por checkpoint.
+    std::size_t m_buildCount = 0;        ///< Campos calculados.
+};
@@ -0,0 +1,200 @@
+#include "FramePacer.h"
+#include <SFML/System/Sleep.hpp>
+#include <thread>
+
+/**
+ * @brief Constructor. Empieza en modo VSync a 60 FPS objetivo.
+ */
+FramePacer::FramePacer() = default;
+
+/**
+ * @brief Cambia el modo de presentación.
+ *
+ * @param mode Modo de presentación.
+ * @param targetFrameRate Frames por segundo del limitador.
+ */
+void FramePacer::setMode(FramePacingMode mode, float targetFrameRate) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_mode = mode;
+    if (targetFrameRate > 0.0f) {
+        m_targetFrameRate = targetFrameRate;
+    }
+    m_modeDirty = true;
+    m_historyCount = 0;
+    m_historyNext = 0;
+}
+
+/**
+ * @brief Aplica un cambio de modo pendiente sobre la ventana.
+ *
+ * `setVerticalSyncEnabled` activa el contexto de la ventana en el hilo que llama, por
+ * eso solo debe hacerse desde el hilo de presentación.
+ *
+ * @param window Ventana cuya sincronía vertical se activa o desactiva.
+ */
+void FramePacer::applyPendingMode(sf::Window& window) {
+    bool vsync = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_modeDirty) {
+            return;
+        }
+        m_modeDirty = false;
+        vsync = m_mode == FramePacingMode::VSync;
+        m_nextFrameTime = m_clock.getElapsedTime();
+    }
+    window.setVerticalSyncEnabled(vsync);
+}
+
+/**
+ * @brief Espera hasta el instante del siguiente frame (solo en modo `Limited`).
+ *
+ * Duerme hasta 2 ms antes del objetivo y luego cede el procesador en un bucle hasta
+ * alcanzarlo. Si el frame llegó más de un periodo tarde, el objetivo se reinicia en lugar
+ * de intentar recuperar frames perdidos con una ráfaga.
+ */
+void FramePacer::waitForNextFrame() {
+    sf::Time period;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_mode != FramePacingMode::Limited) {
+            return;
+        }
+        period = sf::seconds(1.0f / m_targetFrameRate);
+    }
+
+    const sf::Time spinMargin = sf::milliseconds(2);
+    sf::Time now = m_clock.getElapsedTime();
+
+    if (now > m_nextFrameTime + period) {
+        m_nextFrameTime = now;
+    }
+
+    sf::Time remaining = m_nextFrameTime - now;
+    if (remaining > spinMargin) {
+        sf::sleep(remaining - spinMargin);
+    }
+    while (m_clock.getElapsedTime() < m_nextFrameTime) {
+        std::this_thread::yield();
+    }
+
+    m_nextFrameTime += period;
+}
+
+/**
+ * @brief Registra que un frame acaba de presentarse.
+ */
+void FramePacer::recordFrame() {
+    sf::Time now = m_clock.getElapsedTime();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_hasLastFrame) {
+        m_history[m_historyNext] = (now - m_lastFrameTime).asMicroseconds() / 1000.0f;
+        m_historyNext = (m_historyNext + 1) % kHistorySize;
+        m_historyCount = std::min(m_historyCount + 1, kHistorySize);
+    }
+    m_lastFrameTime = now;
+    m_hasLastFrame = true;
+}
+
+/**
+ * @brief Estadísticas de los últimos frames.
+ *
+ * @return Promedio, extremos, percentiles y jitter del tiempo entre frames.
+ */
+FramePacer::Stats FramePacer::getStats() const {
+    Stats stats;
+    float samples[kHistorySize];
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        stats.mode = m_mode;
+        stats.targetFrameRate = m_targetFrameRate;
+        stats.samples = m_historyCount;
+        std::copy(m_history, m_history + m_historyCount, samples);
+    }
+
+    if (stats.samples == 0) {
+        return stats;
+    }
+
+    double sum = 0.0;
+    stats.minMs = samples[0];
+    stats.maxMs = samples[0];
+    for (std::size_t i = 0; i < stats.samples; ++i) {
+        sum += samples[i];
+        stats.minMs = std::min(stats.minMs, samples[i]);
+        stats.maxMs = std::max(stats.maxMs, samples[i]);
+    }
+    double average = sum / stats.samples;
+
+    double variance = 0.0;
+    for (std::size_t i = 0; i < stats.samples; ++i) {
+        double delta = samples[i] - average;
+        variance += delta * delta;
+    }
+
+    stats.averageMs = static_cast<float>(average);
+    stats.jitterMs = static_cast<float>(std::sqrt(variance / stats.samples));
+
+    // Con 240 muestras ordenar es trivial y da los tres percentiles de una vez.
+    std::sort(samples, samples + stats.samples);
+    auto percentile = [&](std::size_t percent) {
+        return samples[std::min((stats.samples * percent) / 100, stats.samples - 1)];
+    };
+    stats.p50Ms = percentile(50);
+    stats.p95Ms = percentile(95);
+    stats.p99Ms = percentile(99);
+
+    return stats;
+}
+
+/**
+ * @brief Copia los tiempos entre frames de la ventana de medición.
+ *
+ * @param out Recibe los tiempos en milisegundos, del más antiguo al más reciente.
+ */
+void FramePacer::getFrameTimes(std::vector<float>& out) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    out.resize(m_historyCount);
+    for (std::size_t i = 0; i < m_historyCount; ++i) {
+        out[i] = m_history[(m_historyNext + kHistorySize - m_historyCount + i) % kHistorySize];
+    }
+}
+
+/**
+ * @brief Convierte un modo a texto.
+ *
+ * @param mode Modo de presentación.
+ * @return Nombre del modo.
+ */
+const char* FramePacer::toString(FramePacingMode mode) {
+    switch (mode) {
+    case FramePacingMode::VSync: return "vsync";
+    case FramePacingMode::Limited: return "limit";
+    case FramePacingMode::Uncapped: return "uncapped";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Interpreta el nombre de un modo.
+ *
+ * @param name Nombre del modo.
+ * @param mode Modo resultante si el nombre es válido.
+ * @return true si el nombre es válido.
+ */
+bool FramePacer::fromString(const std::string& name, FramePacingMode& mode) {
+    if (name == "vsync") {
+        mode = FramePacingMode::VSync;
+    }
+    else if (name == "limit") {
+        mode = FramePacingMode::Limited;
+    }
+    else if (name == "uncapped") {
+        mode = FramePacingMode::Uncapped;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <mutex>
+#include <SFML/System/Clock.hpp>
+#include <SFML/Window/Window.hpp>
+
+/**
+ * @enum FramePacingMode
+ * @brief Forma en que se espacian los frames presentados.
+ */
+enum class FramePacingMode {
+    VSync,     ///< Sincronía vertical del controlador: un frame por refresco del monitor.
+    Limited,   ///< Limitador propio: duerme y luego espera activamente hasta el instante objetivo.
+    Uncapped   ///< Sin límite (benchmarks): presenta en cuanto el frame está listo.
+};
+
+/**
+ * @class FramePacer
+ * @brief Controla el ritmo de presentación de los frames y mide su regularidad.
+ *
+ * Debe usarse en el hilo que presenta los frames (el que tiene el contexto de OpenGL):
+ * `waitForNextFrame` justo antes de `display` y `recordFrame` justo después.
+ *
+ * El limitador es híbrido: `sf::sleep` tiene una resolución de ~1 ms (y peor en
+ * algunos sistemas), así que duerme hasta un margen antes del instante objetivo y el
+ * resto lo espera de forma activa. Los objetivos avanzan un periodo exacto por frame
+ * para que el error de un frame no se acumule en el siguiente.
+ */
+class FramePacer {
+public:
+    /**
+     * @struct Stats
+     * @brief Estadísticas de los últimos frames presentados.
+     */
+    struct Stats {
+        FramePacingMode mode = FramePacingMode::VSync;  ///< Modo activo.
+        float targetFrameRate = 0.0f;  ///< Frames por segundo objetivo del limitador.
+        float averageMs = 0.0f;        ///< Tiempo medio entre frames.
+        float minMs = 0.0f;            ///< Tiempo mínimo entre frames.
+        float maxMs = 0.0f;            ///< Tiempo máximo entre frames.
+        float p50Ms = 0.0f;            ///< Mediana del tiempo entre frames.
+        float p95Ms = 0.0f;            ///< Percentil 95 del tiempo entre frames.
+        float p99Ms = 0.0f;            ///< Percentil 99 del tiempo entre frames.
+        float jitterMs = 0.0f;         ///< Desviación estándar del tiempo entre frames.
+        std::size_t samples = 0;       ///< Frames incluidos en la ventana de medición.
+    };
+
+    /**
+     * @brief Constructor. Empieza en modo VSync a 60 FPS objetivo.
+     */
+    FramePacer();
+
+    /**
+     * @brief Cambia el modo de presentación.
+     *
+     * Puede llamarse desde cualquier hilo; la sincronía vertical se aplica en el hilo de
+     * presentación al llamar a `applyPendingMode`.
+     *
+     * @param mode Modo de presentación.
+     * @param targetFrameRate Frames por segundo del limitador (ignorado en otros modos).
+     */
+    void setMode(FramePacingMode mode, float targetFrameRate = 60.0f);
+
+    /**
+     * @brief Aplica un cambio de modo pendiente sobre la ventana.
+     *
+     * @param window Ventana cuya sincronía vertical se activa o desactiva.
+     */
+    void applyPendingMode(sf::Window& window);
+
+    /**
+     * @brief Espera hasta el instante del siguiente frame (solo en modo `Limited`).
+     */
+    void waitForNextFrame();
+
+    /**
+     * @brief Registra que un frame acaba de presentarse.
+     */
+    void recordFrame();
+
+    /**
+     * @brief Estadísticas de los últimos frames.
+     *
+     * @return Promedio, extremos, percentiles y jitter del tiempo entre frames.
+     */
+    Stats getStats() const;
+
+    /**
+     * @brief Copia los tiempos entre frames de la ventana de medición.
+     *
+     * @param out Recibe los tiempos en milisegundos, del más antiguo al más reciente.
+     */
+    void getFrameTimes(std::vector<float>& out) const;
+
+    /**
+     * @brief Convierte un modo a texto.
+     *
+     * @param mode Modo de presentación.
+     * @return Nombre del modo ("vsync", "limit" o "uncapped").
+     */
+    static const char* toString(FramePacingMode mode);
+
+    /**
+     * @brief Interpreta el nombre de un modo.
+     *
+     * @param name Nombre ("vsync", "limit" o "uncapped").
+     * @param mode Modo resultante si el nombre es válido.
+     * @return true si el nombre es válido.
+     */
+    static bool fromString(const std::string& name, FramePacingMode& mode);
+
+private:
+    static constexpr std::size_t kHistorySize = 240;  ///< Frames de la ventana de medición.
+
+    mutable std::mutex m_mutex;        ///< Protege el modo y el historial.
+    FramePacingMode m_mode = FramePacingMode::VSync;  ///< Modo activo.
+    float m_targetFrameRate = 60.0f;   ///< Objetivo del limitador.
+    bool m_modeDirty = true;           ///< Falta aplicar el modo a la ventana.
+
+    sf::Clock m_clock;                 ///< Reloj de presentación.
+    sf::Time m_nextFrameTime;          ///< Instante objetivo del siguiente frame (modo `Limited`).
+    sf::Time m_lastFrameTime;          ///< Instante del último frame presentado.
+    bool m_hasLastFrame = false;       ///< Ya se presentó al menos un frame.
+
+    float m_history[kHistorySize] = {};  ///< Tiempos entre frames en milisegundos (circular).
+    std::size_t m_historyCount = 0;    ///< Muestras válidas en el historial.
+    std::size_t m_historyNext = 0;     ///< Siguiente posición a escribir.
+};
@@ -0,0 +1,300 @@
+#include "InputSystem.h"
+#include <cstring>
+#include <iostream>
+
+namespace {
+/**
+ * @brief Activa o limpia el bit de una tecla.
+ *
+ * @param bits Conjunto de teclas.
+ * @param key Código de la tecla (ya validado).
+ * @param value Valor del bit.
+ */
+void setKeyBit(sf::Uint64* bits, int key, bool value) {
+    sf::Uint64 mask = sf::Uint64(1) << (key % 64);
+    if (value) {
+        bits[key / 64] |= mask;
+    }
+    else {
+        bits[key / 64] &= ~mask;
+    }
+}
+}
+
+/**
+ * @brief Número de teclas mantenidas.
+ *
+ * @return Bits activos en `keysDown`.
+ */
+int InputSnapshot::countKeysDown() const {
+    int count = 0;
+    for (sf::Uint64 word : keysDown) {
+        for (; word != 0; word &= word - 1) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Constructor por defecto. Publica un snapshot vacío.
+ */
+InputSystem::InputSystem() {
+    publish(m_state);
+}
+
+/**
+ * @brief Destructor. Cierra la grabación si sigue abierta.
+ */
+InputSystem::~InputSystem() {
+    stop();
+}
+
+/**
+ * @brief Acumula el lote de eventos de un frame.
+ *
+ * Los flancos y deltas se suman hasta que un tick los consume: si en un frame no toca
+ * simular ningún tick, el siguiente los recibe igual.
+ *
+ * @param events Eventos sacados de la ventana en este frame.
+ */
+void InputSystem::processEvents(const std::vector<sf::Event>& events) {
+    for (const sf::Event& event : events) {
+        switch (event.type) {
+        case sf::Event::KeyPressed: {
+            int key = event.key.code;
+            if (key >= 0 && key < sf::Keyboard::KeyCount && !m_state.isKeyDown(event.key.code)) {
+                // La repetición automática del teclado no genera nuevos flancos.
+                setKeyBit(m_state.keysDown, key, true);
+                setKeyBit(m_state.keysPressed, key, true);
+            }
+            break;
+        }
+        case sf::Event::KeyReleased: {
+            int key = event.key.code;
+            if (key >= 0 && key < sf::Keyboard::KeyCount) {
+                setKeyBit(m_state.keysDown, key, false);
+                setKeyBit(m_state.keysReleased, key, true);
+            }
+            break;
+        }
+        case sf::Event::MouseMoved: {
+            sf::Vector2f position(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
+            if (m_state.mouseInside) {
+                m_state.mouseDelta += position - m_state.mousePosition;
+            }
+            m_state.mousePosition = position;
+            m_state.mouseInside = true;
+            break;
+        }
+        case sf::Event::MouseEntered:
+            m_state.mouseInside = true;
+            break;
+        case sf::Event::MouseLeft:
+            m_state.mouseInside = false;
+            break;
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased: {
+            if (event.mouseButton.button < 0 || event.mouseButton.button >= sf::Mouse::ButtonCount) {
+                break;
+            }
+            sf::Uint8 mask = static_cast<sf::Uint8>(1u << event.mouseButton.button);
+            if (event.type == sf::Event::MouseButtonPressed) {
+                m_state.buttonsDown |= mask;
+                m_state.buttonsPressed |= mask;
+            }
+            else {
+                m_state.buttonsDown &= static_cast<sf::Uint8>(~mask);
+                m_state.buttonsReleased |= mask;
+            }
+            m_state.mousePosition = sf::Vector2f(static_cast<float>(event.mouseButton.x),
+                                                 static_cast<float>(event.mouseButton.y));
+            break;
+        }
+        case sf::Event::MouseWheelScrolled:
+            if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+                m_state.wheelDelta += event.mouseWheelScroll.delta;
+            }
+            break;
+        case sf::Event::LostFocus:
+            // Sin foco no llegan los KeyReleased: soltar todo para no dejar teclas trabadas.
+            m_state.hasFocus = false;
+            releaseAll();
+            break;
+        case sf::Event::GainedFocus:
+            m_state.hasFocus = true;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Entrega la entrada de un tick de simulación.
+ *
+ * @return Snapshot que debe usar este tick.
+ */
+InputSnapshot InputSystem::consumeTick() {
+    InputSnapshot snapshot = m_state;
+    if (isReplaying()) {
+        snapshot = m_replay[m_replayIndex++];
+        if (!isReplaying()) {
+            std::cerr << "InputSystem : la reproducción terminó tras " << m_replay.size() << " ticks\n";
+        }
+    }
+    snapshot.tick = m_tick++;
+
+    if (m_recordFile.is_open()) {
+        m_recordFile.write(reinterpret_cast<const char*>(&snapshot), sizeof(snapshot));
+    }
+    publish(snapshot);
+
+    // Los flancos y deltas ya se entregaron: el siguiente tick empieza de cero.
+    std::fill(std::begin(m_state.keysPressed), std::end(m_state.keysPressed), 0);
+    std::fill(std::begin(m_state.keysReleased), std::end(m_state.keysReleased), 0);
+    m_state.buttonsPressed = 0;
+    m_state.buttonsReleased = 0;
+    m_state.mouseDelta = sf::Vector2f(0.0f, 0.0f);
+    m_state.wheelDelta = 0.0f;
+    return snapshot;
+}
+
+/**
+ * @brief Último snapshot entregado a la simulación, leído desde cualquier hilo.
+ *
+ * @return Copia del último snapshot publicado.
+ */
+InputSnapshot InputSystem::readLatest() const {
+    sf::Uint64 words[kWords];
+    while (true) {
+        sf::Uint32 before = m_sequence.load(std::memory_order_acquire);
+        if (before & 1u) {
+            continue;  // El escritor está a mitad de una publicación.
+        }
+        // Cargas con acquire: la segunda lectura del contador no puede adelantarse a ellas.
+        for (std::size_t i = 0; i < kWords; ++i) {
+            words[i] = m_published[i].load(std::memory_order_acquire);
+        }
+        if (m_sequence.load(std::memory_order_relaxed) == before) {
+            break;
+        }
+    }
+
+    InputSnapshot snapshot;
+    std::memcpy(&snapshot, words, sizeof(snapshot));
+    return snapshot;
+}
+
+/**
+ * @brief Empieza a grabar los snapshots entregados a la simulación.
+ *
+ * @param path Archivo de salida.
+ * @return false si no se pudo abrir el archivo.
+ */
+bool InputSystem::startRecording(const std::string& path) {
+    stop();
+
+    m_recordFile.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_recordFile.is_open()) {
+        std::cerr << "InputSystem : no se puede abrir '" << path << "' para escritura\n";
+        return false;
+    }
+
+    FileHeader header = { { 'M', 'G', 'I', 'N' }, kFileVersion, static_cast<sf::Uint32>(sizeof(InputSnapshot)) };
+    m_recordFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return true;
+}
+
+/**
+ * @brief Carga una grabación y la entrega a los ticks siguientes.
+ *
+ * @param path Archivo grabado con `startRecording`.
+ * @return false si el archivo no existe o no es compatible con este build.
+ */
+bool InputSystem::startReplay(const std::string& path) {
+    stop();
+
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "InputSystem : no se puede abrir '" << path << "' para lectura\n";
+        return false;
+    }
+
+    FileHeader header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || std::memcmp(header.magic, "MGIN", 4) != 0 || header.version != kFileVersion ||
+        header.snapshotSize != sizeof(InputSnapshot)) {
+        std::cerr << "InputSystem : '" << path << "' no es una grabación de entrada compatible\n";
+        return false;
+    }
+
+    InputSnapshot snapshot;
+    while (file.read(reinterpret_cast<char*>(&snapshot), sizeof(snapshot))) {
+        m_replay.push_back(snapshot);
+    }
+    m_replayIndex = 0;
+    return true;
+}
+
+/**
+ * @brief Termina la grabación o la reproducción en curso.
+ */
+void InputSystem::stop() {
+    if (m_recordFile.is_open()) {
+        m_recordFile.close();
+    }
+    m_replay.clear();
+    m_replayIndex = 0;
+}
+
+/**
+ * @brief Indica si se está grabando.
+ *
+ * @return true entre `startRecording` y `stop`.
+ */
+bool InputSystem::isRecording() const {
+    return m_recordFile.is_open();
+}
+
+/**
+ * @brief Indica si se está reproduciendo una grabación.
+ *
+ * @return true mientras queden snapshots grabados por entregar.
+ */
+bool InputSystem::isReplaying() const {
+    return m_replayIndex < m_replay.size();
+}
+
+/**
+ * @brief Publica un snapshot para `readLatest` (un solo escritor).
+ *
+ * Seqlock: el contador queda impar mientras se copian las palabras y los lectores
+ * descartan cualquier copia durante la que haya cambiado.
+ *
+ * @param snapshot Snapshot a publicar.
+ */
+void InputSystem::publish(const InputSnapshot& snapshot) {
+    sf::Uint64 words[kWords] = {};
+    std::memcpy(words, &snapshot, sizeof(snapshot));
+
+    sf::Uint32 sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    // Escrituras con release: quien vea una palabra nueva ve también el contador impar.
+    for (std::size_t i = 0; i < kWords; ++i) {
+        m_published[i].store(words[i], std::memory_order_release);
+    }
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+/**
+ * @brief Suelta todas las teclas y botones (por ejemplo, al perder el foco).
+ */
+void InputSystem::releaseAll() {
+    for (int i = 0; i < InputSnapshot::kKeyWords; ++i) {
+        m_state.keysReleased[i] |= m_state.keysDown[i];
+        m_state.keysDown[i] = 0;
+    }
+    m_state.buttonsReleased |= m_state.buttonsDown;
+    m_state.buttonsDown = 0;
+}
@@ -0,0 +1,232 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <atomic>
+#include <fstream>
+#include <type_traits>
+
+/**
+ * @struct InputSnapshot
+ * @brief Estado compacto de la entrada que ve un tick de simulación.
+ *
+ * Teclas y botones se guardan como conjuntos de bits: `Down` es el estado actual y
+ * `Pressed`/`Released` son los flancos ocurridos desde el tick anterior, de modo que una
+ * pulsación breve entre dos ticks no se pierde ni se cuenta dos veces. La estructura es
+ * trivialmente copiable: se publica entre hilos y se graba en disco tal cual.
+ */
+struct InputSnapshot {
+    static constexpr int kKeyWords = (sf::Keyboard::KeyCount + 63) / 64;  ///< Palabras de 64 bits por conjunto de teclas.
+
+    sf::Uint64 keysDown[kKeyWords] = {};      ///< Teclas mantenidas.
+    sf::Uint64 keysPressed[kKeyWords] = {};   ///< Teclas pulsadas desde el tick anterior.
+    sf::Uint64 keysReleased[kKeyWords] = {};  ///< Teclas soltadas desde el tick anterior.
+    sf::Vector2f mousePosition;               ///< Posición del ratón en píxeles de la ventana.
+    sf::Vector2f mouseDelta;                  ///< Desplazamiento del ratón desde el tick anterior.
+    float wheelDelta = 0.0f;                  ///< Giro de la rueda vertical desde el tick anterior.
+    sf::Uint8 buttonsDown = 0;                ///< Botones del ratón mantenidos (bit = `sf::Mouse::Button`).
+    sf::Uint8 buttonsPressed = 0;             ///< Botones pulsados desde el tick anterior.
+    sf::Uint8 buttonsReleased = 0;            ///< Botones soltados desde el tick anterior.
+    bool mouseInside = false;                 ///< El ratón está sobre la ventana (posición válida).
+    bool hasFocus = true;                     ///< La ventana tiene el foco del teclado.
+    sf::Uint64 tick = 0;                      ///< Tick de simulación al que corresponde.
+
+    /**
+     * @brief Indica si una tecla está mantenida.
+     *
+     * @param key Tecla a consultar.
+     * @return true si está pulsada.
+     */
+    bool isKeyDown(sf::Keyboard::Key key) const { return testBit(keysDown, key); }
+
+    /**
+     * @brief Indica si una tecla se pulsó desde el tick anterior.
+     *
+     * @param key Tecla a consultar.
+     * @return true si hubo flanco de bajada.
+     */
+    bool wasKeyPressed(sf::Keyboard::Key key) const { return testBit(keysPressed, key); }
+
+    /**
+     * @brief Indica si una tecla se soltó desde el tick anterior.
+     *
+     * @param key Tecla a consultar.
+     * @return true si hubo flanco de subida.
+     */
+    bool wasKeyReleased(sf::Keyboard::Key key) const { return testBit(keysReleased, key); }
+
+    /**
+     * @brief Indica si un botón del ratón está mantenido.
+     *
+     * @param button Botón a consultar.
+     * @return true si está pulsado.
+     */
+    bool isButtonDown(sf::Mouse::Button button) const { return (buttonsDown >> button) & 1u; }
+
+    /**
+     * @brief Indica si un botón del ratón se pulsó desde el tick anterior.
+     *
+     * @param button Botón a consultar.
+     * @return true si hubo flanco de bajada.
+     */
+    bool wasButtonPressed(sf::Mouse::Button button) const { return (buttonsPressed >> button) & 1u; }
+
+    /**
+     * @brief Número de teclas mantenidas.
+     *
+     * @return Bits activos en `keysDown`.
+     */
+    int countKeysDown() const;
+
+private:
+    /**
+     * @brief Lee el bit de una tecla en un conjunto.
+     *
+     * @param bits Conjunto de teclas.
+     * @param key Tecla a consultar (las desconocidas devuelven false).
+     * @return true si el bit está activo.
+     */
+    static bool testBit(const sf::Uint64* bits, sf::Keyboard::Key key) {
+        if (key < 0 || key >= sf::Keyboard::KeyCount) return false;
+        return (bits[key / 64] >> (key % 64)) & 1u;
+    }
+};
+
+static_assert(std::is_trivially_copyable<InputSnapshot>::value,
+              "InputSnapshot se publica y se graba copiando sus bytes");
+
+/**
+ * @class InputSystem
+ * @brief Convierte los eventos de la ventana en un `InputSnapshot` por tick.
+ *
+ * Flujo por frame, en el hilo principal:
+ * 1. `processEvents` recorre de una vez el lote de eventos del frame (`Window::getFrameEvents`)
+ *    y acumula teclas, botones, rueda y movimiento del ratón. No se consulta al sistema
+ *    operativo (`sf::Mouse::getPosition`): todo sale de los eventos.
+ * 2. Cada tick de simulación llama a `consumeTick`, que entrega el estado acumulado y
+ *    limpia los flancos y deltas para el tick siguiente.
+ *
+ * El snapshot entregado se publica con un seqlock: cualquier otro hilo (trabajadores,
+ * hilo de render) puede leerlo con `readLatest` sin candados ni esperas del escritor.
+ *
+ * Grabación y reproducción: con `startRecording` cada snapshot entregado se escribe en
+ * un archivo binario; con `startReplay` los ticks reciben los snapshots grabados en lugar
+ * de la entrada real. Como la simulación avanza a paso fijo, una partida reproducida con
+ * el mismo `--tick-rate` recorre exactamente los mismos estados (también en `--headless`).
+ */
+class InputSystem {
+public:
+    /**
+     * @brief Constructor por defecto.
+     */
+    InputSystem();
+
+    /**
+     * @brief Destructor. Cierra la grabación si sigue abierta.
+     */
+    ~InputSystem();
+
+    InputSystem(const InputSystem&) = delete;
+    InputSystem& operator=(const InputSystem&) = delete;
+
+    /**
+     * @brief Acumula el lote de eventos de un frame.
+     *
+     * @param events Eventos sacados de la ventana en este frame.
+     */
+    void processEvents(const std::vector<sf::Event>& events);
+
+    /**
+     * @brief Entrega la entrada de un tick de simulación.
+     *
+     * Devuelve el estado acumulado (o el grabado, si se está reproduciendo), lo graba si
+     * corresponde, lo publica para los demás hilos y limpia flancos y deltas.
+     *
+     * @return Snapshot que debe usar este tick.
+     */
+    InputSnapshot consumeTick();
+
+    /**
+     * @brief Último snapshot entregado a la simulación, leído desde cualquier hilo.
+     *
+     * Lectura sin candados: si coincide con una publicación, reintenta hasta obtener una
+     * copia coherente.
+     *
+     * @return Copia del último snapshot publicado.
+     */
+    InputSnapshot readLatest() const;
+
+    /**
+     * @brief Empieza a grabar los snapshots entregados a la simulación.
+     *
+     * @param path Archivo de salida.
+     * @return false si no se pudo abrir el archivo.
+     */
+    bool startRecording(const std::string& path);
+
+    /**
+     * @brief Carga una grabación y la entrega a los ticks siguientes.
+     *
+     * Al terminar la grabación se vuelve a la entrada real.
+     *
+     * @param path Archivo grabado con `startRecording`.
+     * @return false si el archivo no existe o no es compatible con este build.
+     */
+    bool startReplay(const std::string& path);
+
+    /**
+     * @brief Termina la grabación o la reproducción en curso.
+     */
+    void stop();
+
+    /**
+     * @brief Indica si se está grabando.
+     *
+     * @return true entre `startRecording` y `stop`.
+     */
+    bool isRecording() const;
+
+    /**
+     * @brief Indica si se está reproduciendo una grabación.
+     *
+     * @return true mientras queden snapshots grabados por entregar.
+     */
+    bool isReplaying() const;
+
+private:
+    /**
+     * @brief Publica un snapshot para `readLatest` (un solo escritor).
+     *
+     * @param snapshot Snapshot a publicar.
+     */
+    void publish(const InputSnapshot& snapshot);
+
+    /**
+     * @brief Suelta todas las teclas y botones (por ejemplo, al perder el foco).
+     */
+    void releaseAll();
+
+    /**
+     * @struct FileHeader
+     * @brief Encabezado de un archivo de grabación.
+     */
+    struct FileHeader {
+        char magic[4];            ///< "MGIN".
+        sf::Uint32 version;       ///< Versión del formato.
+        sf::Uint32 snapshotSize;  ///< `sizeof(InputSnapshot)` del build que grabó.
+    };
+
+    static constexpr sf::Uint32 kFileVersion = 1;  ///< Versión actual del formato.
+    static constexpr std::size_t kWords = (sizeof(InputSnapshot) + 7) / 8;  ///< Palabras del seqlock.
+
+    InputSnapshot m_state;                        ///< Estado acumulado desde el último tick (hilo principal).
+    sf::Uint64 m_tick = 0;                        ///< Ticks entregados.
+
+    std::atomic<sf::Uint32> m_sequence{ 0 };      ///< Contador del seqlock (impar = publicando).
+    std::atomic<sf::Uint64> m_published[kWords];  ///< Último snapshot publicado, palabra por palabra.
+
+    std::ofstream m_recordFile;                   ///< Grabación en curso.
+    std::vector<InputSnapshot> m_replay;          ///< Snapshots por reproducir.
+    std::size_t m_replayIndex = 0;                ///< Siguiente snapshot por reproducir.
+};
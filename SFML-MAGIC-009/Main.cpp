@@ -1,7 +1,7 @@
 #include "BaseApp.h"
 
-int main()
+int main(int argc, char** argv)
 {
-    BaseApp app;
+    BaseApp app(AppConfig::fromCommandLine(argc, argv));
     return app.run();
-}
\ No newline at end of file
+}
@@ -0,0 +1,130 @@
+#include "MemoryStats.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<sf::Uint64> g_allocationCount{ 0 };  ///< Reservas desde el arranque.
+    std::atomic<sf::Uint64> g_freeCount{ 0 };        ///< Liberaciones desde el arranque.
+    std::atomic<sf::Uint64> g_allocatedBytes{ 0 };   ///< Bytes pedidos desde el arranque.
+
+    /**
+     * @brief Reserva con `malloc` y cuenta la reserva.
+     *
+     * Sigue el contrato de `operator new`: llama al `new_handler` mientras no haya
+     * memoria y lanza `std::bad_alloc` si no hay ninguno.
+     *
+     * @param size Bytes pedidos.
+     * @return Memoria reservada.
+     */
+    void* countedAllocate(std::size_t size) {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (size == 0) {
+            size = 1;
+        }
+        while (true) {
+            void* memory = std::malloc(size);
+            if (memory != nullptr) {
+                return memory;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+    /**
+     * @brief Libera con `free` y cuenta la liberación.
+     *
+     * @param memory Memoria reservada por `countedAllocate` (o nullptr).
+     */
+    void countedFree(void* memory) noexcept {
+        if (memory != nullptr) {
+            g_freeCount.fetch_add(1, std::memory_order_relaxed);
+            std::free(memory);
+        }
+    }
+}
+
+/**
+ * @brief Reservas hechas desde el arranque.
+ *
+ * @return Llamadas a `new` y `new[]`.
+ */
+sf::Uint64 MemoryStats::getAllocationCount() {
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Liberaciones hechas desde el arranque.
+ *
+ * @return Llamadas a `delete` y `delete[]` con un puntero no nulo.
+ */
+sf::Uint64 MemoryStats::getFreeCount() {
+    return g_freeCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Bytes pedidos desde el arranque.
+ *
+ * @return Suma de los tamaños de todas las reservas.
+ */
+sf::Uint64 MemoryStats::getAllocatedBytes() {
+    return g_allocatedBytes.load(std::memory_order_relaxed);
+}
+
+// Reemplazos globales. Las variantes alineadas (C++17) no se reemplazan y no se cuentan.
+
+void* operator new(std::size_t size) {
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAllocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return countedAllocate(size);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return countedAllocate(size);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* memory) noexcept {
+    countedFree(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    countedFree(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    countedFree(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    countedFree(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    countedFree(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    countedFree(memory);
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+
+/**
+ * @class MemoryStats
+ * @brief Contadores globales de reservas de memoria dinámica.
+ *
+ * `MemoryStats.cpp` reemplaza los `operator new`/`operator delete` globales para contar
+ * cada reserva y liberación de cualquier hilo con contadores atómicos. Los valores son
+ * acumulados desde el arranque: para obtener reservas por frame se restan dos lecturas.
+ */
+class MemoryStats {
+public:
+    /**
+     * @brief Reservas hechas desde el arranque.
+     *
+     * @return Llamadas a `new` y `new[]`.
+     */
+    static sf::Uint64 getAllocationCount();
+
+    /**
+     * @brief Liberaciones hechas desde el arranque.
+     *
+     * @return Llamadas a `delete` y `delete[]` con un puntero no nulo.
+     */
+    static sf::Uint64 getFreeCount();
+
+    /**
+     * @brief Bytes pedidos desde el arranque.
+     *
+     * @return Suma de los tamaños de todas las reservas.
+     */
+    static sf::Uint64 getAllocatedBytes();
+};
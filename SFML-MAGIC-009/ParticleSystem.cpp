@@ -0,0 +1,251 @@
+#include "ParticleSystem.h"
+#include "Profiler.h"
+
+/**
+ * @brief Constructor.
+ *
+ * Reserva todos los arreglos de una vez para que emitir nunca reserve memoria.
+ *
+ * @param capacity Número máximo de partículas vivas.
+ */
+ParticleSystem::ParticleSystem(std::size_t capacity)
+    : Component(ComponentType::PARTICLES), m_capacity(capacity) {
+    m_posX.resize(capacity);
+    m_posY.resize(capacity);
+    m_velX.resize(capacity);
+    m_velY.resize(capacity);
+    m_age.resize(capacity);
+    m_ageRate.resize(capacity);
+    m_vertices.reserve(capacity * 6);
+}
+
+/**
+ * @brief Simula las partículas, elimina las muertas y genera los vértices del frame.
+ *
+ * Cada fase es un bucle independiente sobre arreglos contiguos para que sea fácil de
+ * vectorizar: integración (Euler semi-implícito con frenado), envejecimiento,
+ * compactación de las muertas y generación de vértices.
+ *
+ * @param deltaTime Tiempo transcurrido desde la última actualización.
+ */
+void ParticleSystem::update(float deltaTime) {
+    PROFILE_SCOPE("ParticleSystem::update");
+
+    // Emisión continua: acumula fracciones para que la tasa no dependa del frame rate.
+    if (m_emissionRate > 0.0f) {
+        m_emissionAccumulator += m_emissionRate * deltaTime;
+        std::size_t toEmit = static_cast<std::size_t>(m_emissionAccumulator);
+        m_emissionAccumulator -= static_cast<float>(toEmit);
+        emit(m_emitterPosition, m_emitterDirection, toEmit);
+    }
+
+    const std::size_t count = m_count;
+    const float damping = std::max(0.0f, 1.0f - m_settings.drag * deltaTime);
+
+    float* __restrict posX = m_posX.data();
+    float* __restrict posY = m_posY.data();
+    float* __restrict velX = m_velX.data();
+    float* __restrict velY = m_velY.data();
+    float* __restrict age = m_age.data();
+    const float* __restrict ageRate = m_ageRate.data();
+
+    // Integración.
+    for (std::size_t i = 0; i < count; ++i) {
+        velX[i] *= damping;
+        velY[i] *= damping;
+        posX[i] += velX[i] * deltaTime;
+        posY[i] += velY[i] * deltaTime;
+    }
+
+    // Envejecimiento.
+    for (std::size_t i = 0; i < count; ++i) {
+        age[i] += ageRate[i] * deltaTime;
+    }
+
+    // Compactación: la última partícula viva ocupa el hueco de la que muere.
+    std::size_t alive = count;
+    for (std::size_t i = 0; i < alive;) {
+        if (age[i] >= 1.0f) {
+            --alive;
+            posX[i] = posX[alive];
+            posY[i] = posY[alive];
+            velX[i] = velX[alive];
+            velY[i] = velY[alive];
+            age[i] = age[alive];
+            m_ageRate[i] = m_ageRate[alive];
+        }
+        else {
+            ++i;
+        }
+    }
+    m_count = alive;
+
+    buildVertices();
+}
+
+/**
+ * @brief Dibuja todas las partículas con una sola llamada.
+ *
+ * @param window Ventana donde se renderizan las partículas.
+ */
+void ParticleSystem::render(Window& window) {
+    if (m_vertices.empty()) {
+        return;
+    }
+
+    sf::RenderStates states;
+    states.texture = m_texture;
+    window.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states);
+}
+
+/**
+ * @brief Emite una ráfaga de partículas.
+ *
+ * @param position Punto de emisión en coordenadas del mundo.
+ * @param direction Dirección central de emisión.
+ * @param count Número de partículas a emitir.
+ */
+void ParticleSystem::emit(const sf::Vector2f& position, const sf::Vector2f& direction, std::size_t count) {
+    count = std::min(count, m_capacity - m_count);
+    if (count == 0) {
+        return;
+    }
+
+    const float pi = 3.141592654f;
+    const float baseAngle = (direction.x != 0.0f || direction.y != 0.0f)
+        ? std::atan2(direction.y, direction.x)
+        : random01() * 2.0f * pi;
+    const float spread = m_settings.spreadDegrees * pi / 180.0f;
+
+    for (std::size_t n = 0; n < count; ++n) {
+        const std::size_t i = m_count++;
+        float angle = baseAngle + (random01() - 0.5f) * spread;
+        float speed = m_settings.speedMin + (m_settings.speedMax - m_settings.speedMin) * random01();
+        float lifetime = m_settings.lifetimeMin + (m_settings.lifetimeMax - m_settings.lifetimeMin) * random01();
+
+        m_posX[i] = position.x;
+        m_posY[i] = position.y;
+        m_velX[i] = std::cos(angle) * speed;
+        m_velY[i] = std::sin(angle) * speed;
+        m_age[i] = 0.0f;
+        m_ageRate[i] = 1.0f / std::max(lifetime, 0.001f);
+    }
+}
+
+/**
+ * @brief Coloca el emisor continuo.
+ *
+ * @param position Punto de emisión.
+ * @param direction Dirección central de emisión.
+ */
+void ParticleSystem::setEmitter(const sf::Vector2f& position, const sf::Vector2f& direction) {
+    m_emitterPosition = position;
+    m_emitterDirection = direction;
+}
+
+/**
+ * @brief Define la tasa del emisor continuo.
+ *
+ * @param particlesPerSecond Partículas por segundo.
+ */
+void ParticleSystem::setEmissionRate(float particlesPerSecond) {
+    m_emissionRate = std::max(0.0f, particlesPerSecond);
+}
+
+/**
+ * @brief Cambia los parámetros de emisión y apariencia.
+ *
+ * @param settings Nuevos parámetros.
+ */
+void ParticleSystem::setSettings(const Settings& settings) {
+    m_settings = settings;
+}
+
+/**
+ * @brief Asigna la textura de los sprites.
+ *
+ * @param texture Textura completa que se aplica a cada sprite.
+ */
+void ParticleSystem::setTexture(const sf::Texture* texture) {
+    m_texture = texture;
+}
+
+/**
+ * @brief Número de partículas vivas.
+ *
+ * @return Partículas vivas.
+ */
+std::size_t ParticleSystem::getParticleCount() const {
+    return m_count;
+}
+
+/**
+ * @brief Capacidad máxima del sistema.
+ *
+ * @return Número máximo de partículas vivas.
+ */
+std::size_t ParticleSystem::getCapacity() const {
+    return m_capacity;
+}
+
+/**
+ * @brief Genera un número pseudoaleatorio en [0, 1).
+ *
+ * @return Valor aleatorio.
+ */
+float ParticleSystem::random01() {
+    m_randomState ^= m_randomState << 13;
+    m_randomState ^= m_randomState >> 17;
+    m_randomState ^= m_randomState << 5;
+    return static_cast<float>(m_randomState >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Escribe 6 vértices (dos triángulos) por partícula viva.
+ *
+ * El tamaño y el color se interpolan linealmente con la edad; el cuerpo del bucle no
+ * tiene ramas.
+ */
+void ParticleSystem::buildVertices() {
+    const std::size_t count = m_count;
+    m_vertices.resize(count * 6);
+
+    const float* __restrict posX = m_posX.data();
+    const float* __restrict posY = m_posY.data();
+    const float* __restrict age = m_age.data();
+    sf::Vertex* __restrict out = m_vertices.data();
+
+    const Settings& s = m_settings;
+    const float sizeDelta = s.sizeEnd - s.sizeStart;
+    const float r0 = s.colorStart.r, dr = static_cast<float>(s.colorEnd.r) - s.colorStart.r;
+    const float g0 = s.colorStart.g, dg = static_cast<float>(s.colorEnd.g) - s.colorStart.g;
+    const float b0 = s.colorStart.b, db = static_cast<float>(s.colorEnd.b) - s.colorStart.b;
+    const float a0 = s.colorStart.a, da = static_cast<float>(s.colorEnd.a) - s.colorStart.a;
+
+    float texW = 0.0f;
+    float texH = 0.0f;
+    if (m_texture != nullptr) {
+        texW = static_cast<float>(m_texture->getSize().x);
+        texH = static_cast<float>(m_texture->getSize().y);
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float t = age[i];
+        const float half = (s.sizeStart + sizeDelta * t) * 0.5f;
+        const sf::Color color(static_cast<sf::Uint8>(r0 + dr * t), static_cast<sf::Uint8>(g0 + dg * t),
+                              static_cast<sf::Uint8>(b0 + db * t), static_cast<sf::Uint8>(a0 + da * t));
+
+        const float left = posX[i] - half;
+        const float right = posX[i] + half;
+        const float top = posY[i] - half;
+        const float bottom = posY[i] + half;
+
+        sf::Vertex* quad = out + i * 6;
+        quad[0] = sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(0.0f, 0.0f));
+        quad[1] = sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(texW, 0.0f));
+        quad[2] = sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(texW, texH));
+        quad[3] = quad[0];
+        quad[4] = quad[2];
+        quad[5] = sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(0.0f, texH));
+    }
+}
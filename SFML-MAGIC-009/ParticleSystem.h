@@ -0,0 +1,148 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "Component.h"      // Define la clase base Component.
+#include "Window.h"         // Clase para gestionar la ventana principal.
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+/**
+ * @class ParticleSystem
+ * @brief Componente de partículas para miles de sprites pequeños (polvo, chispas, humo).
+ *
+ * Las partículas se guardan como estructura de arreglos (SoA): posición, velocidad y edad
+ * viven en arreglos contiguos de `float`, de modo que la simulación y la generación de
+ * vértices son bucles simples sin ramas que el compilador puede vectorizar. Cada frame
+ * se genera un único arreglo de vértices y todo el sistema se dibuja con una sola llamada.
+ *
+ * Las partículas viven en coordenadas del mundo: la transformación del actor no se aplica.
+ */
+class ParticleSystem : public Component {
+public:
+    /**
+     * @struct Settings
+     * @brief Parámetros de emisión y apariencia de las partículas.
+     */
+    struct Settings {
+        float lifetimeMin = 0.6f;     ///< Vida mínima en segundos.
+        float lifetimeMax = 1.2f;     ///< Vida máxima en segundos.
+        float speedMin = 10.0f;       ///< Rapidez inicial mínima (píxeles por segundo).
+        float speedMax = 40.0f;       ///< Rapidez inicial máxima.
+        float spreadDegrees = 35.0f;  ///< Apertura del cono de emisión alrededor de la dirección.
+        float drag = 1.5f;            ///< Frenado por segundo (0 = sin frenado).
+        float sizeStart = 4.0f;       ///< Lado del sprite al nacer.
+        float sizeEnd = 14.0f;        ///< Lado del sprite al morir.
+        sf::Color colorStart = sf::Color(210, 210, 210, 170);  ///< Color al nacer.
+        sf::Color colorEnd = sf::Color(120, 120, 120, 0);      ///< Color al morir.
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param capacity Número máximo de partículas vivas (las emisiones extra se descartan).
+     */
+    explicit ParticleSystem(std::size_t capacity = 4096);
+
+    /**
+     * @brief Destructor virtual por defecto.
+     */
+    virtual ~ParticleSystem() = default;
+
+    /**
+     * @brief Simula las partículas, elimina las muertas y genera los vértices del frame.
+     *
+     * @param deltaTime Tiempo transcurrido desde la última actualización.
+     */
+    void update(float deltaTime) override;
+
+    /**
+     * @brief Dibuja todas las partículas con una sola llamada.
+     *
+     * @param window Ventana donde se renderizan las partículas.
+     */
+    void render(Window& window) override;
+
+    /**
+     * @brief Emite una ráfaga de partículas.
+     *
+     * @param position Punto de emisión en coordenadas del mundo.
+     * @param direction Dirección central de emisión (no necesita estar normalizada).
+     * @param count Número de partículas a emitir.
+     */
+    void emit(const sf::Vector2f& position, const sf::Vector2f& direction, std::size_t count);
+
+    /**
+     * @brief Coloca el emisor continuo.
+     *
+     * @param position Punto de emisión en coordenadas del mundo.
+     * @param direction Dirección central de emisión.
+     */
+    void setEmitter(const sf::Vector2f& position, const sf::Vector2f& direction);
+
+    /**
+     * @brief Define cuántas partículas por segundo emite el emisor continuo.
+     *
+     * @param particlesPerSecond Tasa de emisión (0 lo desactiva).
+     */
+    void setEmissionRate(float particlesPerSecond);
+
+    /**
+     * @brief Cambia los parámetros de emisión y apariencia.
+     *
+     * @param settings Nuevos parámetros (afectan a las partículas emitidas desde ahora).
+     */
+    void setSettings(const Settings& settings);
+
+    /**
+     * @brief Asigna la textura de los sprites (puede ser `nullptr` para cuadros sólidos).
+     *
+     * @param texture Textura completa que se aplica a cada sprite.
+     */
+    void setTexture(const sf::Texture* texture);
+
+    /**
+     * @brief Número de partículas vivas.
+     *
+     * @return Partículas que se dibujarán este frame.
+     */
+    std::size_t getParticleCount() const;
+
+    /**
+     * @brief Capacidad máxima del sistema.
+     *
+     * @return Número máximo de partículas vivas.
+     */
+    std::size_t getCapacity() const;
+
+private:
+    /**
+     * @brief Genera un número pseudoaleatorio en [0, 1) (xorshift32, determinista).
+     *
+     * @return Valor aleatorio.
+     */
+    float random01();
+
+    /**
+     * @brief Escribe 6 vértices (dos triángulos) por partícula viva.
+     */
+    void buildVertices();
+
+    Settings m_settings;             ///< Parámetros de emisión y apariencia.
+    std::size_t m_capacity;          ///< Máximo de partículas vivas.
+    std::size_t m_count = 0;         ///< Partículas vivas (ocupan los índices [0, m_count)).
+
+    std::vector<float> m_posX;       ///< Posición X de cada partícula.
+    std::vector<float> m_posY;       ///< Posición Y de cada partícula.
+    std::vector<float> m_velX;       ///< Velocidad X de cada partícula.
+    std::vector<float> m_velY;       ///< Velocidad Y de cada partícula.
+    std::vector<float> m_age;        ///< Edad normalizada (0 al nacer, 1 al morir).
+    std::vector<float> m_ageRate;    ///< Inverso de la vida de cada partícula.
+
+    std::vector<sf::Vertex> m_vertices;  ///< Vértices del frame (sf::Triangles).
+    const sf::Texture* m_texture = nullptr;  ///< Textura de los sprites.
+
+    sf::Vector2f m_emitterPosition;  ///< Posición del emisor continuo.
+    sf::Vector2f m_emitterDirection; ///< Dirección del emisor continuo.
+    float m_emissionRate = 0.0f;     ///< Partículas por segundo del emisor continuo.
+    float m_emissionAccumulator = 0.0f;  ///< Fracción de partícula pendiente de emitir.
+    sf::Uint32 m_randomState = 0x9E3779B9u;  ///< Estado del generador xorshift.
+};
@@ -0,0 +1,134 @@
+#include "PathFollower.h"
+#include "ThreadPool.h"
+
+/**
+ * @brief Constructor.
+ *
+ * @param path Ruta compartida a recorrer.
+ * @param speed Rapidez en píxeles por segundo.
+ * @param startDistance Distancia inicial desde el primer waypoint.
+ */
+PathFollower::PathFollower(EngineUtilities::TSharedPointer<WaypointPath> path, float speed, float startDistance)
+    : Component(ComponentType::PATH), m_path(path), m_progress(path->progressAt(startDistance)), m_speed(speed) {
+}
+
+/**
+ * @brief Avanza `speed * deltaTime` sobre la ruta.
+ *
+ * @param deltaTime Duración del tick en segundos.
+ */
+void PathFollower::update(float deltaTime) {
+    m_path->advance(m_progress, m_speed * deltaTime);
+}
+
+/**
+ * @brief Lleva el avance al punto de la ruta más cercano a una posición.
+ *
+ * @param position Posición actual del actor.
+ */
+void PathFollower::rejoin(const sf::Vector2f& position) {
+    m_progress = m_path->closestProgress(position);
+}
+
+/**
+ * @brief Constructor.
+ *
+ * @param path Ruta compartida por todos los agentes.
+ */
+PathCrowd::PathCrowd(EngineUtilities::TSharedPointer<WaypointPath> path)
+    : m_path(path) {
+}
+
+/**
+ * @brief Constructor sobre una línea de carrera suave.
+ *
+ * @param line Línea compartida por todos los agentes.
+ */
+PathCrowd::PathCrowd(EngineUtilities::TSharedPointer<RacingLine> line)
+    : m_line(line) {
+}
+
+/**
+ * @brief Agrega un agente.
+ *
+ * @param startDistance Distancia inicial desde el primer waypoint.
+ * @param speed Rapidez en píxeles por segundo.
+ * @return Índice del agente.
+ */
+std::size_t PathCrowd::addAgent(float startDistance, float speed) {
+    PathProgress progress;
+    sf::Vector2f position;
+    if (!m_line.isNull()) {
+        progress.distance = m_line->wrapDistance(startDistance);
+        position = m_line->getPosition(progress.distance);
+    }
+    else {
+        progress = m_path->progressAt(startDistance);
+        position = m_path->getPosition(progress);
+    }
+    m_progress.push_back(progress);
+    m_speed.push_back(speed);
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    return m_progress.size() - 1;
+}
+
+/**
+ * @brief Dirección de la ruta donde está un agente.
+ *
+ * @param index Índice del agente.
+ * @return Vector unitario de avance.
+ */
+sf::Vector2f PathCrowd::getDirection(std::size_t index) const {
+    if (!m_line.isNull()) {
+        return m_line->sample(m_progress[index].distance).tangent;
+    }
+    return m_path->getDirection(m_progress[index]);
+}
+
+/**
+ * @brief Avanza todos los agentes un tick.
+ *
+ * @param deltaTime Duración del tick en segundos.
+ * @param pool Hilos para repartir el lote (nullptr = en el hilo actual).
+ */
+void PathCrowd::update(float deltaTime, ThreadPool* pool) {
+    // Por debajo de un bloque no compensa despertar a los hilos.
+    const std::size_t grain = 2048;
+    if (pool == nullptr || m_progress.size() <= grain) {
+        updateRange(0, m_progress.size(), deltaTime);
+        return;
+    }
+    pool->parallelFor(m_progress.size(), [this, deltaTime](std::size_t begin, std::size_t end) {
+        updateRange(begin, end, deltaTime);
+    }, grain);
+}
+
+/**
+ * @brief Avanza un rango de agentes.
+ *
+ * @param begin Primer agente.
+ * @param end Uno más allá del último agente.
+ * @param deltaTime Duración del tick en segundos.
+ */
+void PathCrowd::updateRange(std::size_t begin, std::size_t end, float deltaTime) {
+    if (!m_line.isNull()) {
+        // Línea suave: solo la distancia importa; la posición sale de la tabla en O(1).
+        const RacingLine& line = *m_line;
+        for (std::size_t i = begin; i < end; ++i) {
+            float distance = line.wrapDistance(m_progress[i].distance + m_speed[i] * deltaTime);
+            m_progress[i].distance = distance;
+            sf::Vector2f position = line.getPosition(distance);
+            m_positionX[i] = position.x;
+            m_positionY[i] = position.y;
+        }
+        return;
+    }
+
+    const WaypointPath& path = *m_path;
+    for (std::size_t i = begin; i < end; ++i) {
+        sf::Vector2f position = path.advance(m_progress[i], m_speed[i] * deltaTime);
+        m_positionX[i] = position.x;
+        m_positionY[i] = position.y;
+    }
+}
@@ -0,0 +1,203 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "Component.h"      // Define la clase base Component.
+#include "WaypointPath.h"   // Ruta compartida y avance por agente.
+#include "RacingLine.h"     // Línea de carrera suave con tabla de longitud de arco.
+
+class ThreadPool;
+
+/**
+ * @class PathFollower
+ * @brief Componente que recorre un `WaypointPath` compartido a rapidez constante.
+ *
+ * El componente solo guarda su avance (`PathProgress`) y su rapidez; la ruta es la misma
+ * instancia para todos los agentes. Cada `update` avanza por longitud de arco y deja la
+ * posición resultante en `getPosition`: quien controla el actor decide cómo aplicarla a
+ * su `Transform` (por ejemplo, reincorporarse a la ruta tras un desvío).
+ *
+ * Para miles de agentes conviene `PathCrowd`, que guarda lo mismo en arreglos contiguos.
+ */
+class PathFollower : public Component {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param path Ruta compartida a recorrer.
+     * @param speed Rapidez en píxeles por segundo.
+     * @param startDistance Distancia inicial desde el primer waypoint.
+     */
+    PathFollower(EngineUtilities::TSharedPointer<WaypointPath> path, float speed, float startDistance = 0.0f);
+
+    /**
+     * @brief Destructor virtual por defecto.
+     */
+    virtual ~PathFollower() = default;
+
+    /**
+     * @brief Avanza `speed * deltaTime` sobre la ruta.
+     *
+     * @param deltaTime Duración del tick en segundos.
+     */
+    void update(float deltaTime) override;
+
+    /**
+     * @brief No dibuja nada: la forma del actor se encarga.
+     */
+    void render(Window&) override {}
+
+    /**
+     * @brief Lleva el avance al punto de la ruta más cercano a una posición.
+     *
+     * @param position Posición actual del actor.
+     */
+    void rejoin(const sf::Vector2f& position);
+
+    /**
+     * @brief Posición sobre la ruta tras el último avance.
+     *
+     * @return Punto de la ruta.
+     */
+    sf::Vector2f getPosition() const { return m_path->getPosition(m_progress); }
+
+    /**
+     * @brief Dirección de la ruta en el avance actual.
+     *
+     * @return Vector unitario del tramo actual.
+     */
+    sf::Vector2f getDirection() const { return m_path->getDirection(m_progress); }
+
+    /**
+     * @brief Avance actual.
+     *
+     * @return Tramo y distancia recorrida.
+     */
+    const PathProgress& getProgress() const { return m_progress; }
+
+    /**
+     * @brief Cambia la rapidez.
+     *
+     * @param speed Rapidez en píxeles por segundo.
+     */
+    void setSpeed(float speed) { m_speed = speed; }
+
+    /**
+     * @brief Rapidez actual.
+     *
+     * @return Rapidez en píxeles por segundo.
+     */
+    float getSpeed() const { return m_speed; }
+
+private:
+    EngineUtilities::TSharedPointer<WaypointPath> m_path;  ///< Ruta compartida.
+    PathProgress m_progress;                               ///< Avance de este agente.
+    float m_speed;                                         ///< Rapidez en píxeles por segundo.
+};
+
+/**
+ * @class PathCrowd
+ * @brief Muchos agentes sobre la misma ruta, actualizados en una sola pasada paralela.
+ *
+ * Por agente solo se guardan su avance (8 bytes) y su rapidez; la posición resultante de
+ * cada tick se escribe en arreglos SoA (`getPositionsX`/`getPositionsY`) que se pueden
+ * copiar a las formas o pasar a otros sistemas por lotes. Cada agente se actualiza de
+ * forma independiente, así que el lote se reparte entre los hilos de un `ThreadPool`.
+ *
+ * La ruta puede ser la polilínea de waypoints o una `RacingLine` suave; con esta última
+ * cada agente solo muestrea su tabla de longitud de arco (el tramo de `PathProgress` no
+ * se usa).
+ */
+class PathCrowd {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param path Ruta compartida por todos los agentes.
+     */
+    explicit PathCrowd(EngineUtilities::TSharedPointer<WaypointPath> path);
+
+    /**
+     * @brief Constructor sobre una línea de carrera suave.
+     *
+     * @param line Línea compartida por todos los agentes.
+     */
+    explicit PathCrowd(EngineUtilities::TSharedPointer<RacingLine> line);
+
+    /**
+     * @brief Agrega un agente.
+     *
+     * @param startDistance Distancia inicial desde el primer waypoint.
+     * @param speed Rapidez en píxeles por segundo.
+     * @return Índice del agente.
+     */
+    std::size_t addAgent(float startDistance, float speed);
+
+    /**
+     * @brief Avanza todos los agentes un tick.
+     *
+     * @param deltaTime Duración del tick en segundos.
+     * @param pool Hilos para repartir el lote (nullptr = en el hilo actual).
+     */
+    void update(float deltaTime, ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Número de agentes.
+     *
+     * @return Agentes agregados.
+     */
+    std::size_t size() const { return m_progress.size(); }
+
+    /**
+     * @brief Posición de un agente tras el último `update`.
+     *
+     * @param index Índice del agente.
+     * @return Punto de la ruta.
+     */
+    sf::Vector2f getPosition(std::size_t index) const { return sf::Vector2f(m_positionX[index], m_positionY[index]); }
+
+    /**
+     * @brief Dirección de la ruta donde está un agente.
+     *
+     * @param index Índice del agente.
+     * @return Vector unitario del tramo del agente.
+     */
+    sf::Vector2f getDirection(std::size_t index) const;
+
+    /**
+     * @brief Avance de un agente.
+     *
+     * @param index Índice del agente.
+     * @return Tramo y distancia recorrida.
+     */
+    const PathProgress& getProgress(std::size_t index) const { return m_progress[index]; }
+
+    /**
+     * @brief Coordenadas X de todos los agentes.
+     *
+     * @return Arreglo contiguo con una entrada por agente.
+     */
+    const std::vector<float>& getPositionsX() const { return m_positionX; }
+
+    /**
+     * @brief Coordenadas Y de todos los agentes.
+     *
+     * @return Arreglo contiguo con una entrada por agente.
+     */
+    const std::vector<float>& getPositionsY() const { return m_positionY; }
+
+private:
+    /**
+     * @brief Avanza un rango de agentes.
+     *
+     * @param begin Primer agente.
+     * @param end Uno más allá del último agente.
+     * @param deltaTime Duración del tick en segundos.
+     */
+    void updateRange(std::size_t begin, std::size_t end, float deltaTime);
+
+    EngineUtilities::TSharedPointer<WaypointPath> m_path;  ///< Ruta compartida (nula si se usa `m_line`).
+    EngineUtilities::TSharedPointer<RacingLine> m_line;    ///< Línea de carrera compartida (nula si se usa `m_path`).
+    std::vector<PathProgress> m_progress;                  ///< Avance de cada agente.
+    std::vector<float> m_speed;                            ///< Rapidez de cada agente.
+    std::vector<float> m_positionX;                        ///< Posición X tras el último tick.
+    std::vector<float> m_positionY;                        ///< Posición Y tras el último tick.
+};
@@ -0,0 +1,575 @@
+#include "PathfindingService.h"
+#include "Profiler.h"
+#include "TrackMask.h"
+#include <limits>
+
+namespace {
+    constexpr sf::Uint8 kBlocked = 255;  // Costo de paso de una celda intransitable.
+
+    // Vecinos: 4 ortogonales y luego 4 diagonales (el mismo orden que `FlowField`).
+    constexpr int kOffsetX[8] = { 1, 0, -1, 0, 1, -1, -1, 1 };
+    constexpr int kOffsetY[8] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+    constexpr float kStep[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.41421356f, 1.41421356f, 1.41421356f, 1.41421356f };
+
+    /**
+     * @brief Comparador del montículo mínimo de la frontera (por f, luego por celda).
+     */
+    struct GreaterEntry {
+        bool operator()(const std::pair<float, sf::Uint32>& a, const std::pair<float, sf::Uint32>& b) const {
+            return a > b;
+        }
+    };
+}
+
+/**
+ * @brief Constructor. Lee el suelo de la máscara y arranca los hilos de trabajo.
+ *
+ * @param bounds Rectángulo del mundo que cubre la rejilla.
+ * @param cellSize Lado de cada celda.
+ * @param mask Máscara de la pista (nula o vacía = todo es asfalto).
+ * @param workerCount Hilos de trabajo (0 = solo en `update`).
+ * @param cacheCapacity Rutas que guarda el caché.
+ * @param offRoadCost Costo relativo de una celda fuera de pista.
+ */
+PathfindingService::PathfindingService(const sf::FloatRect& bounds, float cellSize, const TrackMask* mask,
+                                       unsigned int workerCount, std::size_t cacheCapacity, float offRoadCost)
+    : m_origin(bounds.left, bounds.top),
+      m_cellSize(std::max(cellSize, 1.0f)),
+      m_inverseCellSize(1.0f / std::max(cellSize, 1.0f)),
+      m_cacheCapacity(std::max<std::size_t>(1, cacheCapacity)) {
+    m_columns = static_cast<sf::Uint32>(std::max(1.0f, std::ceil(bounds.width * m_inverseCellSize)));
+    m_rows = static_cast<sf::Uint32>(std::max(1.0f, std::ceil(bounds.height * m_inverseCellSize)));
+
+    const sf::Uint8 offRoad = static_cast<sf::Uint8>(std::max(1.0f, std::min(254.0f, std::round(offRoadCost))));
+    const bool hasMask = mask != nullptr && !mask->isEmpty();
+    m_ground.resize(static_cast<std::size_t>(m_columns) * m_rows);
+    for (sf::Uint32 cell = 0; cell < m_ground.size(); ++cell) {
+        m_ground[cell] = !hasMask || mask->isDrivable(cellCenter(cell)) ? 1 : offRoad;
+    }
+    m_obstacles.assign(m_ground.size(), 0);
+    updateTerrain();
+
+    m_workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&PathfindingService::workerMain, this);
+    }
+}
+
+/**
+ * @brief Destructor. Detiene y une a los hilos de trabajo.
+ */
+PathfindingService::~PathfindingService() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief Pide una ruta. Si el par de celdas está en caché, queda lista al instante.
+ *
+ * @param start Posición de inicio.
+ * @param goal Posición de destino.
+ * @return Handle para consultar el resultado.
+ */
+PathfindingService::Handle PathfindingService::request(const sf::Vector2f& start, const sf::Vector2f& goal) {
+    const sf::Int32 startCell = cellOf(start);
+    const sf::Int32 goalCell = cellOf(goal);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    Handle handle = m_nextHandle++;
+    if (m_nextHandle == InvalidHandle) {
+        m_nextHandle = 1;
+    }
+    Result& result = m_results[handle];
+
+    if (startCell >= 0 && goalCell >= 0) {
+        const sf::Uint64 key = (static_cast<sf::Uint64>(startCell) << 32) | static_cast<sf::Uint32>(goalCell);
+        if (const CacheEntry* entry = findCached(key)) {
+            fillResult(result, start, goal, entry->cells, entry->cost);
+            ++m_cacheHits;
+            return handle;
+        }
+    }
+    ++m_cacheMisses;
+
+    Search* search;
+    if (!m_freeSearches.empty()) {
+        search = m_freeSearches.back();
+        m_freeSearches.pop_back();
+    }
+    else {
+        m_searches.emplace_back();
+        search = &m_searches.back();
+    }
+    search->handle = handle;
+    search->start = start;
+    search->goal = goal;
+    search->started = false;
+    m_queue.push_back(search);
+    lock.unlock();
+
+    m_wake.notify_one();
+    return handle;
+}
+
+/**
+ * @brief Estado de una solicitud.
+ *
+ * @param handle Handle devuelto por `request`.
+ * @return Estado actual (`Unknown` si no existe).
+ */
+PathStatus PathfindingService::getStatus(Handle handle) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_results.find(handle);
+    return it == m_results.end() ? PathStatus::Unknown : it->second.status;
+}
+
+/**
+ * @brief Entrega una ruta terminada y libera el handle.
+ *
+ * @param handle Handle de la solicitud.
+ * @param path Recibe los puntos de la ruta.
+ * @param cost Si no es nulo, recibe el costo de la ruta.
+ * @return true si la ruta existe.
+ */
+bool PathfindingService::takePath(Handle handle, std::vector<sf::Vector2f>& path, float* cost) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_results.find(handle);
+    if (it == m_results.end() || it->second.status == PathStatus::Pending) {
+        return false;
+    }
+
+    const bool found = it->second.status == PathStatus::Found;
+    path = std::move(it->second.path);
+    if (cost != nullptr) {
+        *cost = it->second.cost;
+    }
+    m_results.erase(it);
+    return found;
+}
+
+/**
+ * @brief Cancela una solicitud. Si su búsqueda sigue en la cola, se descarta al salir.
+ *
+ * @param handle Handle de la solicitud.
+ */
+void PathfindingService::cancel(Handle handle) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_results.erase(handle);
+}
+
+/**
+ * @brief Avanza las búsquedas en el hilo que llama hasta agotar el presupuesto.
+ *
+ * @param expansionBudget Expansiones máximas en esta llamada.
+ */
+void PathfindingService::update(std::size_t expansionBudget) {
+    if (!m_workers.empty()) {
+        return;
+    }
+
+    PROFILE_SCOPE("PathfindingService::update");
+    while (expansionBudget > 0) {
+        Search* search = popSearch();
+        if (search == nullptr) {
+            break;
+        }
+        std::size_t used = runSlice(*search, std::min(expansionBudget, m_sliceBudget.load()));
+        m_expansions += used;
+        expansionBudget -= std::min(used, expansionBudget);
+        finishSlice(search);
+    }
+}
+
+/**
+ * @brief Espera a que no quede ninguna búsqueda pendiente.
+ */
+void PathfindingService::waitIdle() {
+    if (m_workers.empty()) {
+        update(std::numeric_limits<std::size_t>::max());
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_queue.empty() && m_running == 0; });
+}
+
+/**
+ * @brief Bloquea las celdas que toca un rectángulo.
+ *
+ * @param area Rectángulo del obstáculo en el mundo.
+ */
+void PathfindingService::addObstacle(const sf::FloatRect& area) {
+    const float left = std::max(0.0f, std::floor((area.left - m_origin.x) * m_inverseCellSize));
+    const float top = std::max(0.0f, std::floor((area.top - m_origin.y) * m_inverseCellSize));
+    const float right = std::min(m_columns - 1.0f, std::floor((area.left + area.width - m_origin.x) * m_inverseCellSize));
+    const float bottom = std::min(m_rows - 1.0f, std::floor((area.top + area.height - m_origin.y) * m_inverseCellSize));
+    if (left > right || top > bottom) {
+        return;
+    }
+
+    {
+        // Espera a que terminen las rebanadas en curso; las pendientes ven la versión nueva y reinician.
+        std::unique_lock<std::shared_mutex> grid(m_gridMutex);
+        bool changed = false;
+        for (sf::Uint32 y = static_cast<sf::Uint32>(top); y <= static_cast<sf::Uint32>(bottom); ++y) {
+            for (sf::Uint32 x = static_cast<sf::Uint32>(left); x <= static_cast<sf::Uint32>(right); ++x) {
+                sf::Uint8& obstacle = m_obstacles[static_cast<std::size_t>(y) * m_columns + x];
+                changed |= obstacle == 0;
+                obstacle = 1;
+            }
+        }
+        if (!changed) {
+            return;
+        }
+        updateTerrain();
+        ++m_gridVersion;
+    }
+    clearCache();
+}
+
+/**
+ * @brief Quita todos los obstáculos.
+ */
+void PathfindingService::clearObstacles() {
+    {
+        std::unique_lock<std::shared_mutex> grid(m_gridMutex);
+        if (std::find(m_obstacles.begin(), m_obstacles.end(), 1) == m_obstacles.end()) {
+            return;
+        }
+        std::fill(m_obstacles.begin(), m_obstacles.end(), 0);
+        updateTerrain();
+        ++m_gridVersion;
+    }
+    clearCache();
+}
+
+/**
+ * @brief Vacía el caché de rutas.
+ */
+void PathfindingService::clearCache() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache.clear();
+    m_cacheIndex.clear();
+}
+
+/**
+ * @brief Rutas guardadas en el caché.
+ *
+ * @return Entradas del caché.
+ */
+std::size_t PathfindingService::getCacheSize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.size();
+}
+
+/**
+ * @brief Bucle de un hilo de trabajo: una rebanada por turno mientras haya búsquedas.
+ */
+void PathfindingService::workerMain() {
+    PROFILE_THREAD("Rutas");
+    while (true) {
+        Search* search;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_stop) {
+                return;
+            }
+            search = m_queue.front();
+            m_queue.pop_front();
+            ++m_running;
+        }
+
+        m_expansions += runSlice(*search, m_sliceBudget.load());
+        finishSlice(search);
+    }
+}
+
+/**
+ * @brief Saca la siguiente búsqueda de la cola.
+ *
+ * @return Búsqueda, o nullptr si la cola está vacía.
+ */
+PathfindingService::Search* PathfindingService::popSearch() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_queue.empty()) {
+        return nullptr;
+    }
+    Search* search = m_queue.front();
+    m_queue.pop_front();
+    ++m_running;
+    return search;
+}
+
+/**
+ * @brief Avanza una búsqueda A* hasta `budget` expansiones.
+ *
+ * La búsqueda reinicia si la rejilla cambió desde su última rebanada. Las entradas viejas
+ * de la frontera (celdas que luego mejoraron) se descartan al salir del montículo.
+ *
+ * @param search Búsqueda a avanzar.
+ * @param budget Expansiones máximas.
+ * @return Expansiones realizadas.
+ */
+std::size_t PathfindingService::runSlice(Search& search, std::size_t budget) const {
+    std::shared_lock<std::shared_mutex> grid(m_gridMutex);
+    const std::size_t cells = m_terrain.size();
+
+    // Heurística octil con el costo mínimo de paso (1): nunca sobreestima.
+    auto heuristic = [this, &search](sf::Uint32 cell) {
+        const float dx = std::abs(static_cast<float>(static_cast<sf::Int32>(cell % m_columns) - search.goalCell % static_cast<sf::Int32>(m_columns)));
+        const float dy = std::abs(static_cast<float>(static_cast<sf::Int32>(cell / m_columns) - search.goalCell / static_cast<sf::Int32>(m_columns)));
+        return (std::max(dx, dy) + 0.41421356f * std::min(dx, dy)) * m_cellSize;
+    };
+
+    const sf::Uint32 version = m_gridVersion.load();
+    if (!search.started || search.gridVersion != version) {
+        search.started = true;
+        search.finished = false;
+        search.found = false;
+        search.gridVersion = version;
+        search.open.clear();
+        if (search.stamp.size() != cells) {
+            search.cost.resize(cells);
+            search.parent.resize(cells);
+            search.stamp.assign(cells, 0);
+            search.generation = 0;
+        }
+        ++search.generation;
+
+        search.startCell = cellOf(search.start);
+        search.goalCell = cellOf(search.goal);
+        if (search.startCell < 0 || search.goalCell < 0 ||
+            m_terrain[search.startCell] == kBlocked || m_terrain[search.goalCell] == kBlocked) {
+            search.finished = true;
+            return 0;
+        }
+        const sf::Uint32 start = static_cast<sf::Uint32>(search.startCell);
+        search.cost[start] = 0.0f;
+        search.parent[start] = start;
+        search.stamp[start] = search.generation;
+        search.open.push_back({ heuristic(start), start });
+    }
+
+    std::size_t expansions = 0;
+    const sf::Uint32 goal = static_cast<sf::Uint32>(search.goalCell);
+    while (expansions < budget && !search.open.empty()) {
+        std::pop_heap(search.open.begin(), search.open.end(), GreaterEntry());
+        const auto [priority, cell] = search.open.back();
+        search.open.pop_back();
+        if (cell == goal) {
+            search.finished = true;
+            search.found = true;
+            return expansions;
+        }
+        const float cost = search.cost[cell];
+        if (priority != cost + heuristic(cell)) {
+            continue;  // Entrada vieja: la celda ya se expandió con un costo menor.
+        }
+        ++expansions;
+
+        const int x = static_cast<int>(cell % m_columns);
+        const int y = static_cast<int>(cell / m_columns);
+        for (int direction = 0; direction < 8; ++direction) {
+            const int nx = x + kOffsetX[direction];
+            const int ny = y + kOffsetY[direction];
+            if (nx < 0 || ny < 0 || nx >= static_cast<int>(m_columns) || ny >= static_cast<int>(m_rows)) {
+                continue;
+            }
+            const sf::Uint32 neighbor = static_cast<sf::Uint32>(ny) * m_columns + nx;
+            if (m_terrain[neighbor] == kBlocked) {
+                continue;
+            }
+            if (direction >= 4 && (m_terrain[static_cast<std::size_t>(y) * m_columns + nx] == kBlocked ||
+                                   m_terrain[static_cast<std::size_t>(ny) * m_columns + x] == kBlocked)) {
+                continue;
+            }
+
+            const float candidate = cost + kStep[direction] * m_cellSize * 0.5f * (m_terrain[cell] + m_terrain[neighbor]);
+            if (search.stamp[neighbor] != search.generation || candidate < search.cost[neighbor]) {
+                search.stamp[neighbor] = search.generation;
+                search.cost[neighbor] = candidate;
+                search.parent[neighbor] = cell;
+                search.open.push_back({ candidate + heuristic(neighbor), neighbor });
+                std::push_heap(search.open.begin(), search.open.end(), GreaterEntry());
+            }
+        }
+    }
+
+    if (search.open.empty()) {
+        search.finished = true;
+    }
+    return expansions;
+}
+
+/**
+ * @brief Publica el resultado de una búsqueda terminada o la devuelve al final de la cola.
+ *
+ * @param search Búsqueda que acaba de correr una rebanada.
+ */
+void PathfindingService::finishSlice(Search* search) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    --m_running;
+
+    auto it = m_results.find(search->handle);
+    if (it == m_results.end()) {
+        // Cancelada: la búsqueda vuelve a la lista libre.
+        m_freeSearches.push_back(search);
+    }
+    else if (search->gridVersion != m_gridVersion.load()) {
+        // Un obstáculo cambió después de la rebanada: reinicia con la rejilla nueva.
+        search->started = false;
+        m_queue.push_back(search);
+    }
+    else if (search->finished) {
+        if (search->found) {
+            // Camino de la meta al inicio por los padres, sin los puntos colineales.
+            CacheEntry entry;
+            entry.key = (static_cast<sf::Uint64>(search->startCell) << 32) | static_cast<sf::Uint32>(search->goalCell);
+            entry.cost = search->cost[search->goalCell];
+            sf::Uint32 cell = static_cast<sf::Uint32>(search->goalCell);
+            entry.cells.push_back(cell);
+            while (cell != static_cast<sf::Uint32>(search->startCell)) {
+                cell = search->parent[cell];
+                entry.cells.push_back(cell);
+            }
+            std::reverse(entry.cells.begin(), entry.cells.end());
+
+            // Se compacta en el mismo vector: `previous` guarda la celda original anterior a `i`,
+            // que la compactación ya pudo haber sobrescrito.
+            std::size_t kept = 1;
+            sf::Int32 previous = static_cast<sf::Int32>(entry.cells[0]);
+            for (std::size_t i = 1; i + 1 < entry.cells.size(); ++i) {
+                const sf::Int32 current = static_cast<sf::Int32>(entry.cells[i]);
+                const sf::Int32 next = static_cast<sf::Int32>(entry.cells[i + 1]);
+                if (current - previous != next - current) {
+                    entry.cells[kept++] = entry.cells[i];
+                }
+                previous = current;
+            }
+            if (entry.cells.size() > 1) {
+                entry.cells[kept++] = entry.cells.back();
+            }
+            entry.cells.resize(kept);
+
+            fillResult(it->second, search->start, search->goal, entry.cells, entry.cost);
+            storeCached(std::move(entry));
+        }
+        else {
+            it->second.status = PathStatus::NotFound;
+        }
+        m_freeSearches.push_back(search);
+    }
+    else {
+        m_queue.push_back(search);
+    }
+
+    const bool idle = m_queue.empty() && m_running == 0;
+    const bool queued = !m_queue.empty();
+    lock.unlock();
+    if (idle) {
+        m_idle.notify_all();
+    }
+    else if (queued) {
+        m_wake.notify_one();
+    }
+}
+
+/**
+ * @brief Arma el resultado con los extremos exactos y los centros de las esquinas intermedias.
+ *
+ * @param result Resultado a llenar.
+ * @param start Posición de inicio exacta.
+ * @param goal Posición de destino exacta.
+ * @param cells Celdas de la ruta.
+ * @param cost Costo de la ruta.
+ */
+void PathfindingService::fillResult(Result& result, const sf::Vector2f& start, const sf::Vector2f& goal,
+                                    const std::vector<sf::Uint32>& cells, float cost) const {
+    result.status = PathStatus::Found;
+    result.cost = cost;
+    result.path.clear();
+    result.path.push_back(start);
+    for (std::size_t i = 1; i + 1 < cells.size(); ++i) {
+        result.path.push_back(cellCenter(cells[i]));
+    }
+    result.path.push_back(goal);
+}
+
+/**
+ * @brief Busca un par en el caché y lo pasa al frente (el más reciente).
+ *
+ * @param key Par de celdas.
+ * @return Entrada, o nullptr si no está.
+ */
+const PathfindingService::CacheEntry* PathfindingService::findCached(sf::Uint64 key) {
+    auto it = m_cacheIndex.find(key);
+    if (it == m_cacheIndex.end()) {
+        return nullptr;
+    }
+    m_cache.splice(m_cache.begin(), m_cache, it->second);
+    return &m_cache.front();
+}
+
+/**
+ * @brief Guarda una ruta al frente del caché y desaloja la menos usada si se pasa del límite.
+ *
+ * @param entry Ruta a guardar.
+ */
+void PathfindingService::storeCached(CacheEntry&& entry) {
+    auto existing = m_cacheIndex.find(entry.key);
+    if (existing != m_cacheIndex.end()) {
+        m_cache.erase(existing->second);
+        m_cacheIndex.erase(existing);
+    }
+    m_cache.push_front(std::move(entry));
+    m_cacheIndex[m_cache.front().key] = m_cache.begin();
+    if (m_cache.size() > m_cacheCapacity) {
+        m_cacheIndex.erase(m_cache.back().key);
+        m_cache.pop_back();
+    }
+}
+
+/**
+ * @brief Celda de una posición.
+ *
+ * @param position Posición en el mundo.
+ * @return Índice de la celda, o -1 fuera de la rejilla.
+ */
+sf::Int32 PathfindingService::cellOf(const sf::Vector2f& position) const {
+    const float cellX = (position.x - m_origin.x) * m_inverseCellSize;
+    const float cellY = (position.y - m_origin.y) * m_inverseCellSize;
+    if (!(cellX >= 0.0f && cellY >= 0.0f && cellX < m_columns && cellY < m_rows)) {
+        return -1;
+    }
+    return static_cast<sf::Int32>(static_cast<sf::Uint32>(cellY) * m_columns + static_cast<sf::Uint32>(cellX));
+}
+
+/**
+ * @brief Centro de una celda en el mundo.
+ *
+ * @param cell Índice de la celda.
+ * @return Posición del centro.
+ */
+sf::Vector2f PathfindingService::cellCenter(sf::Uint32 cell) const {
+    return m_origin + sf::Vector2f((cell % m_columns + 0.5f) * m_cellSize, (cell / m_columns + 0.5f) * m_cellSize);
+}
+
+/**
+ * @brief Combina el suelo con los obstáculos.
+ */
+void PathfindingService::updateTerrain() {
+    m_terrain.resize(m_ground.size());
+    for (std::size_t i = 0; i < m_ground.size(); ++i) {
+        m_terrain[i] = m_obstacles[i] ? kBlocked : m_ground[i];
+    }
+}
@@ -0,0 +1,320 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <SFML/Graphics/Rect.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+
+class TrackMask;
+
+/**
+ * @enum PathStatus
+ * @brief Estado de una solicitud de ruta.
+ */
+enum class PathStatus {
+    Pending,   ///< En la cola o en búsqueda.
+    Found,     ///< Ruta lista para `takePath`.
+    NotFound,  ///< No hay camino (o el inicio o la meta están bloqueados).
+    Unknown    ///< Handle inválido, cancelado o ya entregado.
+};
+
+/**
+ * @class PathfindingService
+ * @brief Rutas exactas con A* sobre una rejilla de la pista, resueltas en segundo plano.
+ *
+ * Para los pocos agentes que necesitan un camino exacto (objetos, peligros) y no les sirve
+ * un campo de flujo compartido. Las solicitudes entran a una cola y devuelven un handle al
+ * instante; hilos de trabajo las resuelven por rebanadas de `sliceBudget` expansiones y
+ * devuelven la búsqueda al final de la cola si no terminó, así una ruta larga no retrasa a
+ * las cortas. Sin hilos de trabajo, `update` resuelve rebanadas en el hilo que llama hasta
+ * agotar un presupuesto de expansiones por tick.
+ *
+ * La rejilla tiene el mismo costo que `FlowField` (1 en asfalto, `offRoadCost` fuera de
+ * pista, obstáculos bloqueados) y la heurística octil es admisible, así que la ruta es la
+ * más barata. Las rutas se guardan en un caché LRU acotado por par (celda de inicio,
+ * celda de meta): repetir una solicitud se responde sin buscar.
+ */
+class PathfindingService {
+public:
+    using Handle = sf::Uint32;
+    static constexpr Handle InvalidHandle = 0;  ///< Handle que nunca se entrega.
+
+    /**
+     * @brief Constructor. Lee el suelo de la máscara y arranca los hilos de trabajo.
+     *
+     * @param bounds Rectángulo del mundo que cubre la rejilla.
+     * @param cellSize Lado de cada celda en píxeles del mundo.
+     * @param mask Máscara de la pista (nula o vacía = todo es asfalto).
+     * @param workerCount Hilos de trabajo (0 = las búsquedas avanzan solo en `update`).
+     * @param cacheCapacity Rutas que guarda el caché.
+     * @param offRoadCost Costo relativo de cruzar una celda fuera de pista (1 a 254).
+     */
+    PathfindingService(const sf::FloatRect& bounds, float cellSize, const TrackMask* mask = nullptr,
+                       unsigned int workerCount = 1, std::size_t cacheCapacity = 256, float offRoadCost = 4.0f);
+
+    /**
+     * @brief Destructor. Detiene y une a los hilos de trabajo.
+     */
+    ~PathfindingService();
+
+    PathfindingService(const PathfindingService&) = delete;
+    PathfindingService& operator=(const PathfindingService&) = delete;
+
+    /**
+     * @brief Pide una ruta. Si está en caché queda lista al instante.
+     *
+     * @param start Posición de inicio.
+     * @param goal Posición de destino.
+     * @return Handle para consultar el resultado.
+     */
+    Handle request(const sf::Vector2f& start, const sf::Vector2f& goal);
+
+    /**
+     * @brief Estado de una solicitud.
+     *
+     * @param handle Handle devuelto por `request`.
+     * @return Estado actual.
+     */
+    PathStatus getStatus(Handle handle) const;
+
+    /**
+     * @brief Entrega una ruta terminada y libera el handle.
+     *
+     * @param handle Handle de la solicitud.
+     * @param path Recibe los puntos de la ruta (inicio, esquinas y meta).
+     * @param cost Si no es nulo, recibe el costo de la ruta en píxeles ponderados.
+     * @return true si la ruta existe; false si sigue pendiente, no hay camino o el handle no es válido.
+     */
+    bool takePath(Handle handle, std::vector<sf::Vector2f>& path, float* cost = nullptr);
+
+    /**
+     * @brief Cancela una solicitud (pendiente o terminada) y libera el handle.
+     *
+     * @param handle Handle de la solicitud.
+     */
+    void cancel(Handle handle);
+
+    /**
+     * @brief Avanza las búsquedas en el hilo que llama (solo sin hilos de trabajo).
+     *
+     * @param expansionBudget Expansiones máximas en esta llamada.
+     */
+    void update(std::size_t expansionBudget);
+
+    /**
+     * @brief Espera a que no quede ninguna búsqueda pendiente.
+     *
+     * Sin hilos de trabajo las resuelve en el hilo que llama.
+     */
+    void waitIdle();
+
+    /**
+     * @brief Expansiones de nodos por rebanada antes de ceder el hilo a otra búsqueda.
+     *
+     * @param expansions Tamaño de la rebanada.
+     */
+    void setSliceBudget(std::size_t expansions) { m_sliceBudget.store(std::max<std::size_t>(1, expansions)); }
+
+    /**
+     * @brief Bloquea las celdas que toca un rectángulo.
+     *
+     * Vacía el caché y reinicia las búsquedas pendientes si alguna celda cambió.
+     *
+     * @param area Rectángulo del obstáculo en el mundo.
+     */
+    void addObstacle(const sf::FloatRect& area);
+
+    /**
+     * @brief Quita todos los obstáculos.
+     */
+    void clearObstacles();
+
+    /**
+     * @brief Vacía el caché de rutas.
+     */
+    void clearCache();
+
+    /**
+     * @brief Solicitudes respondidas desde el caché.
+     *
+     * @return Aciertos.
+     */
+    std::size_t getCacheHits() const { return m_cacheHits.load(); }
+
+    /**
+     * @brief Solicitudes que necesitaron una búsqueda.
+     *
+     * @return Fallos.
+     */
+    std::size_t getCacheMisses() const { return m_cacheMisses.load(); }
+
+    /**
+     * @brief Rutas guardadas en el caché.
+     *
+     * @return Entradas del caché.
+     */
+    std::size_t getCacheSize() const;
+
+    /**
+     * @brief Nodos expandidos desde que se creó el servicio.
+     *
+     * @return Expansiones de A*.
+     */
+    std::size_t getExpansionCount() const { return m_expansions.load(); }
+
+private:
+    /**
+     * @struct Search
+     * @brief Estado de una búsqueda A* que se puede pausar entre rebanadas.
+     */
+    struct Search {
+        Handle handle = InvalidHandle;      ///< Solicitud a la que responde.
+        sf::Vector2f start;                 ///< Posición de inicio.
+        sf::Vector2f goal;                  ///< Posición de destino.
+        sf::Int32 startCell = -1;           ///< Celda de inicio (-1 fuera de la rejilla).
+        sf::Int32 goalCell = -1;            ///< Celda de destino.
+        sf::Uint32 gridVersion = 0;         ///< Versión de la rejilla con que empezó.
+        bool started = false;               ///< false hasta la primera rebanada.
+        bool finished = false;              ///< true al encontrar la meta o agotar la frontera.
+        bool found = false;                 ///< true si llegó a la meta.
+        std::vector<std::pair<float, sf::Uint32>> open;  ///< Frontera (montículo mínimo por f = g + h).
+        std::vector<float> cost;            ///< g de cada celda (válido si `stamp` coincide).
+        std::vector<sf::Uint32> parent;     ///< Celda anterior en el mejor camino.
+        std::vector<sf::Uint32> stamp;      ///< Generación en que se tocó cada celda.
+        sf::Uint32 generation = 0;          ///< Generación de la búsqueda actual.
+    };
+
+    /**
+     * @struct Result
+     * @brief Resultado de una solicitud hasta que se entrega.
+     */
+    struct Result {
+        PathStatus status = PathStatus::Pending;  ///< Estado.
+        std::vector<sf::Vector2f> path;           ///< Ruta (si se encontró).
+        float cost = 0.0f;                        ///< Costo de la ruta.
+    };
+
+    /**
+     * @struct CacheEntry
+     * @brief Ruta guardada por par de celdas.
+     */
+    struct CacheEntry {
+        sf::Uint64 key = 0;                       ///< Celda de inicio en los 32 bits altos, meta en los bajos.
+        std::vector<sf::Uint32> cells;            ///< Celdas de la ruta, ya sin puntos colineales.
+        float cost = 0.0f;                        ///< Costo de la ruta.
+    };
+
+    /**
+     * @brief Bucle de un hilo de trabajo.
+     */
+    void workerMain();
+
+    /**
+     * @brief Saca la siguiente búsqueda de la cola.
+     *
+     * @return Búsqueda, o nullptr si la cola está vacía.
+     */
+    Search* popSearch();
+
+    /**
+     * @brief Avanza una búsqueda hasta `budget` expansiones.
+     *
+     * @param search Búsqueda a avanzar.
+     * @param budget Expansiones máximas.
+     * @return Expansiones realizadas.
+     */
+    std::size_t runSlice(Search& search, std::size_t budget) const;
+
+    /**
+     * @brief Publica el resultado de una búsqueda terminada o la devuelve a la cola.
+     *
+     * @param search Búsqueda que acaba de correr una rebanada.
+     */
+    void finishSlice(Search* search);
+
+    /**
+     * @brief Arma el resultado de una solicitud a partir de las celdas de una ruta.
+     *
+     * @param result Resultado a llenar.
+     * @param start Posición de inicio exacta.
+     * @param goal Posición de destino exacta.
+     * @param cells Celdas de la ruta.
+     * @param cost Costo de la ruta.
+     */
+    void fillResult(Result& result, const sf::Vector2f& start, const sf::Vector2f& goal,
+                    const std::vector<sf::Uint32>& cells, float cost) const;
+
+    /**
+     * @brief Busca un par en el caché y lo marca como el más reciente.
+     *
+     * @param key Par de celdas.
+     * @return Entrada, o nullptr si no está. Requiere `m_mutex`.
+     */
+    const CacheEntry* findCached(sf::Uint64 key);
+
+    /**
+     * @brief Guarda una ruta en el caché, desalojando la menos usada si está lleno.
+     *
+     * @param entry Ruta a guardar. Requiere `m_mutex`.
+     */
+    void storeCached(CacheEntry&& entry);
+
+    /**
+     * @brief Celda de una posición.
+     *
+     * @param position Posición en el mundo.
+     * @return Índice de la celda, o -1 fuera de la rejilla.
+     */
+    sf::Int32 cellOf(const sf::Vector2f& position) const;
+
+    /**
+     * @brief Centro de una celda en el mundo.
+     *
+     * @param cell Índice de la celda.
+     * @return Posición del centro.
+     */
+    sf::Vector2f cellCenter(sf::Uint32 cell) const;
+
+    /**
+     * @brief Recalcula el costo de paso tras un cambio de obstáculos. Requiere `m_gridMutex` exclusivo.
+     */
+    void updateTerrain();
+
+    // Rejilla (solo se escribe con `m_gridMutex` exclusivo).
+    sf::Vector2f m_origin;                  ///< Esquina del mundo de la celda (0, 0).
+    float m_cellSize;                       ///< Lado de las celdas.
+    float m_inverseCellSize;                ///< 1 / `m_cellSize`.
+    sf::Uint32 m_columns = 0;               ///< Celdas en X.
+    sf::Uint32 m_rows = 0;                  ///< Celdas en Y.
+    std::vector<sf::Uint8> m_ground;        ///< Costo del suelo por celda.
+    std::vector<sf::Uint8> m_obstacles;     ///< 1 en las celdas bajo un obstáculo.
+    std::vector<sf::Uint8> m_terrain;       ///< Costo de paso por celda (255 = intransitable).
+    mutable std::shared_mutex m_gridMutex;  ///< Las rebanadas leen la rejilla; los obstáculos la escriben.
+    std::atomic<sf::Uint32> m_gridVersion{ 0 };  ///< Cambia con cada cambio de obstáculos.
+
+    // Solicitudes, cola y caché (protegidos por `m_mutex`).
+    mutable std::mutex m_mutex;             ///< Protege cola, resultados, caché y búsquedas libres.
+    std::condition_variable m_wake;         ///< Despierta a los hilos cuando hay trabajo o hay que parar.
+    std::condition_variable m_idle;         ///< Señala que la cola quedó vacía.
+    std::deque<Search*> m_queue;            ///< Búsquedas pendientes, en orden de turno.
+    std::deque<Search> m_searches;          ///< Todas las búsquedas creadas (direcciones estables, se reutilizan).
+    std::vector<Search*> m_freeSearches;    ///< Búsquedas libres para nuevas solicitudes.
+    std::unordered_map<Handle, Result> m_results;  ///< Resultado de cada handle vivo.
+    std::list<CacheEntry> m_cache;          ///< Rutas guardadas, la más reciente al frente.
+    std::unordered_map<sf::Uint64, std::list<CacheEntry>::iterator> m_cacheIndex;  ///< Par de celdas -> entrada.
+    std::size_t m_cacheCapacity;            ///< Entradas máximas del caché.
+    std::size_t m_running = 0;              ///< Búsquedas fuera de la cola corriendo una rebanada.
+    Handle m_nextHandle = 1;                ///< Siguiente handle a entregar.
+    bool m_stop = false;                    ///< Pide a los hilos que terminen.
+
+    std::atomic<std::size_t> m_sliceBudget{ 256 };  ///< Expansiones por rebanada.
+    std::atomic<std::size_t> m_cacheHits{ 0 };    ///< Aciertos del caché.
+    std::atomic<std::size_t> m_cacheMisses{ 0 };  ///< Fallos del caché.
+    std::atomic<std::size_t> m_expansions{ 0 };   ///< Nodos expandidos.
+    std::vector<std::thread> m_workers;     ///< Hilos de trabajo.
+};
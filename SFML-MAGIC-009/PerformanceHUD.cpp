@@ -0,0 +1,82 @@
+#include "PerformanceHUD.h"
+#include "Window.h"
+#include "Entity.h"
+#include "MemoryStats.h"
+#include "InputSystem.h"
+#include <cstdio>
+#include "../Include/IMGUI/imgui.h"
+
+/**
+ * @brief Guarda los contadores del frame que acaba de mostrarse.
+ *
+ * Las reservas se cuentan como la diferencia del total global entre dos llamadas.
+ *
+ * @param window Ventana que dibujó el frame.
+ */
+void PerformanceHUD::endFrame(const Window& window) {
+    FrameSample sample;
+    const Window::RenderCounters& counters = window.getLastFrameCounters();
+    sample.drawCalls = counters.drawCalls;
+    sample.vertices = counters.vertices;
+    sample.entities = Entity::getLiveCount();
+
+    sf::Uint64 allocations = MemoryStats::getAllocationCount();
+    sf::Uint64 allocatedBytes = MemoryStats::getAllocatedBytes();
+    sample.allocations = allocations - m_allocationBase;
+    sample.allocatedBytes = allocatedBytes - m_allocatedBytesBase;
+    m_allocationBase = allocations;
+    m_allocatedBytesBase = allocatedBytes;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lastSample = sample;
+}
+
+/**
+ * @brief Dibuja la ventana del HUD.
+ *
+ * @param window Ventana de la que se leen los tiempos de presentación.
+ * @param input Entrada de la simulación (se lee sin candados con `readLatest`).
+ */
+void PerformanceHUD::draw(const Window& window, const InputSystem& input) {
+    FrameSample sample;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        sample = m_lastSample;
+    }
+    FramePacer::Stats stats = window.getFrameStats();
+    window.getFrameTimes(m_frameTimes);
+
+    ImGui::Begin("Rendimiento");
+
+    float fps = stats.averageMs > 0.0f ? 1000.0f / stats.averageMs : 0.0f;
+    ImGui::Text("%.1f FPS  (%.2f ms)  %s", fps, stats.averageMs, FramePacer::toString(stats.mode));
+
+    if (!m_frameTimes.empty()) {
+        char overlay[64];
+        std::snprintf(overlay, sizeof(overlay), "max %.2f ms", stats.maxMs);
+        ImGui::PlotLines("##frameTimes", m_frameTimes.data(), static_cast<int>(m_frameTimes.size()), 0,
+                         overlay, 0.0f, std::max(stats.maxMs * 1.2f, 1.0f), ImVec2(0.0f, 60.0f));
+    }
+    ImGui::Text("p50 %.2f  p95 %.2f  p99 %.2f ms", stats.p50Ms, stats.p95Ms, stats.p99Ms);
+    ImGui::Text("jitter %.2f ms  (%u frames)", stats.jitterMs, static_cast<unsigned int>(stats.samples));
+
+    ImGui::Separator();
+    ImGui::Text("Draw calls: %u", static_cast<unsigned int>(sample.drawCalls));
+    ImGui::Text("Vertices: %u", static_cast<unsigned int>(sample.vertices));
+    ImGui::Text("Entidades: %u", static_cast<unsigned int>(sample.entities));
+    ImGui::Text("Reservas/frame: %llu (%.1f KB)", static_cast<unsigned long long>(sample.allocations),
+                sample.allocatedBytes / 1024.0);
+
+    ImGui::Separator();
+    InputSnapshot snapshot = input.readLatest();
+    ImGui::Text("Entrada: tick %llu, %d teclas", static_cast<unsigned long long>(snapshot.tick),
+                snapshot.countKeysDown());
+    if (snapshot.mouseInside) {
+        ImGui::Text("Raton: (%.0f, %.0f)", snapshot.mousePosition.x, snapshot.mousePosition.y);
+    }
+    else {
+        ImGui::Text("Raton: fuera de la ventana");
+    }
+
+    ImGui::End();
+}
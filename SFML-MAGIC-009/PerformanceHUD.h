@@ -0,0 +1,61 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <mutex>
+
+class Window;
+class InputSystem;
+
+/**
+ * @class PerformanceHUD
+ * @brief Ventana de ImGui con las estadísticas de rendimiento del motor.
+ *
+ * Muestra la gráfica de tiempo por frame, FPS, percentiles 50/95/99, llamadas de dibujo,
+ * vértices, entidades vivas, reservas de memoria por frame y el estado de la entrada. Todo
+ * sale de contadores que el motor ya mantiene (`FramePacer`, `Window`, `Entity`,
+ * `MemoryStats`, `InputSystem`).
+ *
+ * `endFrame` se llama en el hilo de la simulación después de `display`; `draw` puede
+ * llamarse desde el hilo de render, así que los datos de la simulación se pasan bajo
+ * un candado.
+ */
+class PerformanceHUD {
+public:
+    /**
+     * @brief Constructor por defecto.
+     */
+    PerformanceHUD() = default;
+
+    /**
+     * @brief Guarda los contadores del frame que acaba de mostrarse.
+     *
+     * @param window Ventana que dibujó el frame.
+     */
+    void endFrame(const Window& window);
+
+    /**
+     * @brief Dibuja la ventana del HUD.
+     *
+     * @param window Ventana de la que se leen los tiempos de presentación.
+     * @param input Entrada de la simulación (se lee sin candados con `readLatest`).
+     */
+    void draw(const Window& window, const InputSystem& input);
+
+private:
+    /**
+     * @struct FrameSample
+     * @brief Contadores de un frame de la simulación.
+     */
+    struct FrameSample {
+        std::size_t drawCalls = 0;      ///< Llamadas a `Window::draw`.
+        std::size_t vertices = 0;       ///< Vértices enviados.
+        std::size_t entities = 0;       ///< Entidades vivas.
+        sf::Uint64 allocations = 0;     ///< Reservas de memoria en el frame (todos los hilos).
+        sf::Uint64 allocatedBytes = 0;  ///< Bytes reservados en el frame.
+    };
+
+    std::mutex m_mutex;                    ///< Protege `m_lastSample`.
+    FrameSample m_lastSample;              ///< Contadores del último frame.
+    sf::Uint64 m_allocationBase = 0;       ///< Reservas acumuladas al cerrar el frame anterior.
+    sf::Uint64 m_allocatedBytesBase = 0;   ///< Bytes acumulados al cerrar el frame anterior.
+    std::vector<float> m_frameTimes;       ///< Copia de los tiempos para la gráfica (solo en `draw`).
+};
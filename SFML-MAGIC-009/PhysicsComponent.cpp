@@ -0,0 +1,562 @@
+#include "PhysicsComponent.h"
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include <iostream>
+#include <limits>
+#include <numeric>
+
+namespace {
+/**
+ * @brief Producto punto.
+ */
+float dot(const sf::Vector2f& a, const sf::Vector2f& b) {
+    return a.x * b.x + a.y * b.y;
+}
+
+/**
+ * @brief Ejes locales (X e Y) de una caja girada.
+ */
+void boxAxes(const Collider& box, sf::Vector2f& axisX, sf::Vector2f& axisY) {
+    const float radians = box.rotation * 3.14159265f / 180.0f;
+    const float c = std::cos(radians);
+    const float s = std::sin(radians);
+    axisX = sf::Vector2f(c, s);
+    axisY = sf::Vector2f(-s, c);
+}
+
+/**
+ * @brief Contacto círculo-círculo.
+ */
+bool circleCircle(const Collider& a, const Collider& b, Contact& contact) {
+    const sf::Vector2f delta = b.center - a.center;
+    const float radius = a.radius + b.radius;
+    const float distanceSquared = dot(delta, delta);
+    if (distanceSquared > radius * radius) {
+        return false;
+    }
+    const float distance = std::sqrt(distanceSquared);
+    // Centros coincidentes: cualquier dirección sirve, pero siempre la misma.
+    contact.normal = distance > 0.0f ? delta / distance : sf::Vector2f(1.0f, 0.0f);
+    contact.penetration = radius - distance;
+    return true;
+}
+
+/**
+ * @brief Contacto círculo-caja; la normal va del círculo hacia la caja.
+ *
+ * El centro del círculo se lleva al espacio de la caja y se acota a sus bordes: el punto
+ * acotado es el más cercano de la caja. Si el centro quedó dentro, se sale por la cara
+ * más cercana.
+ */
+bool circleBox(const Collider& circle, const Collider& box, Contact& contact) {
+    sf::Vector2f axisX;
+    sf::Vector2f axisY;
+    boxAxes(box, axisX, axisY);
+    const sf::Vector2f delta = circle.center - box.center;
+    const sf::Vector2f local(dot(delta, axisX), dot(delta, axisY));
+    const sf::Vector2f& half = box.halfExtents;
+
+    sf::Vector2f outward;  // De la caja hacia el círculo, en espacio local.
+    if (std::abs(local.x) <= half.x && std::abs(local.y) <= half.y) {
+        const float toSideX = half.x - std::abs(local.x);
+        const float toSideY = half.y - std::abs(local.y);
+        if (toSideX < toSideY) {
+            outward = sf::Vector2f(local.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+            contact.penetration = toSideX + circle.radius;
+        }
+        else {
+            outward = sf::Vector2f(0.0f, local.y < 0.0f ? -1.0f : 1.0f);
+            contact.penetration = toSideY + circle.radius;
+        }
+    }
+    else {
+        const sf::Vector2f closest(std::clamp(local.x, -half.x, half.x), std::clamp(local.y, -half.y, half.y));
+        const sf::Vector2f offset = local - closest;
+        const float distanceSquared = dot(offset, offset);
+        if (distanceSquared > circle.radius * circle.radius) {
+            return false;
+        }
+        const float distance = std::sqrt(distanceSquared);
+        outward = offset / distance;
+        contact.penetration = circle.radius - distance;
+    }
+    contact.normal = -(axisX * outward.x + axisY * outward.y);
+    return true;
+}
+
+/**
+ * @brief Contacto caja-caja por separación de ejes (los dos ejes de cada caja).
+ *
+ * La normal es el eje de menor superposición, orientado de `a` hacia `b`.
+ */
+bool boxBox(const Collider& a, const Collider& b, Contact& contact) {
+    sf::Vector2f axes[4];
+    boxAxes(a, axes[0], axes[1]);
+    boxAxes(b, axes[2], axes[3]);
+    const sf::Vector2f delta = b.center - a.center;
+
+    float smallest = std::numeric_limits<float>::max();
+    for (const sf::Vector2f& axis : axes) {
+        const float extentA = a.halfExtents.x * std::abs(dot(axes[0], axis)) + a.halfExtents.y * std::abs(dot(axes[1], axis));
+        const float extentB = b.halfExtents.x * std::abs(dot(axes[2], axis)) + b.halfExtents.y * std::abs(dot(axes[3], axis));
+        const float distance = dot(delta, axis);
+        const float overlap = extentA + extentB - std::abs(distance);
+        if (overlap < 0.0f) {
+            return false;
+        }
+        if (overlap < smallest) {
+            smallest = overlap;
+            contact.normal = distance < 0.0f ? -axis : axis;
+        }
+    }
+    contact.penetration = smallest;
+    return true;
+}
+}
+
+/**
+ * @brief Constructor.
+ *
+ * @param world Mundo que guarda el cuerpo.
+ * @param body Índice del cuerpo en el mundo.
+ */
+PhysicsComponent::PhysicsComponent(PhysicsWorld* world, sf::Uint32 body)
+    : Component(ComponentType::PHYSICS), m_world(world), m_body(body) {
+}
+
+/**
+ * @brief Velocidad del cuerpo.
+ *
+ * @return Velocidad en píxeles por segundo.
+ */
+sf::Vector2f PhysicsComponent::getVelocity() const {
+    return m_world->getVelocity(m_body);
+}
+
+/**
+ * @brief Cambia la velocidad del cuerpo.
+ *
+ * @param velocity Velocidad en píxeles por segundo.
+ */
+void PhysicsComponent::setVelocity(const sf::Vector2f& velocity) {
+    m_world->setVelocity(m_body, velocity);
+}
+
+/**
+ * @brief Aplica un impulso.
+ *
+ * @param impulse Impulso en masa * píxeles / segundo.
+ */
+void PhysicsComponent::applyImpulse(const sf::Vector2f& impulse) {
+    m_world->applyImpulse(m_body, impulse);
+}
+
+/**
+ * @brief Acumula una fuerza para el siguiente paso.
+ *
+ * @param force Fuerza en masa * píxeles / segundo².
+ */
+void PhysicsComponent::applyForce(const sf::Vector2f& force) {
+    m_world->applyForce(m_body, force);
+}
+
+/**
+ * @brief Masa del cuerpo.
+ *
+ * @return Masa (0 si el cuerpo es cinemático).
+ */
+float PhysicsComponent::getMass() const {
+    return m_world->getMass(m_body);
+}
+
+/**
+ * @brief Restitución del cuerpo.
+ *
+ * @return Coeficiente en [0, 1].
+ */
+float PhysicsComponent::getRestitution() const {
+    return m_world->getRestitution(m_body);
+}
+
+/**
+ * @brief Cambia la restitución del cuerpo.
+ *
+ * @param restitution Coeficiente en [0, 1].
+ */
+void PhysicsComponent::setRestitution(float restitution) {
+    m_world->setRestitution(m_body, restitution);
+}
+
+/**
+ * @brief Constructor.
+ *
+ * @param linearDamping Amortiguación de la velocidad por segundo.
+ */
+PhysicsWorld::PhysicsWorld(float linearDamping)
+    : m_gravity(0.0f, 0.0f), m_linearDamping(std::max(linearDamping, 0.0f)) {
+}
+
+/**
+ * @brief Agrega un actor como cuerpo y le añade su `PhysicsComponent`.
+ *
+ * @param actor Actor con `Transform` y `ShapeFactory`.
+ * @param mass Masa del cuerpo (0 = cinemático).
+ * @param restitution Coeficiente de rebote en [0, 1].
+ * @return Índice del cuerpo.
+ */
+sf::Uint32 PhysicsWorld::addActor(EngineUtilities::TSharedPointer<Actor> actor, float mass, float restitution) {
+    Collider collider;
+    if (actor.isNull() || !Collider::fromActor(*actor, collider)) {
+        std::cerr << "PhysicsWorld : el actor no tiene forma ni transformación; se agrega como cuerpo vacío.\n";
+    }
+    sf::Uint32 body = addBody(collider, mass, restitution);
+    if (!actor.isNull()) {
+        m_actors[body] = actor;
+        actor->addComponent(EngineUtilities::MakeShared<PhysicsComponent>(this, body));
+    }
+    return body;
+}
+
+/**
+ * @brief Agrega un cuerpo sin actor.
+ *
+ * @param collider Forma y posición inicial.
+ * @param mass Masa del cuerpo (0 = estático).
+ * @param restitution Coeficiente de rebote en [0, 1].
+ * @return Índice del cuerpo.
+ */
+sf::Uint32 PhysicsWorld::addBody(const Collider& collider, float mass, float restitution) {
+    const sf::Uint32 body = static_cast<sf::Uint32>(m_inverseMass.size());
+    m_positionX.push_back(collider.center.x);
+    m_positionY.push_back(collider.center.y);
+    m_velocityX.push_back(0.0f);
+    m_velocityY.push_back(0.0f);
+    m_forceX.push_back(0.0f);
+    m_forceY.push_back(0.0f);
+    m_inverseMass.push_back(mass > 0.0f ? 1.0f / mass : 0.0f);
+    m_restitution.push_back(std::clamp(restitution, 0.0f, 1.0f));
+    m_startX.push_back(collider.center.x);
+    m_startY.push_back(collider.center.y);
+    m_colliders.push_back(collider);
+    m_actors.emplace_back();
+    m_broadphase.addBody(collider.getBounds());
+    return body;
+}
+
+/**
+ * @brief Avanza la simulación un tick.
+ *
+ * @param deltaTime Duración del tick en segundos.
+ * @param pool Hilos para resolver islas en paralelo (nullptr = en el hilo actual).
+ */
+void PhysicsWorld::step(float deltaTime, ThreadPool* pool) {
+    PROFILE_SCOPE("PhysicsWorld::step");
+    if (deltaTime <= 0.0f) {
+        return;
+    }
+    const std::size_t count = size();
+    const float inverseDelta = 1.0f / deltaTime;
+
+    // 1. Estado de los actores: el juego pudo moverlos desde el último paso.
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!m_actors[i].isNull() && Collider::fromActor(*m_actors[i], m_colliders[i])) {
+            if (m_inverseMass[i] == 0.0f) {
+                m_velocityX[i] = (m_colliders[i].center.x - m_positionX[i]) * inverseDelta;
+                m_velocityY[i] = (m_colliders[i].center.y - m_positionY[i]) * inverseDelta;
+            }
+            m_positionX[i] = m_colliders[i].center.x;
+            m_positionY[i] = m_colliders[i].center.y;
+        }
+    }
+    std::copy(m_positionX.begin(), m_positionX.end(), m_startX.begin());
+    std::copy(m_positionY.begin(), m_positionY.end(), m_startY.begin());
+
+    // 2. Velocidades (Euler semi-implícito). Sin llamadas ni dependencias entre
+    //    iteraciones: la selección de cuerpos dinámicos se compila como una mezcla vectorial.
+    {
+        const float damping = 1.0f / (1.0f + m_linearDamping * deltaTime);
+        const float gravityX = m_gravity.x * deltaTime;
+        const float gravityY = m_gravity.y * deltaTime;
+        float* velocityX = m_velocityX.data();
+        float* velocityY = m_velocityY.data();
+        float* forceX = m_forceX.data();
+        float* forceY = m_forceY.data();
+        const float* inverseMass = m_inverseMass.data();
+        for (std::size_t i = 0; i < count; ++i) {
+            const float newX = (velocityX[i] + forceX[i] * inverseMass[i] * deltaTime + gravityX) * damping;
+            const float newY = (velocityY[i] + forceY[i] * inverseMass[i] * deltaTime + gravityY) * damping;
+            velocityX[i] = inverseMass[i] > 0.0f ? newX : velocityX[i];
+            velocityY[i] = inverseMass[i] > 0.0f ? newY : velocityY[i];
+            forceX[i] = 0.0f;
+            forceY[i] = 0.0f;
+        }
+    }
+
+    // 3. Fase amplia y fase estrecha.
+    for (std::size_t i = 0; i < count; ++i) {
+        m_colliders[i].center = sf::Vector2f(m_positionX[i], m_positionY[i]);
+        m_broadphase.setBounds(static_cast<sf::Uint32>(i), m_colliders[i].getBounds());
+    }
+    m_broadphase.update();
+
+    m_contacts.clear();
+    for (const BroadphasePair& pair : m_broadphase.getPairs()) {
+        if (m_inverseMass[pair.first] == 0.0f && m_inverseMass[pair.second] == 0.0f) {
+            continue;
+        }
+        Contact contact;
+        if (!collide(m_colliders[pair.first], m_colliders[pair.second], contact)) {
+            continue;
+        }
+        contact.a = pair.first;
+        contact.b = pair.second;
+
+        // Solo rebotan los choques con cierta rapidez: así los cuerpos en reposo no vibran.
+        const float approach = (m_velocityX[contact.b] - m_velocityX[contact.a]) * contact.normal.x +
+                               (m_velocityY[contact.b] - m_velocityY[contact.a]) * contact.normal.y;
+        const float restitution = std::max(m_restitution[contact.a], m_restitution[contact.b]);
+        contact.velocityBias = approach < -10.0f ? -restitution * approach : 0.0f;
+        m_contacts.push_back(contact);
+    }
+
+    // 4. Islas: cada una se resuelve completa en un solo hilo.
+    buildIslands();
+    const std::size_t islands = getIslandCount();
+    if (pool == nullptr || islands < 2) {
+        solveIslands(0, islands);
+    }
+    else {
+        pool->parallelFor(islands, [this](std::size_t begin, std::size_t end) {
+            solveIslands(begin, end);
+        }, 4);
+    }
+
+    // 5. Posiciones con la velocidad ya corregida.
+    {
+        float* positionX = m_positionX.data();
+        float* positionY = m_positionY.data();
+        const float* velocityX = m_velocityX.data();
+        const float* velocityY = m_velocityY.data();
+        const float* inverseMass = m_inverseMass.data();
+        for (std::size_t i = 0; i < count; ++i) {
+            positionX[i] += inverseMass[i] > 0.0f ? velocityX[i] * deltaTime : 0.0f;
+            positionY[i] += inverseMass[i] > 0.0f ? velocityY[i] * deltaTime : 0.0f;
+        }
+    }
+
+    // El `Transform` guarda la esquina de la forma, no el centro: se le suma el desplazamiento.
+    for (std::size_t i = 0; i < count; ++i) {
+        if (m_actors[i].isNull() || m_inverseMass[i] == 0.0f) {
+            continue;
+        }
+        auto transform = m_actors[i]->getComponent<Transform>();
+        transform->setPosition(transform->getPosition() +
+                               sf::Vector2f(m_positionX[i] - m_startX[i], m_positionY[i] - m_startY[i]));
+    }
+}
+
+/**
+ * @brief Fase estrecha: contacto entre dos formas.
+ *
+ * @param a Primera forma.
+ * @param b Segunda forma.
+ * @param contact Recibe normal (de `a` hacia `b`) y penetración.
+ * @return true si las formas se superponen.
+ */
+bool PhysicsWorld::collide(const Collider& a, const Collider& b, Contact& contact) {
+    if (a.type == ColliderType::Circle && b.type == ColliderType::Circle) {
+        return circleCircle(a, b, contact);
+    }
+    if (a.type == ColliderType::Circle) {
+        return circleBox(a, b, contact);
+    }
+    if (b.type == ColliderType::Circle) {
+        if (!circleBox(b, a, contact)) {
+            return false;
+        }
+        contact.normal = -contact.normal;
+        return true;
+    }
+    return boxBox(a, b, contact);
+}
+
+/**
+ * @brief Cambia la velocidad de un cuerpo.
+ *
+ * @param body Índice del cuerpo.
+ * @param velocity Velocidad en píxeles por segundo.
+ */
+void PhysicsWorld::setVelocity(sf::Uint32 body, const sf::Vector2f& velocity) {
+    m_velocityX[body] = velocity.x;
+    m_velocityY[body] = velocity.y;
+}
+
+/**
+ * @brief Aplica un impulso a un cuerpo.
+ *
+ * @param body Índice del cuerpo.
+ * @param impulse Impulso en masa * píxeles / segundo.
+ */
+void PhysicsWorld::applyImpulse(sf::Uint32 body, const sf::Vector2f& impulse) {
+    m_velocityX[body] += impulse.x * m_inverseMass[body];
+    m_velocityY[body] += impulse.y * m_inverseMass[body];
+}
+
+/**
+ * @brief Acumula una fuerza para el siguiente paso.
+ *
+ * @param body Índice del cuerpo.
+ * @param force Fuerza en masa * píxeles / segundo².
+ */
+void PhysicsWorld::applyForce(sf::Uint32 body, const sf::Vector2f& force) {
+    m_forceX[body] += force.x;
+    m_forceY[body] += force.y;
+}
+
+/**
+ * @brief Masa de un cuerpo.
+ *
+ * @param body Índice del cuerpo.
+ * @return Masa (0 si es cinemático o estático).
+ */
+float PhysicsWorld::getMass(sf::Uint32 body) const {
+    return m_inverseMass[body] > 0.0f ? 1.0f / m_inverseMass[body] : 0.0f;
+}
+
+/**
+ * @brief Cambia la restitución de un cuerpo.
+ *
+ * @param body Índice del cuerpo.
+ * @param restitution Coeficiente en [0, 1].
+ */
+void PhysicsWorld::setRestitution(sf::Uint32 body, float restitution) {
+    m_restitution[body] = std::clamp(restitution, 0.0f, 1.0f);
+}
+
+/**
+ * @brief Resuelve los contactos de un rango de islas.
+ *
+ * Impulsos secuenciales con impulso acumulado (nunca negativo: los contactos solo
+ * empujan) y después una corrección de posición que deja una pequeña holgura para que
+ * los contactos en reposo no aparezcan y desaparezcan cada tick. Los cuerpos de masa
+ * infinita pueden aparecer en varias islas, por eso nunca se escriben.
+ *
+ * @param begin Primera isla.
+ * @param end Una más allá de la última isla.
+ */
+void PhysicsWorld::solveIslands(std::size_t begin, std::size_t end) {
+    const float slop = 0.5f;
+    const float correctionRate = 0.8f;
+
+    for (std::size_t island = begin; island < end; ++island) {
+        Contact* first = m_contacts.data() + m_islandStarts[island];
+        Contact* last = m_contacts.data() + m_islandStarts[island + 1];
+
+        for (unsigned int iteration = 0; iteration < m_iterations; ++iteration) {
+            for (Contact* contact = first; contact != last; ++contact) {
+                const sf::Uint32 a = contact->a;
+                const sf::Uint32 b = contact->b;
+                const float inverseA = m_inverseMass[a];
+                const float inverseB = m_inverseMass[b];
+                const float normalVelocity = (m_velocityX[b] - m_velocityX[a]) * contact->normal.x +
+                                             (m_velocityY[b] - m_velocityY[a]) * contact->normal.y;
+
+                float delta = (contact->velocityBias - normalVelocity) / (inverseA + inverseB);
+                const float accumulated = std::max(contact->impulse + delta, 0.0f);
+                delta = accumulated - contact->impulse;
+                contact->impulse = accumulated;
+
+                if (inverseA > 0.0f) {
+                    m_velocityX[a] -= contact->normal.x * delta * inverseA;
+                    m_velocityY[a] -= contact->normal.y * delta * inverseA;
+                }
+                if (inverseB > 0.0f) {
+                    m_velocityX[b] += contact->normal.x * delta * inverseB;
+                    m_velocityY[b] += contact->normal.y * delta * inverseB;
+                }
+            }
+        }
+
+        for (Contact* contact = first; contact != last; ++contact) {
+            const sf::Uint32 a = contact->a;
+            const sf::Uint32 b = contact->b;
+            const float inverseA = m_inverseMass[a];
+            const float inverseB = m_inverseMass[b];
+            const float correction = std::max(contact->penetration - slop, 0.0f) * correctionRate / (inverseA + inverseB);
+            if (inverseA > 0.0f) {
+                m_positionX[a] -= contact->normal.x * correction * inverseA;
+                m_positionY[a] -= contact->normal.y * correction * inverseA;
+            }
+            if (inverseB > 0.0f) {
+                m_positionX[b] += contact->normal.x * correction * inverseB;
+                m_positionY[b] += contact->normal.y * correction * inverseB;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Raíz de un cuerpo en el union-find de islas (con compresión de camino).
+ *
+ * @param body Cuerpo dinámico.
+ * @return Representante de su isla.
+ */
+sf::Uint32 PhysicsWorld::findIsland(sf::Uint32 body) {
+    while (m_islandParent[body] != body) {
+        m_islandParent[body] = m_islandParent[m_islandParent[body]];
+        body = m_islandParent[body];
+    }
+    return body;
+}
+
+/**
+ * @brief Construye las islas y ordena los contactos por isla.
+ *
+ * Solo los cuerpos dinámicos unen islas: un muro o un kart cinemático que toca dos
+ * grupos no los obliga a resolverse juntos. El ordenamiento por conteo es estable, así
+ * que cada isla conserva el orden de la fase amplia y el resultado no depende de cuántos
+ * hilos resuelvan.
+ */
+void PhysicsWorld::buildIslands() {
+    const std::size_t count = size();
+    m_islandParent.resize(count);
+    std::iota(m_islandParent.begin(), m_islandParent.end(), 0u);
+    for (const Contact& contact : m_contacts) {
+        if (m_inverseMass[contact.a] > 0.0f && m_inverseMass[contact.b] > 0.0f) {
+            sf::Uint32 rootA = findIsland(contact.a);
+            sf::Uint32 rootB = findIsland(contact.b);
+            if (rootA != rootB) {
+                m_islandParent[rootA] = rootB;
+            }
+        }
+    }
+
+    // Índice compacto de isla para cada contacto (por su cuerpo dinámico).
+    const sf::Uint32 unassigned = std::numeric_limits<sf::Uint32>::max();
+    m_islandSlot.assign(count, unassigned);
+    m_islandOf.resize(m_contacts.size());
+    sf::Uint32 islands = 0;
+    for (std::size_t k = 0; k < m_contacts.size(); ++k) {
+        const Contact& contact = m_contacts[k];
+        sf::Uint32 root = findIsland(m_inverseMass[contact.a] > 0.0f ? contact.a : contact.b);
+        if (m_islandSlot[root] == unassigned) {
+            m_islandSlot[root] = islands++;
+        }
+        m_islandOf[k] = m_islandSlot[root];
+    }
+
+    // Ordenamiento por conteo de los contactos por isla.
+    m_islandStarts.assign(islands + 1, 0);
+    for (sf::Uint32 island : m_islandOf) {
+        ++m_islandStarts[island + 1];
+    }
+    for (sf::Uint32 island = 0; island < islands; ++island) {
+        m_islandStarts[island + 1] += m_islandStarts[island];
+    }
+    m_islandSlot.assign(m_islandStarts.begin(), m_islandStarts.end() - 1);  // Cursor de cada isla.
+    m_sorted.resize(m_contacts.size());
+    for (std::size_t k = 0; k < m_contacts.size(); ++k) {
+        m_sorted[m_islandSlot[m_islandOf[k]]++] = m_contacts[k];
+    }
+    m_contacts.swap(m_sorted);
+}
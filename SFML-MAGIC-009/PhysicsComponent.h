@@ -0,0 +1,329 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "Component.h"      // Define la clase base Component.
+#include "Broadphase.h"     // Fase amplia y formas de colisión de los actores.
+
+class ThreadPool;
+class PhysicsWorld;
+
+/**
+ * @class PhysicsComponent
+ * @brief Componente de física de un actor: una vista sobre su cuerpo en un `PhysicsWorld`.
+ *
+ * Velocidad, masa y restitución no viven en el componente sino en los arreglos del mundo
+ * (un arreglo por campo), que es lo que recorre la integración. El componente solo guarda
+ * el índice del cuerpo y reenvía las lecturas y escrituras.
+ *
+ * Se crea con `PhysicsWorld::addActor`; el mundo debe vivir más que el actor.
+ */
+class PhysicsComponent : public Component {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param world Mundo que guarda el cuerpo.
+     * @param body Índice del cuerpo en el mundo.
+     */
+    PhysicsComponent(PhysicsWorld* world, sf::Uint32 body);
+
+    /**
+     * @brief Destructor virtual por defecto.
+     */
+    virtual ~PhysicsComponent() = default;
+
+    /**
+     * @brief No hace nada: el mundo integra todos los cuerpos juntos en `PhysicsWorld::step`.
+     */
+    void update(float) override {}
+
+    /**
+     * @brief No dibuja nada: la forma del actor se encarga.
+     */
+    void render(Window&) override {}
+
+    /**
+     * @brief Velocidad del cuerpo.
+     *
+     * @return Velocidad en píxeles por segundo.
+     */
+    sf::Vector2f getVelocity() const;
+
+    /**
+     * @brief Cambia la velocidad del cuerpo.
+     *
+     * @param velocity Velocidad en píxeles por segundo.
+     */
+    void setVelocity(const sf::Vector2f& velocity);
+
+    /**
+     * @brief Aplica un impulso (cambio instantáneo de momento).
+     *
+     * @param impulse Impulso en masa * píxeles / segundo.
+     */
+    void applyImpulse(const sf::Vector2f& impulse);
+
+    /**
+     * @brief Acumula una fuerza para el siguiente paso.
+     *
+     * @param force Fuerza en masa * píxeles / segundo².
+     */
+    void applyForce(const sf::Vector2f& force);
+
+    /**
+     * @brief Masa del cuerpo.
+     *
+     * @return Masa (0 si el cuerpo es cinemático).
+     */
+    float getMass() const;
+
+    /**
+     * @brief Restitución del cuerpo.
+     *
+     * @return Coeficiente en [0, 1] (0 = choque plástico, 1 = rebote perfecto).
+     */
+    float getRestitution() const;
+
+    /**
+     * @brief Cambia la restitución del cuerpo.
+     *
+     * @param restitution Coeficiente en [0, 1].
+     */
+    void setRestitution(float restitution);
+
+    /**
+     * @brief Índice del cuerpo en el mundo.
+     *
+     * @return Handle del cuerpo.
+     */
+    sf::Uint32 getBody() const { return m_body; }
+
+private:
+    PhysicsWorld* m_world;  ///< Mundo que guarda los datos del cuerpo.
+    sf::Uint32 m_body;      ///< Índice del cuerpo.
+};
+
+/**
+ * @struct Contact
+ * @brief Contacto entre dos cuerpos encontrado por la fase estrecha.
+ */
+struct Contact {
+    sf::Uint32 a = 0;              ///< Primer cuerpo.
+    sf::Uint32 b = 0;              ///< Segundo cuerpo.
+    sf::Vector2f normal;           ///< Dirección unitaria de `a` hacia `b`.
+    float penetration = 0.0f;      ///< Profundidad de la superposición.
+    float velocityBias = 0.0f;     ///< Velocidad de separación buscada (restitución).
+    float impulse = 0.0f;          ///< Impulso normal acumulado por el solver.
+};
+
+/**
+ * @class PhysicsWorld
+ * @brief Cuerpos rígidos en arreglos por campo, integración semi-implícita y contactos.
+ *
+ * Cada paso:
+ *  1. Lee la posición de cada actor. Los cuerpos cinemáticos (masa 0, movidos por el
+ *     juego) obtienen su velocidad de lo que se desplazaron.
+ *  2. Integra velocidades (Euler semi-implícito) en un bucle sin ramas sobre arreglos
+ *     contiguos que el compilador vectoriza.
+ *  3. Busca pares con la `Broadphase` y contactos círculo-círculo, círculo-caja y
+ *     caja-caja (separación de ejes).
+ *  4. Agrupa los cuerpos dinámicos en islas (componentes conexas de contactos) y resuelve
+ *     cada isla con impulsos secuenciales. Las islas no comparten cuerpos dinámicos, así
+ *     que se reparten entre los hilos de un `ThreadPool` sin sincronización.
+ *  5. Integra posiciones y devuelve el desplazamiento a cada `Transform`.
+ *
+ * La dinámica es solo lineal: el giro de los actores lo decide el juego.
+ */
+class PhysicsWorld {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param linearDamping Amortiguación de la velocidad por segundo (fricción con el suelo).
+     */
+    explicit PhysicsWorld(float linearDamping = 2.0f);
+
+    /**
+     * @brief Agrega un actor como cuerpo y le añade su `PhysicsComponent`.
+     *
+     * @param actor Actor con `Transform` y `ShapeFactory`.
+     * @param mass Masa del cuerpo (0 = cinemático: lo mueve el juego y no recibe impulsos).
+     * @param restitution Coeficiente de rebote en [0, 1].
+     * @return Índice del cuerpo.
+     */
+    sf::Uint32 addActor(EngineUtilities::TSharedPointer<Actor> actor, float mass, float restitution = 0.3f);
+
+    /**
+     * @brief Agrega un cuerpo sin actor (pruebas, escombros, benchmarks).
+     *
+     * @param collider Forma y posición inicial.
+     * @param mass Masa del cuerpo (0 = estático).
+     * @param restitution Coeficiente de rebote en [0, 1].
+     * @return Índice del cuerpo.
+     */
+    sf::Uint32 addBody(const Collider& collider, float mass, float restitution = 0.3f);
+
+    /**
+     * @brief Avanza la simulación un tick.
+     *
+     * @param deltaTime Duración del tick en segundos.
+     * @param pool Hilos para resolver islas en paralelo (nullptr = en el hilo actual).
+     */
+    void step(float deltaTime, ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Fase estrecha: contacto entre dos formas.
+     *
+     * @param a Primera forma.
+     * @param b Segunda forma.
+     * @param contact Recibe normal (de `a` hacia `b`) y penetración.
+     * @return true si las formas se superponen.
+     */
+    static bool collide(const Collider& a, const Collider& b, Contact& contact);
+
+    /**
+     * @brief Cambia la gravedad (cero por defecto: la pista se ve desde arriba).
+     *
+     * @param gravity Aceleración en píxeles por segundo².
+     */
+    void setGravity(const sf::Vector2f& gravity) { m_gravity = gravity; }
+
+    /**
+     * @brief Iteraciones del solver de velocidades por paso.
+     *
+     * @param iterations Más iteraciones convergen mejor en pilas grandes.
+     */
+    void setSolverIterations(unsigned int iterations) { m_iterations = std::max(1u, iterations); }
+
+    /**
+     * @brief Número de cuerpos.
+     *
+     * @return Cuerpos registrados.
+     */
+    std::size_t size() const { return m_inverseMass.size(); }
+
+    /**
+     * @brief Posición del centro de un cuerpo.
+     *
+     * @param body Índice del cuerpo.
+     * @return Centro en el mundo.
+     */
+    sf::Vector2f getPosition(sf::Uint32 body) const { return sf::Vector2f(m_positionX[body], m_positionY[body]); }
+
+    /**
+     * @brief Velocidad de un cuerpo.
+     *
+     * @param body Índice del cuerpo.
+     * @return Velocidad en píxeles por segundo.
+     */
+    sf::Vector2f getVelocity(sf::Uint32 body) const { return sf::Vector2f(m_velocityX[body], m_velocityY[body]); }
+
+    /**
+     * @brief Cambia la velocidad de un cuerpo.
+     *
+     * @param body Índice del cuerpo.
+     * @param velocity Velocidad en píxeles por segundo.
+     */
+    void setVelocity(sf::Uint32 body, const sf::Vector2f& velocity);
+
+    /**
+     * @brief Aplica un impulso a un cuerpo (sin efecto en los cinemáticos).
+     *
+     * @param body Índice del cuerpo.
+     * @param impulse Impulso en masa * píxeles / segundo.
+     */
+    void applyImpulse(sf::Uint32 body, const sf::Vector2f& impulse);
+
+    /**
+     * @brief Acumula una fuerza para el siguiente paso.
+     *
+     * @param body Índice del cuerpo.
+     * @param force Fuerza en masa * píxeles / segundo².
+     */
+    void applyForce(sf::Uint32 body, const sf::Vector2f& force);
+
+    /**
+     * @brief Masa de un cuerpo.
+     *
+     * @param body Índice del cuerpo.
+     * @return Masa (0 si es cinemático o estático).
+     */
+    float getMass(sf::Uint32 body) const;
+
+    /**
+     * @brief Restitución de un cuerpo.
+     *
+     * @param body Índice del cuerpo.
+     * @return Coeficiente en [0, 1].
+     */
+    float getRestitution(sf::Uint32 body) const { return m_restitution[body]; }
+
+    /**
+     * @brief Cambia la restitución de un cuerpo.
+     *
+     * @param body Índice del cuerpo.
+     * @param restitution Coeficiente en [0, 1].
+     */
+    void setRestitution(sf::Uint32 body, float restitution);
+
+    /**
+     * @brief Contactos del último paso.
+     *
+     * @return Contactos agrupados por isla.
+     */
+    const std::vector<Contact>& getContacts() const { return m_contacts; }
+
+    /**
+     * @brief Número de islas del último paso.
+     *
+     * @return Grupos de cuerpos dinámicos en contacto.
+     */
+    std::size_t getIslandCount() const { return m_islandStarts.empty() ? 0 : m_islandStarts.size() - 1; }
+
+private:
+    /**
+     * @brief Resuelve los contactos de un rango de islas.
+     *
+     * @param begin Primera isla.
+     * @param end Una más allá de la última isla.
+     */
+    void solveIslands(std::size_t begin, std::size_t end);
+
+    /**
+     * @brief Raíz de un cuerpo en el union-find de islas (con compresión de camino).
+     *
+     * @param body Cuerpo dinámico.
+     * @return Representante de su isla.
+     */
+    sf::Uint32 findIsland(sf::Uint32 body);
+
+    /**
+     * @brief Construye las islas y ordena los contactos por isla.
+     */
+    void buildIslands();
+
+    // Datos por cuerpo, un arreglo por campo.
+    std::vector<float> m_positionX;       ///< Centro X.
+    std::vector<float> m_positionY;       ///< Centro Y.
+    std::vector<float> m_velocityX;       ///< Velocidad X.
+    std::vector<float> m_velocityY;       ///< Velocidad Y.
+    std::vector<float> m_forceX;          ///< Fuerza acumulada X.
+    std::vector<float> m_forceY;          ///< Fuerza acumulada Y.
+    std::vector<float> m_inverseMass;     ///< 1 / masa (0 en cinemáticos y estáticos).
+    std::vector<float> m_restitution;     ///< Coeficiente de rebote.
+    std::vector<float> m_startX;          ///< Centro X al leer los actores (para devolver el desplazamiento).
+    std::vector<float> m_startY;          ///< Centro Y al leer los actores.
+    std::vector<Collider> m_colliders;    ///< Forma de cada cuerpo.
+    std::vector<EngineUtilities::TSharedPointer<Actor>> m_actors;  ///< Actor de cada cuerpo (nulo en los sueltos).
+
+    Broadphase m_broadphase;              ///< Pares candidatos (mismo índice que los cuerpos).
+    std::vector<Contact> m_contacts;      ///< Contactos del paso, agrupados por isla.
+    std::vector<Contact> m_sorted;        ///< Temporal del ordenamiento por isla.
+    std::vector<sf::Uint32> m_islandParent;  ///< Union-find de islas.
+    std::vector<sf::Uint32> m_islandOf;   ///< Isla de cada contacto (temporal).
+    std::vector<sf::Uint32> m_islandSlot; ///< Índice compacto de cada raíz (temporal).
+    std::vector<sf::Uint32> m_islandStarts;   ///< Primer contacto de cada isla (más el total al final).
+
+    sf::Vector2f m_gravity;               ///< Aceleración constante.
+    float m_linearDamping;                ///< Amortiguación por segundo.
+    unsigned int m_iterations = 8;        ///< Iteraciones del solver de velocidades.
+};
@@ -0,0 +1,33 @@
+#include "Prerequisites.h"
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+
+/**
+ * @brief Imprime en la consola el resultado de la creación de un recurso.
+ *
+ * @param classObj Nombre de la clase que llama a la macro.
+ * @param method Nombre del método donde ocurre la creación.
+ * @param state Estado de la creación del recurso.
+ */
+void logResourceMessage(const std::string& classObj, const std::string& method, const std::string& state) {
+    std::ostringstream os_;
+    os_ << classObj << "::" << method << " : "
+        << "[CREATION OF RESOURCE" << ": " << state << "] \n";
+    std::cerr << os_.str();
+}
+
+/**
+ * @brief Imprime un error fatal en la consola y termina el programa.
+ *
+ * @param classObj Nombre de la clase donde ocurre el error.
+ * @param method Nombre del método donde ocurre el error.
+ * @param errorMSG Mensaje de error detallado.
+ */
+void logFatalError(const std::string& classObj, const std::string& method, const std::string& errorMSG) {
+    std::ostringstream os_;
+    os_ << "ERROR : " << classObj << "::" << method << " : "
+        << "  Error in data from params [" << errorMSG << "] \n";
+    std::cerr << os_.str();
+    exit(1);
+}
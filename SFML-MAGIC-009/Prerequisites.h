@@ -1,82 +1,96 @@
 #pragma once
 
-// Libreras estndar (STD)
-#include <iostream>   // Manejo de entrada y salida.
+// Librerías estándar (STD)
 #include <string>     // Manejo de cadenas de texto.
-#include <sstream>    // Manipulacin de flujos de entrada/salida.
-#include <vector>     // Estructura de datos para listas dinmicas.
-#include <thread>     // Soporte para concurrencia y programacin multihilo.
+#include <vector>     // Estructura de datos para listas dinámicas.
+#include <cmath>      // Funciones matemáticas (raíces, trigonometría).
+#include <algorithm>  // Algoritmos estándar (mínimos, máximos, ordenamiento).
 
-// Libreras externas (Third Parties)
-#include <SFML/Graphics.hpp>  // Biblioteca SFML para grficos y manejo de ventanas.
+// Librerías externas (Third Parties): solo los tipos básicos de SFML. Cada encabezado
+// incluye el resto de SFML que usa; ImGui se incluye únicamente donde se dibuja la interfaz.
+#include <SFML/Config.hpp>            // Enteros de tamaño fijo (sf::Uint32, sf::Uint64...).
+#include <SFML/System/Vector2.hpp>    // sf::Vector2f, sf::Vector2u...
+#include <SFML/System/Time.hpp>       // sf::Time.
+#include <SFML/Graphics/Color.hpp>    // sf::Color.
 
 // Punteros inteligentes personalizados del proyecto.
-#include "../Include/Memory/TSharedPointer.h" // Puntero compartido para gestin de recursos.
-#include "../Include/Memory/TWeakPointer.h" // Puntero dbil para evitar referencias circulares.
-#include "../Include/Memory/TStaticPtr.h" // Puntero esttico para optimizacin.
-#include "../Include/Memory/TUniquePtr.h" // Puntero nico para garantizar propiedad exclusiva.
-
-
-// Biblioteca ImGui (Interfaz grfica de usuario).
-#include "../Include/IMGUI/imgui.h"     // Biblioteca principal de ImGui.
-#include "../Include/IMGUI/imgui-SFML.h"  // Integracin de ImGui con SFML.
+#include "../Include/Memory/TSharedPointer.h" // Puntero compartido para gestión de recursos.
+#include "../Include/Memory/TWeakPointer.h" // Puntero débil para evitar referencias circulares.
+#include "../Include/Memory/TStaticPtr.h" // Puntero estático para optimización.
+#include "../Include/Memory/TUniquePtr.h" // Puntero único para garantizar propiedad exclusiva.
 
 /**
  * @enum ShapeType
- * @brief Enumeracin para representar los tipos de formas geomtricas.
+ * @brief Enumeración para representar los tipos de formas geométricas.
  *
- * Define los tipos de formas que se pueden crear en el motor grfico.
+ * Define los tipos de formas que se pueden crear en el motor gráfico.
  */
 enum ShapeType {
-    EMPTY = 0,    ///< Forma vaca, sin representacin.
-    CIRCLE = 1,   ///< Representa un crculo.
-    RECTANGLE = 2,///< Representa un rectngulo.
-    TRIANGLE = 3  ///< Representa un tringulo.
+    EMPTY = 0,    ///< Forma vacía, sin representación.
+    CIRCLE = 1,   ///< Representa un círculo.
+    RECTANGLE = 2,///< Representa un rectángulo.
+    TRIANGLE = 3  ///< Representa un triángulo.
 };
 
 /**
  * @brief Macro para liberar punteros de forma segura.
  *
  * Esta macro verifica si el puntero no es nulo y luego lo libera,
- * establecindolo en nullptr para evitar accesos a memoria ya liberada.
+ * estableciéndolo en nullptr para evitar accesos a memoria ya liberada.
  *
  * @param x Puntero a liberar.
  */
 #define SAFE_PTR_RELEASE(x) if(x != nullptr) { delete x; x = nullptr; }
 
+/**
+ * @brief Imprime en la consola el resultado de la creación de un recurso.
+ *
+ * Implementación de la macro `MESSAGE`; vive en Prerequisites.cpp para que este
+ * encabezado no tenga que incluir `<iostream>` ni `<sstream>`.
+ *
+ * @param classObj Nombre de la clase que llama a la macro.
+ * @param method Nombre del método donde ocurre la creación.
+ * @param state Estado de la creación del recurso.
+ */
+void logResourceMessage(const std::string& classObj, const std::string& method, const std::string& state);
+
+/**
+ * @brief Imprime un error fatal en la consola y termina el programa.
+ *
+ * Implementación de la macro `ERROR`.
+ *
+ * @param classObj Nombre de la clase donde ocurre el error.
+ * @param method Nombre del método donde ocurre el error.
+ * @param errorMSG Mensaje de error detallado.
+ */
+[[noreturn]] void logFatalError(const std::string& classObj, const std::string& method, const std::string& errorMSG);
+
  /**
-  * @brief Macro para imprimir un mensaje de creacin de recursos.
+  * @brief Macro para imprimir un mensaje de creación de recursos.
   *
-  * Esta macro muestra un mensaje en la consola indicando si la creacin de un
-  * recurso fue exitosa o no, facilitando la depuracin.
+  * Esta macro muestra un mensaje en la consola indicando si la creación de un
+  * recurso fue exitosa o no, facilitando la depuración.
   *
   * @param classObj Nombre de la clase que llama a la macro.
-  * @param method Nombre del mtodo donde ocurre la creacin.
-  * @param state Estado de la creacin del recurso.
+  * @param method Nombre del método donde ocurre la creación.
+  * @param state Estado de la creación del recurso.
   */
 #define MESSAGE(classObj, method, state)                      \
 {                                                             \
-    std::ostringstream os_;                                   \
-    os_ << classObj << "::" << method << " : "                \
-        << "[CREATION OF RESOURCE" << ": " << state << "] \n";\
-    std::cerr << os_.str();                                   \
+    logResourceMessage(classObj, method, state);              \
 }
 
   /**
    * @brief Macro para manejar errores fatales.
    *
    * Esta macro imprime un mensaje detallado en la consola cuando ocurre un error
-   * en los parmetros recibidos, y termina la ejecucin del programa.
+   * en los parámetros recibidos, y termina la ejecución del programa.
    *
    * @param classObj Nombre de la clase donde ocurre el error.
-   * @param method Nombre del mtodo donde ocurre el error.
+   * @param method Nombre del método donde ocurre el error.
    * @param errorMSG Mensaje de error detallado.
    */
 #define ERROR(classObj, method, errorMSG)                         \
 {                                                                 \
-    std::ostringstream os_;                                       \
-    os_ << "ERROR : " << classObj << "::" << method << " : "      \
-        << "  Error in data from params [" << errorMSG << "] \n";  \
-    std::cerr << os_.str();                                       \
-    exit(1);                                                      \
+    logFatalError(classObj, method, errorMSG);                    \
 }
@@ -0,0 +1,365 @@
+#include "Profiler.h"
+#include <cstdio>
+#include "../Include/IMGUI/imgui.h"
+
+#if PROFILER_ENABLED
+
+/**
+ * @brief Instancia global del perfilador.
+ *
+ * @return Referencia al perfilador.
+ */
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+/**
+ * @brief Constructor. Fija el origen de tiempo.
+ */
+Profiler::Profiler()
+    : m_origin(std::chrono::steady_clock::now()) {
+}
+
+/**
+ * @brief Microsegundos transcurridos desde el arranque del perfilador.
+ *
+ * @return Tiempo actual en microsegundos.
+ */
+sf::Int64 Profiler::now() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - m_origin).count();
+}
+
+/**
+ * @brief Profundidad de anidación del hilo actual.
+ *
+ * @return Referencia al contador del hilo.
+ */
+sf::Uint32& Profiler::threadDepth() {
+    static thread_local sf::Uint32 depth = 0;
+    return depth;
+}
+
+/**
+ * @brief Búfer del hilo actual.
+ *
+ * Los búferes no se liberan nunca: un hilo puede seguir registrando zonas mientras el
+ * programa termina. Cuando un hilo acaba, su búfer queda retirado y, una vez vaciado por
+ * `endFrame`, lo reutiliza el siguiente hilo nuevo, así que la memoria no crece con
+ * hilos de vida corta.
+ *
+ * @return Búfer del hilo.
+ */
+Profiler::ThreadBuffer& Profiler::getThreadBuffer() {
+    // Marca el búfer como retirado al terminar el hilo.
+    struct Owner {
+        ThreadBuffer* buffer = nullptr;
+        ~Owner() {
+            if (buffer != nullptr) {
+                buffer->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+    static thread_local Owner owner;
+
+    if (owner.buffer == nullptr) {
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        for (ThreadBuffer* candidate : m_threads) {
+            if (candidate->retired.load(std::memory_order_acquire) &&
+                candidate->head.load(std::memory_order_relaxed) ==
+                candidate->tail.load(std::memory_order_acquire)) {
+                candidate->retired.store(false, std::memory_order_relaxed);
+                owner.buffer = candidate;
+                break;
+            }
+        }
+        if (owner.buffer == nullptr) {
+            owner.buffer = new ThreadBuffer();
+            owner.buffer->index = static_cast<sf::Uint32>(m_threads.size());
+            m_threads.push_back(owner.buffer);
+        }
+        owner.buffer->name = "Hilo " + std::to_string(owner.buffer->index);
+    }
+    return *owner.buffer;
+}
+
+/**
+ * @brief Registra una zona terminada en el búfer del hilo actual.
+ *
+ * Si el consumidor no ha vaciado el búfer y está lleno, la zona se descarta y se cuenta.
+ *
+ * @param zone Zona medida.
+ */
+void Profiler::record(const ProfileZone& zone) {
+    ThreadBuffer& buffer = getThreadBuffer();
+    std::size_t head = buffer.head.load(std::memory_order_relaxed);
+    std::size_t tail = buffer.tail.load(std::memory_order_acquire);
+    if (head - tail >= ThreadBuffer::kCapacity) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.zones[head & (ThreadBuffer::kCapacity - 1)] = zone;
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Nombra el hilo actual.
+ *
+ * @param name Literal de cadena.
+ */
+void Profiler::setThreadName(const char* name) {
+    ThreadBuffer& buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(m_threadsMutex);
+    buffer.name = name;
+}
+
+/**
+ * @brief Cierra el frame actual y recoge las zonas de todos los hilos.
+ *
+ * Las zonas de otros hilos (render, trabajadores) se asignan al frame en el que se
+ * recogen, aunque hayan empezado durante el anterior.
+ */
+void Profiler::endFrame() {
+    sf::Int64 frameEnd = now();
+
+    std::vector<ThreadBuffer*> threads;
+    std::vector<std::string> threadNames;
+    {
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        threads = m_threads;
+        for (ThreadBuffer* buffer : m_threads) {
+            threadNames.push_back(buffer->name);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_dataMutex);
+    m_threadNames.swap(threadNames);
+
+    ProfileFrame& frame = m_paused ? m_discarded : m_history[m_historyNext];
+    frame.zones.clear();
+    frame.index = m_frameIndex++;
+    frame.start = m_frameStart;
+    frame.end = frameEnd;
+    m_frameStart = frameEnd;
+
+    for (ThreadBuffer* buffer : threads) {
+        std::size_t tail = buffer->tail.load(std::memory_order_relaxed);
+        std::size_t head = buffer->head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) {
+            ProfileZone zone = buffer->zones[tail & (ThreadBuffer::kCapacity - 1)];
+            zone.thread = buffer->index;
+            frame.zones.push_back(zone);
+        }
+        buffer->tail.store(tail, std::memory_order_release);
+        m_droppedZones += buffer->dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+    if (m_frameCallback) {
+        m_frameCallback(frame, m_threadNames);
+    }
+
+    if (m_paused) {
+        return;
+    }
+
+    // Tiempo por frame de cada zona: suma de todas sus llamadas en este frame.
+    for (auto& entry : m_stats) {
+        entry.second.lastCalls = 0;
+        entry.second.lastMs = 0.0f;
+    }
+    for (const ProfileZone& zone : frame.zones) {
+        auto it = m_stats.find(std::string_view(zone.name));
+        if (it == m_stats.end()) {
+            it = m_stats.emplace(zone.name, ZoneStats()).first;
+        }
+        it->second.lastCalls++;
+        it->second.lastMs += (zone.end - zone.start) / 1000.0f;
+    }
+    for (auto& entry : m_stats) {
+        ZoneStats& stats = entry.second;
+        if (stats.lastCalls > 0) {
+            stats.samples[stats.next] = stats.lastMs;
+            stats.next = (stats.next + 1) % ZoneStats::kSamples;
+            stats.count = std::min(stats.count + 1, ZoneStats::kSamples);
+        }
+    }
+
+    m_historyNext = (m_historyNext + 1) % kHistorySize;
+    m_historyCount = std::min(m_historyCount + 1, kHistorySize);
+}
+
+/**
+ * @brief Pausa o reanuda la captura de frames en el historial.
+ *
+ * @param paused true para congelar la vista.
+ */
+void Profiler::setPaused(bool paused) {
+    std::lock_guard<std::mutex> lock(m_dataMutex);
+    m_paused = paused;
+}
+
+/**
+ * @brief Registra una función que recibe cada frame recogido por `endFrame`.
+ *
+ * @param callback Función a llamar (vacía para quitarla).
+ */
+void Profiler::setFrameCallback(FrameCallback callback) {
+    std::lock_guard<std::mutex> lock(m_dataMutex);
+    m_frameCallback = std::move(callback);
+}
+
+/**
+ * @brief Dibuja la ventana del perfilador.
+ *
+ * Copia el frame seleccionado y las estadísticas bajo el candado y dibuja sin él, para
+ * no frenar a `endFrame` mientras se construye la interfaz:
+ * - un histograma con la duración de los últimos frames,
+ * - el flame graph del frame seleccionado (una franja por hilo, una fila por nivel),
+ * - una tabla con llamadas, último, mínimo, promedio y p99 por zona.
+ */
+void Profiler::drawImGui() {
+    struct ZoneRow {
+        std::string name;
+        sf::Uint32 calls;
+        float lastMs, minMs, avgMs, p99Ms;
+    };
+
+    ProfileFrame frame;
+    std::vector<float> frameTimes;
+    std::vector<ZoneRow> rows;
+    std::vector<std::string> threadNames;
+    bool paused = false;
+    sf::Uint64 dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_dataMutex);
+        paused = m_paused;
+        dropped = m_droppedZones;
+        threadNames = m_threadNames;
+
+        for (std::size_t i = 0; i < m_historyCount; ++i) {
+            std::size_t index = (m_historyNext + kHistorySize - m_historyCount + i) % kHistorySize;
+            frameTimes.push_back((m_history[index].end - m_history[index].start) / 1000.0f);
+        }
+
+        m_selectedFrame = std::min(m_selectedFrame, std::max(0, static_cast<int>(m_historyCount) - 1));
+        if (m_historyCount > 0) {
+            std::size_t index = (m_historyNext + kHistorySize - 1 - m_selectedFrame) % kHistorySize;
+            frame = m_history[index];
+        }
+
+        for (const auto& entry : m_stats) {
+            const ZoneStats& stats = entry.second;
+            if (stats.count == 0) {
+                continue;
+            }
+            float samples[ZoneStats::kSamples];
+            std::copy(stats.samples, stats.samples + stats.count, samples);
+            float sum = 0.0f;
+            float minMs = samples[0];
+            for (std::size_t i = 0; i < stats.count; ++i) {
+                sum += samples[i];
+                minMs = std::min(minMs, samples[i]);
+            }
+            std::size_t p99Index = std::min(stats.count - 1, (stats.count * 99) / 100);
+            std::nth_element(samples, samples + p99Index, samples + stats.count);
+            rows.push_back({ entry.first, stats.lastCalls, stats.lastMs, minMs, sum / stats.count, samples[p99Index] });
+        }
+    }
+
+    ImGui::Begin("Profiler");
+
+    if (ImGui::Checkbox("Pausar", &paused)) {
+        setPaused(paused);
+    }
+    if (paused && frameTimes.size() > 1) {
+        ImGui::SameLine();
+        ImGui::SliderInt("Frames atras", &m_selectedFrame, 0, static_cast<int>(frameTimes.size()) - 1);
+    }
+    if (dropped > 0) {
+        ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.3f, 1.0f), "Zonas perdidas: %llu", static_cast<unsigned long long>(dropped));
+    }
+
+    if (!frameTimes.empty()) {
+        char overlay[64];
+        std::snprintf(overlay, sizeof(overlay), "%.2f ms", frameTimes.back());
+        ImGui::PlotHistogram("##frames", frameTimes.data(), static_cast<int>(frameTimes.size()), 0, overlay,
+                             0.0f, FLT_MAX, ImVec2(ImGui::GetContentRegionAvail().x, 60.0f));
+    }
+
+    // Flame graph del frame seleccionado.
+    const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+    const double frameDuration = static_cast<double>(std::max<sf::Int64>(1, frame.end - frame.start));
+    std::vector<sf::Uint32> threadDepth(threadNames.size(), 0);
+    for (const ProfileZone& zone : frame.zones) {
+        if (zone.thread < threadDepth.size()) {
+            threadDepth[zone.thread] = std::max(threadDepth[zone.thread], zone.depth + 1);
+        }
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const float width = ImGui::GetContentRegionAvail().x;
+    for (std::size_t thread = 0; thread < threadNames.size(); ++thread) {
+        if (threadDepth[thread] == 0) {
+            continue;
+        }
+        ImGui::TextUnformatted(threadNames[thread].c_str());
+        ImVec2 origin = ImGui::GetCursorScreenPos();
+        ImGui::Dummy(ImVec2(width, rowHeight * threadDepth[thread]));
+
+        for (const ProfileZone& zone : frame.zones) {
+            if (zone.thread != thread) {
+                continue;
+            }
+            double start = std::max(0.0, (zone.start - frame.start) / frameDuration);
+            double end = std::min(1.0, (zone.end - frame.start) / frameDuration);
+            if (end <= start) {
+                continue;
+            }
+
+            ImVec2 min(origin.x + static_cast<float>(start) * width, origin.y + zone.depth * rowHeight);
+            ImVec2 max(origin.x + static_cast<float>(end) * width, min.y + rowHeight - 1.0f);
+
+            // Color estable por nombre de zona.
+            ImU32 hash = ImGui::GetID(zone.name);
+            ImU32 color = IM_COL32(90 + (hash & 0x7F), 90 + ((hash >> 8) & 0x7F), 90 + ((hash >> 16) & 0x7F), 255);
+            drawList->AddRectFilled(min, max, color);
+
+            char label[128];
+            std::snprintf(label, sizeof(label), "%s %.2f ms", zone.name, (zone.end - zone.start) / 1000.0f);
+            if (ImGui::CalcTextSize(label).x < max.x - min.x - 4.0f) {
+                drawList->AddText(ImVec2(min.x + 2.0f, min.y + 2.0f), IM_COL32(0, 0, 0, 255), label);
+            }
+            if (ImGui::IsMouseHoveringRect(min, max)) {
+                ImGui::SetTooltip("%s", label);
+            }
+        }
+    }
+
+    // Tabla de estadísticas, de la zona más cara a la más barata.
+    std::sort(rows.begin(), rows.end(), [](const ZoneRow& a, const ZoneRow& b) { return a.avgMs > b.avgMs; });
+    if (ImGui::BeginTable("zones", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Zona");
+        ImGui::TableSetupColumn("Llamadas");
+        ImGui::TableSetupColumn("Ultimo ms");
+        ImGui::TableSetupColumn("Min ms");
+        ImGui::TableSetupColumn("Prom ms");
+        ImGui::TableSetupColumn("p99 ms");
+        ImGui::TableHeadersRow();
+        for (const ZoneRow& row : rows) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(row.name.c_str());
+            ImGui::TableNextColumn(); ImGui::Text("%u", row.calls);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", row.lastMs);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", row.minMs);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", row.avgMs);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", row.p99Ms);
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
+
+#endif
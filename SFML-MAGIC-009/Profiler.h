@@ -0,0 +1,255 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+
+/**
+ * @brief Activa el perfilador de CPU.
+ *
+ * Las compilaciones recortadas definen `PROFILER_ENABLED=0`: las macros quedan vacías y
+ * el perfilador no se compila ni se enlaza.
+ */
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+#if PROFILER_ENABLED
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <map>
+#include <string_view>
+#include <functional>
+
+#define PROFILER_CONCAT_IMPL(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Mide el bloque actual como una zona con nombre.
+ *
+ * @param name Literal de cadena (debe vivir durante toda la ejecución).
+ */
+#define PROFILE_SCOPE(name) ProfileScope PROFILER_CONCAT(profileScope_, __LINE__)(name)
+
+/**
+ * @brief Mide la función actual como una zona con su nombre.
+ */
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+
+/**
+ * @brief Asigna un nombre al hilo actual en la vista del perfilador.
+ *
+ * @param name Literal de cadena.
+ */
+#define PROFILE_THREAD(name) Profiler::getInstance().setThreadName(name)
+
+/**
+ * @brief Cierra el frame actual: recoge las zonas de todos los hilos y actualiza estadísticas.
+ */
+#define PROFILE_FRAME() Profiler::getInstance().endFrame()
+
+/**
+ * @struct ProfileZone
+ * @brief Una zona medida: nombre, inicio y fin en microsegundos y profundidad de anidación.
+ */
+struct ProfileZone {
+    const char* name = nullptr;   ///< Nombre de la zona (literal de cadena).
+    sf::Int64 start = 0;          ///< Inicio en microsegundos desde el arranque del perfilador.
+    sf::Int64 end = 0;            ///< Fin en microsegundos.
+    sf::Uint32 thread = 0;        ///< Índice del hilo que la midió.
+    sf::Uint32 depth = 0;         ///< Zonas abiertas por encima de esta en el mismo hilo.
+};
+
+/**
+ * @struct ProfileFrame
+ * @brief Zonas recogidas en un frame completo.
+ */
+struct ProfileFrame {
+    sf::Uint64 index = 0;             ///< Número de frame desde el arranque.
+    sf::Int64 start = 0;              ///< Inicio del frame en microsegundos.
+    sf::Int64 end = 0;                ///< Fin del frame en microsegundos.
+    std::vector<ProfileZone> zones;   ///< Zonas recogidas en el frame.
+};
+
+/**
+ * @class Profiler
+ * @brief Perfilador de CPU por zonas con búferes circulares por hilo.
+ *
+ * Cada hilo escribe sus zonas en su propio búfer circular de un solo productor y un solo
+ * consumidor, sin candados: medir una zona cuesta dos lecturas del reloj y una escritura.
+ * `endFrame` (hilo principal) vacía todos los búferes una vez por frame, guarda el frame
+ * en un historial circular y actualiza las estadísticas por zona. La ventana de ImGui
+ * puede dibujarse desde otro hilo (por ejemplo, el de render).
+ */
+class Profiler {
+public:
+    /**
+     * @brief Función que recibe cada frame recogido y los nombres de los hilos por índice.
+     */
+    using FrameCallback = std::function<void(const ProfileFrame& frame, const std::vector<std::string>& threadNames)>;
+
+    /**
+     * @brief Instancia global del perfilador.
+     *
+     * @return Referencia al perfilador.
+     */
+    static Profiler& getInstance();
+
+    /**
+     * @brief Microsegundos transcurridos desde el arranque del perfilador.
+     *
+     * @return Tiempo actual en microsegundos.
+     */
+    sf::Int64 now() const;
+
+    /**
+     * @brief Registra una zona terminada en el búfer del hilo actual.
+     *
+     * @param zone Zona medida.
+     */
+    void record(const ProfileZone& zone);
+
+    /**
+     * @brief Nombra el hilo actual.
+     *
+     * @param name Literal de cadena.
+     */
+    void setThreadName(const char* name);
+
+    /**
+     * @brief Cierra el frame actual y recoge las zonas de todos los hilos.
+     */
+    void endFrame();
+
+    /**
+     * @brief Dibuja la ventana del perfilador (flame graph y tabla de zonas).
+     */
+    void drawImGui();
+
+    /**
+     * @brief Pausa o reanuda la captura de frames en el historial.
+     *
+     * @param paused true para congelar la vista.
+     */
+    void setPaused(bool paused);
+
+    /**
+     * @brief Registra una función que recibe cada frame recogido por `endFrame`.
+     *
+     * Se llama desde `endFrame` con el candado de datos tomado, así que debe ser breve y
+     * no llamar al perfilador. Recibe los frames aunque la vista esté en pausa.
+     *
+     * @param callback Función a llamar (vacía para quitarla).
+     */
+    void setFrameCallback(FrameCallback callback);
+
+    /**
+     * @brief Profundidad de anidación del hilo actual (uso interno de `ProfileScope`).
+     *
+     * @return Referencia al contador del hilo.
+     */
+    static sf::Uint32& threadDepth();
+
+private:
+    /**
+     * @struct ThreadBuffer
+     * @brief Búfer circular de un hilo (un productor: el hilo; un consumidor: `endFrame`).
+     */
+    struct ThreadBuffer {
+        static constexpr std::size_t kCapacity = 8192;  ///< Zonas por búfer (potencia de 2).
+        ProfileZone zones[kCapacity];          ///< Zonas pendientes de recoger.
+        std::atomic<std::size_t> head{ 0 };    ///< Siguiente posición a escribir (productor).
+        std::atomic<std::size_t> tail{ 0 };    ///< Siguiente posición a leer (consumidor).
+        std::atomic<sf::Uint64> dropped{ 0 };  ///< Zonas perdidas con el búfer lleno.
+        std::atomic<bool> retired{ false };    ///< El hilo dueño terminó; puede reutilizarse.
+        std::string name;                      ///< Nombre del hilo.
+        sf::Uint32 index = 0;                  ///< Índice del hilo en el perfilador.
+    };
+
+    /**
+     * @struct ZoneStats
+     * @brief Tiempo por frame de una zona en los últimos frames.
+     */
+    struct ZoneStats {
+        static constexpr std::size_t kSamples = 240;  ///< Frames de la ventana de medición.
+        float samples[kSamples] = {};  ///< Milisegundos por frame (suma de llamadas).
+        std::size_t count = 0;         ///< Muestras válidas.
+        std::size_t next = 0;          ///< Siguiente posición a escribir.
+        sf::Uint32 lastCalls = 0;      ///< Llamadas en el último frame.
+        float lastMs = 0.0f;           ///< Tiempo en el último frame.
+    };
+
+    Profiler();
+
+    /**
+     * @brief Búfer del hilo actual (lo crea y registra la primera vez).
+     *
+     * @return Búfer del hilo.
+     */
+    ThreadBuffer& getThreadBuffer();
+
+    static constexpr std::size_t kHistorySize = 120;  ///< Frames guardados para el flame graph.
+
+    std::chrono::steady_clock::time_point m_origin;  ///< Arranque del perfilador.
+
+    std::mutex m_threadsMutex;                  ///< Protege la lista de búferes.
+    std::vector<ThreadBuffer*> m_threads;       ///< Búferes de todos los hilos (viven hasta el final).
+
+    mutable std::mutex m_dataMutex;             ///< Protege historial y estadísticas.
+    ProfileFrame m_history[kHistorySize];       ///< Últimos frames (circular).
+    std::size_t m_historyCount = 0;             ///< Frames válidos en el historial.
+    std::size_t m_historyNext = 0;              ///< Siguiente frame a escribir.
+    std::map<std::string, ZoneStats, std::less<>> m_stats;  ///< Estadísticas por nombre de zona.
+    std::vector<std::string> m_threadNames;     ///< Nombres de los hilos por índice.
+    sf::Int64 m_frameStart = 0;                 ///< Inicio del frame en curso.
+    sf::Uint64 m_droppedZones = 0;              ///< Zonas perdidas en total.
+    bool m_paused = false;                      ///< Vista congelada.
+    ProfileFrame m_discarded;                   ///< Destino de los frames recogidos en pausa.
+    sf::Uint64 m_frameIndex = 0;                ///< Frames cerrados desde el arranque.
+    FrameCallback m_frameCallback;              ///< Receptor de frames (exportador de trazas).
+    int m_selectedFrame = 0;                    ///< Frame mostrado (0 = el más reciente); solo lo usa la interfaz.
+};
+
+/**
+ * @class ProfileScope
+ * @brief Temporizador RAII: mide desde su construcción hasta su destrucción.
+ */
+class ProfileScope {
+public:
+    /**
+     * @brief Empieza a medir la zona.
+     *
+     * @param name Literal de cadena con el nombre de la zona.
+     */
+    explicit ProfileScope(const char* name)
+        : m_name(name), m_start(Profiler::getInstance().now()), m_depth(Profiler::threadDepth()++) {}
+
+    /**
+     * @brief Termina la zona y la registra en el búfer del hilo.
+     */
+    ~ProfileScope() {
+        ProfileZone zone;
+        zone.name = m_name;
+        zone.start = m_start;
+        zone.end = Profiler::getInstance().now();
+        zone.depth = m_depth;
+        --Profiler::threadDepth();
+        Profiler::getInstance().record(zone);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name;    ///< Nombre de la zona.
+    sf::Int64 m_start;     ///< Inicio en microsegundos.
+    sf::Uint32 m_depth;    ///< Profundidad de anidación.
+};
+
+#else
+
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#define PROFILE_FRAME() ((void)0)
+
+#endif
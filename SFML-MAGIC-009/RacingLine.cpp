@@ -0,0 +1,188 @@
+#include "RacingLine.h"
+
+namespace {
+/**
+ * @brief Longitud de un vector.
+ */
+float lengthOf(const sf::Vector2f& v) {
+    return std::sqrt(v.x * v.x + v.y * v.y);
+}
+}
+
+/**
+ * @brief Constructor. Evalúa la curva densamente y la remuestrea por longitud de arco.
+ *
+ * @param points Waypoints por los que pasa la curva.
+ * @param closed true si la curva vuelve al primer waypoint.
+ * @param spacing Distancia entre entradas de la tabla, en píxeles.
+ * @param alpha Parametrización de Catmull-Rom: 0 uniforme, 0.5 centrípeta, 1 cordal.
+ */
+RacingLine::RacingLine(const std::vector<sf::Vector2f>& points, bool closed, float spacing, float alpha)
+    : m_closed(closed) {
+    std::vector<sf::Vector2f> waypoints;
+    for (const sf::Vector2f& point : points) {
+        if (waypoints.empty() || point != waypoints.back()) {
+            waypoints.push_back(point);
+        }
+    }
+    if (m_closed && waypoints.size() > 1 && waypoints.front() == waypoints.back()) {
+        waypoints.pop_back();
+    }
+    if (waypoints.size() < 2) {
+        sf::Vector2f point = waypoints.empty() ? sf::Vector2f(0.0f, 0.0f) : waypoints.front();
+        m_table.push_back({ point, sf::Vector2f(1.0f, 0.0f) });
+        m_table.push_back({ point, sf::Vector2f(1.0f, 0.0f) });
+        return;
+    }
+
+    // 1. Evaluación densa de cada tramo y longitudes acumuladas de la polilínea resultante.
+    const std::size_t n = waypoints.size();
+    const std::size_t segmentCount = m_closed ? n : n - 1;
+    const int samplesPerSegment = 64;
+    std::vector<sf::Vector2f> dense;
+    dense.reserve(segmentCount * samplesPerSegment + 1);
+    dense.push_back(waypoints[0]);
+    for (std::size_t i = 0; i < segmentCount; ++i) {
+        const sf::Vector2f& p1 = waypoints[i];
+        const sf::Vector2f& p2 = waypoints[(i + 1) % n];
+        // En una curva abierta los extremos se prolongan reflejando el tramo vecino.
+        sf::Vector2f p0 = (m_closed || i > 0) ? waypoints[(i + n - 1) % n] : p1 * 2.0f - p2;
+        sf::Vector2f p3 = (m_closed || i + 2 < n) ? waypoints[(i + 2) % n] : p2 * 2.0f - p1;
+        for (int k = 1; k <= samplesPerSegment; ++k) {
+            dense.push_back(evaluateSegment(p0, p1, p2, p3, alpha, static_cast<float>(k) / samplesPerSegment));
+        }
+    }
+
+    std::vector<float> cumulative(dense.size(), 0.0f);
+    for (std::size_t i = 1; i < dense.size(); ++i) {
+        cumulative[i] = cumulative[i - 1] + lengthOf(dense[i] - dense[i - 1]);
+    }
+    m_length = cumulative.back();
+
+    // 2. Remuestreo a pasos iguales: el paso se ajusta para que la última entrada caiga
+    //    exactamente al final de la curva.
+    std::size_t steps = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(m_length / std::max(spacing, 0.01f))));
+    m_spacing = m_length / steps;
+    m_invSpacing = m_spacing > 0.0f ? 1.0f / m_spacing : 0.0f;
+    m_table.resize(steps + 1);
+    std::size_t segment = 0;
+    for (std::size_t j = 0; j <= steps; ++j) {
+        float s = std::min(m_length, j * m_spacing);
+        while (segment + 2 < dense.size() && cumulative[segment + 1] < s) {
+            ++segment;
+        }
+        float span = cumulative[segment + 1] - cumulative[segment];
+        float t = span > 0.0f ? (s - cumulative[segment]) / span : 0.0f;
+        m_table[j].position = dense[segment] + (dense[segment + 1] - dense[segment]) * t;
+    }
+    if (m_closed) {
+        m_table.back().position = m_table.front().position;
+    }
+
+    // 3. Tangentes por diferencias centrales sobre la tabla.
+    for (std::size_t j = 0; j <= steps; ++j) {
+        sf::Vector2f before;
+        sf::Vector2f after;
+        if (j > 0 && j < steps) {
+            before = m_table[j - 1].position;
+            after = m_table[j + 1].position;
+        }
+        else if (m_closed) {
+            before = m_table[steps - 1].position;
+            after = m_table[std::min<std::size_t>(1, steps)].position;
+        }
+        else {
+            before = m_table[j == 0 ? 0 : steps - 1].position;
+            after = m_table[j == 0 ? 1 : steps].position;
+        }
+        sf::Vector2f direction = after - before;
+        float length = lengthOf(direction);
+        m_table[j].tangent = length > 0.0f ? direction / length : sf::Vector2f(1.0f, 0.0f);
+    }
+}
+
+/**
+ * @brief Posición y tangente a una distancia desde el primer waypoint.
+ *
+ * @param distance Distancia sobre la curva (da la vuelta si es cerrada).
+ * @return Punto y dirección de avance.
+ */
+RacingLineSample RacingLine::sample(float distance) const {
+    float f = wrapDistance(distance) * m_invSpacing;
+    std::size_t i = std::min(static_cast<std::size_t>(f), m_table.size() - 2);
+    float t = f - static_cast<float>(i);
+    const RacingLineSample& a = m_table[i];
+    const RacingLineSample& b = m_table[i + 1];
+
+    RacingLineSample result;
+    result.position = a.position + (b.position - a.position) * t;
+    result.tangent = a.tangent + (b.tangent - a.tangent) * t;
+    float length = lengthOf(result.tangent);
+    if (length > 0.0f) {
+        result.tangent /= length;
+    }
+    return result;
+}
+
+/**
+ * @brief Posición a una distancia desde el primer waypoint.
+ *
+ * @param distance Distancia sobre la curva (da la vuelta si es cerrada).
+ * @return Punto de la curva.
+ */
+sf::Vector2f RacingLine::getPosition(float distance) const {
+    float f = wrapDistance(distance) * m_invSpacing;
+    std::size_t i = std::min(static_cast<std::size_t>(f), m_table.size() - 2);
+    float t = f - static_cast<float>(i);
+    return m_table[i].position + (m_table[i + 1].position - m_table[i].position) * t;
+}
+
+/**
+ * @brief Lleva una distancia al rango válido de la curva.
+ *
+ * @param distance Distancia arbitraria.
+ * @return Distancia en [0, longitud] (dando la vuelta si es cerrada).
+ */
+float RacingLine::wrapDistance(float distance) const {
+    if (m_length <= 0.0f) {
+        return 0.0f;
+    }
+    if (!m_closed) {
+        return std::clamp(distance, 0.0f, m_length);
+    }
+    if (distance >= m_length || distance < 0.0f) {
+        distance -= m_length * std::floor(distance / m_length);
+        if (distance >= m_length) distance = 0.0f;
+    }
+    return distance;
+}
+
+/**
+ * @brief Evalúa un tramo de Catmull-Rom (forma piramidal de Barry-Goldman).
+ *
+ * @param p0 Waypoint anterior al tramo.
+ * @param p1 Inicio del tramo.
+ * @param p2 Fin del tramo.
+ * @param p3 Waypoint siguiente al tramo.
+ * @param alpha Parametrización.
+ * @param u Parámetro normalizado en [0, 1].
+ * @return Punto de la curva.
+ */
+sf::Vector2f RacingLine::evaluateSegment(const sf::Vector2f& p0, const sf::Vector2f& p1,
+                                         const sf::Vector2f& p2, const sf::Vector2f& p3,
+                                         float alpha, float u) {
+    // Nudos separados por |Pi+1 - Pi|^alpha (con un mínimo para puntos coincidentes).
+    const float minimumKnot = 1e-4f;
+    float t0 = 0.0f;
+    float t1 = t0 + std::max(minimumKnot, std::pow(lengthOf(p1 - p0), alpha));
+    float t2 = t1 + std::max(minimumKnot, std::pow(lengthOf(p2 - p1), alpha));
+    float t3 = t2 + std::max(minimumKnot, std::pow(lengthOf(p3 - p2), alpha));
+    float t = t1 + (t2 - t1) * u;
+
+    sf::Vector2f a1 = p0 * ((t1 - t) / (t1 - t0)) + p1 * ((t - t0) / (t1 - t0));
+    sf::Vector2f a2 = p1 * ((t2 - t) / (t2 - t1)) + p2 * ((t - t1) / (t2 - t1));
+    sf::Vector2f a3 = p2 * ((t3 - t) / (t3 - t2)) + p3 * ((t - t2) / (t3 - t2));
+    sf::Vector2f b1 = a1 * ((t2 - t) / (t2 - t0)) + a2 * ((t - t0) / (t2 - t0));
+    sf::Vector2f b2 = a2 * ((t3 - t) / (t3 - t1)) + a3 * ((t - t1) / (t3 - t1));
+    return b1 * ((t2 - t) / (t2 - t1)) + b2 * ((t - t1) / (t2 - t1));
+}
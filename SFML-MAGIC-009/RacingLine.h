@@ -0,0 +1,107 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+
+/**
+ * @struct RacingLineSample
+ * @brief Punto de una línea de carrera: posición y dirección de avance.
+ */
+struct RacingLineSample {
+    sf::Vector2f position;  ///< Punto de la curva.
+    sf::Vector2f tangent;   ///< Dirección de avance (unitaria).
+};
+
+/**
+ * @class RacingLine
+ * @brief Línea de carrera suave (Catmull-Rom) con tabla de longitud de arco precalculada.
+ *
+ * La curva pasa por todos los waypoints. Con `alpha = 0.5` (Catmull-Rom centrípeta) no
+ * forma lazos ni picos aunque los waypoints estén muy desigualmente espaciados.
+ *
+ * Una curva paramétrica no avanza a rapidez constante con su parámetro, y obtener el
+ * punto a una distancia `s` exigiría integrar y resolver iterativamente. Por eso al
+ * construirla se evalúa la curva densamente una sola vez y se remuestrea a pasos iguales
+ * de longitud de arco: la tabla resultante da posición y tangente a cualquier distancia
+ * con un índice y una interpolación lineal, en O(1) y sin ramas por tramo.
+ *
+ * Es inmutable después de construida: cualquier número de hilos la puede muestrear a la vez.
+ */
+class RacingLine {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param points Waypoints por los que pasa la curva.
+     * @param closed true si la curva vuelve al primer waypoint.
+     * @param spacing Distancia entre entradas de la tabla, en píxeles.
+     * @param alpha Parametrización de Catmull-Rom: 0 uniforme, 0.5 centrípeta, 1 cordal.
+     */
+    explicit RacingLine(const std::vector<sf::Vector2f>& points, bool closed = true,
+                        float spacing = 2.0f, float alpha = 0.5f);
+
+    /**
+     * @brief Posición y tangente a una distancia desde el primer waypoint.
+     *
+     * @param distance Distancia sobre la curva (da la vuelta si es cerrada).
+     * @return Punto y dirección de avance.
+     */
+    RacingLineSample sample(float distance) const;
+
+    /**
+     * @brief Posición a una distancia desde el primer waypoint.
+     *
+     * @param distance Distancia sobre la curva (da la vuelta si es cerrada).
+     * @return Punto de la curva.
+     */
+    sf::Vector2f getPosition(float distance) const;
+
+    /**
+     * @brief Lleva una distancia al rango válido de la curva.
+     *
+     * @param distance Distancia arbitraria.
+     * @return Distancia en [0, longitud] (dando la vuelta si es cerrada).
+     */
+    float wrapDistance(float distance) const;
+
+    /**
+     * @brief Longitud total de la curva.
+     *
+     * @return Longitud en píxeles.
+     */
+    float getLength() const { return m_length; }
+
+    /**
+     * @brief Indica si la curva se recorre en bucle.
+     *
+     * @return true si es cerrada.
+     */
+    bool isClosed() const { return m_closed; }
+
+    /**
+     * @brief Entradas de la tabla (para dibujarla o depurarla).
+     *
+     * @return Muestras equiespaciadas por longitud de arco.
+     */
+    const std::vector<RacingLineSample>& getTable() const { return m_table; }
+
+private:
+    /**
+     * @brief Evalúa un tramo de Catmull-Rom (forma piramidal de Barry-Goldman).
+     *
+     * @param p0 Waypoint anterior al tramo.
+     * @param p1 Inicio del tramo.
+     * @param p2 Fin del tramo.
+     * @param p3 Waypoint siguiente al tramo.
+     * @param alpha Parametrización.
+     * @param u Parámetro normalizado en [0, 1].
+     * @return Punto de la curva.
+     */
+    static sf::Vector2f evaluateSegment(const sf::Vector2f& p0, const sf::Vector2f& p1,
+                                        const sf::Vector2f& p2, const sf::Vector2f& p3,
+                                        float alpha, float u);
+
+    std::vector<RacingLineSample> m_table;  ///< Muestras cada `m_spacing` píxeles (la última cierra la curva).
+    float m_spacing = 2.0f;                 ///< Distancia entre muestras.
+    float m_invSpacing = 0.5f;              ///< 1 / `m_spacing`.
+    float m_length = 0.0f;                  ///< Longitud total.
+    bool m_closed = true;                   ///< La curva vuelve al primer waypoint.
+};
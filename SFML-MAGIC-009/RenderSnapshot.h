@@ -0,0 +1,86 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Window/Event.hpp>
+
+/**
+ * @struct RenderCommand
+ * @brief Una llamada de dibujo grabada en un `RenderSnapshot`.
+ *
+ * Puede referirse a un rango de vértices copiados en el snapshot o a un `sf::Drawable`
+ * externo (por ejemplo, un `sf::VertexBuffer` horneado) que debe seguir vivo y sin
+ * cambios hasta que el frame se presente.
+ */
+struct RenderCommand {
+    std::size_t firstVertex = 0;    ///< Índice del primer vértice dentro del snapshot.
+    std::size_t vertexCount = 0;    ///< Número de vértices del comando.
+    sf::PrimitiveType type = sf::Triangles;  ///< Tipo de primitiva de los vértices.
+    sf::RenderStates states;        ///< Transformación, textura y mezcla del comando.
+    const sf::Drawable* drawable = nullptr;  ///< Objeto externo a dibujar (si no hay vértices).
+};
+
+/**
+ * @struct RenderSnapshot
+ * @brief Copia inmutable de todo lo que hay que dibujar en un frame.
+ *
+ * La simulación escribe el snapshot (vértices con sus transformaciones, texturas y
+ * colores) mientras el hilo de render presenta el anterior. Los vectores se reutilizan
+ * entre frames para no reservar memoria en cada uno.
+ */
+struct RenderSnapshot {
+    std::vector<sf::Vertex> vertices;       ///< Vértices de todos los comandos del frame.
+    std::vector<RenderCommand> commands;    ///< Llamadas de dibujo en orden.
+    std::vector<sf::Event> uiEvents;        ///< Eventos que ImGui debe procesar en este frame.
+    sf::View view;                          ///< Vista con la que se dibuja el frame.
+    sf::Color clearColor = sf::Color::Black;  ///< Color con el que se limpia la ventana.
+    sf::Time uiDeltaTime;                   ///< Tiempo transcurrido desde el último frame de ImGui.
+    bool renderUI = false;                  ///< Si el frame incluye la interfaz de ImGui.
+
+    /**
+     * @brief Vacía el snapshot conservando la memoria reservada.
+     */
+    void clear() {
+        vertices.clear();
+        commands.clear();
+        uiEvents.clear();
+        clearColor = sf::Color::Black;
+        uiDeltaTime = sf::Time::Zero;
+        renderUI = false;
+    }
+
+    /**
+     * @brief Copia un arreglo de vértices al snapshot y graba el comando que los dibuja.
+     *
+     * @param source Puntero al primer vértice.
+     * @param count Número de vértices.
+     * @param type Tipo de primitiva.
+     * @param states Estados de render del comando.
+     */
+    void addVertices(const sf::Vertex* source, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states) {
+        RenderCommand command;
+        command.firstVertex = vertices.size();
+        command.vertexCount = count;
+        command.type = type;
+        command.states = states;
+        vertices.insert(vertices.end(), source, source + count);
+        commands.push_back(command);
+    }
+
+    /**
+     * @brief Graba un objeto externo para dibujarlo al presentar el frame.
+     *
+     * @param drawable Objeto a dibujar (debe seguir vivo hasta que se presente el frame).
+     * @param states Estados de render del comando.
+     */
+    void addDrawable(const sf::Drawable& drawable, const sf::RenderStates& states) {
+        RenderCommand command;
+        command.states = states;
+        command.drawable = &drawable;
+        commands.push_back(command);
+    }
+};
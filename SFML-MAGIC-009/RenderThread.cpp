@@ -0,0 +1,131 @@
+#include "RenderThread.h"
+#include "Profiler.h"
+
+/**
+ * @brief Destructor. Detiene el hilo si sigue en marcha.
+ */
+RenderThread::~RenderThread() {
+    stop();
+}
+
+/**
+ * @brief Inicia el hilo de render.
+ *
+ * @param onStart Inicialización en el hilo de render.
+ * @param present Presentación de cada snapshot.
+ * @param onStop Limpieza en el hilo de render.
+ */
+void RenderThread::start(std::function<void()> onStart,
+                         std::function<void(RenderSnapshot&)> present,
+                         std::function<void()> onStop) {
+    if (isRunning()) {
+        return;
+    }
+
+    m_onStart = onStart;
+    m_present = present;
+    m_onStop = onStop;
+    m_pending = false;
+    m_running = true;
+    m_thread = std::thread(&RenderThread::threadMain, this);
+}
+
+/**
+ * @brief Presenta el frame pendiente (si lo hay) y detiene el hilo.
+ */
+void RenderThread::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) {
+            return;
+        }
+        m_running = false;
+    }
+    m_condition.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+/**
+ * @brief Indica si el hilo de render está en marcha.
+ *
+ * @return true si hay un hilo consumiendo snapshots.
+ */
+bool RenderThread::isRunning() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_running;
+}
+
+/**
+ * @brief Snapshot que la simulación está escribiendo.
+ *
+ * @return Referencia al búfer trasero.
+ */
+RenderSnapshot& RenderThread::getBackBuffer() {
+    return m_buffers[m_writeIndex];
+}
+
+/**
+ * @brief Publica el búfer trasero para que el hilo de render lo presente.
+ */
+void RenderThread::submit() {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return !m_pending; });
+
+        m_readIndex = m_writeIndex;
+        m_writeIndex = 1 - m_writeIndex;
+        m_pending = true;
+    }
+    m_condition.notify_all();
+}
+
+/**
+ * @brief Bloquea hasta que no quede ningún frame en vuelo.
+ */
+void RenderThread::waitIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this]() { return !m_pending; });
+}
+
+/**
+ * @brief Bucle principal del hilo de render.
+ *
+ * Espera un snapshot, lo presenta fuera del candado y avisa a la simulación de que el
+ * búfer vuelve a estar libre. Antes de salir presenta el frame pendiente, si lo hay.
+ */
+void RenderThread::threadMain() {
+    PROFILE_THREAD("Render");
+
+    if (m_onStart) {
+        m_onStart();
+    }
+
+    while (true) {
+        int readIndex = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_pending || !m_running; });
+            if (!m_pending) {
+                break;
+            }
+            readIndex = m_readIndex;
+        }
+
+        if (m_present) {
+            m_present(m_buffers[readIndex]);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending = false;
+        }
+        m_condition.notify_all();
+    }
+
+    if (m_onStop) {
+        m_onStop();
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "RenderSnapshot.h" // Datos de un frame listos para presentar.
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+
+/**
+ * @class RenderThread
+ * @brief Hilo dedicado que presenta snapshots de render con doble búfer.
+ *
+ * La simulación escribe el frame N+1 en el búfer trasero mientras este hilo presenta el
+ * frame N desde el delantero. `submit` intercambia los búferes y solo bloquea si el
+ * hilo de render todavía no terminó el frame anterior, de modo que simulación y envío
+ * de comandos se solapan como máximo un frame.
+ */
+class RenderThread {
+public:
+    /**
+     * @brief Constructor por defecto. El hilo no se inicia hasta llamar a `start`.
+     */
+    RenderThread() = default;
+
+    /**
+     * @brief Destructor. Detiene el hilo si sigue en marcha.
+     */
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief Inicia el hilo de render.
+     *
+     * @param onStart Se ejecuta una vez en el hilo de render antes del primer frame
+     *                (por ejemplo, para activar el contexto de OpenGL).
+     * @param present Se ejecuta en el hilo de render por cada snapshot enviado.
+     * @param onStop Se ejecuta en el hilo de render justo antes de terminar.
+     */
+    void start(std::function<void()> onStart,
+               std::function<void(RenderSnapshot&)> present,
+               std::function<void()> onStop);
+
+    /**
+     * @brief Presenta el frame pendiente (si lo hay) y detiene el hilo.
+     */
+    void stop();
+
+    /**
+     * @brief Indica si el hilo de render está en marcha.
+     *
+     * @return true si hay un hilo consumiendo snapshots.
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Snapshot que la simulación está escribiendo.
+     *
+     * @return Referencia al búfer trasero.
+     */
+    RenderSnapshot& getBackBuffer();
+
+    /**
+     * @brief Publica el búfer trasero para que el hilo de render lo presente.
+     *
+     * Espera a que el hilo termine el frame anterior, intercambia los búferes y regresa
+     * de inmediato; el nuevo búfer trasero ya no está en uso por el hilo de render.
+     */
+    void submit();
+
+    /**
+     * @brief Bloquea hasta que no quede ningún frame en vuelo.
+     *
+     * Útil antes de modificar o destruir recursos que un frame enviado todavía usa.
+     */
+    void waitIdle();
+
+private:
+    /**
+     * @brief Bucle principal del hilo de render.
+     */
+    void threadMain();
+
+    RenderSnapshot m_buffers[2];  ///< Búferes delantero y trasero.
+    int m_writeIndex = 0;         ///< Búfer que escribe la simulación.
+    int m_readIndex = 1;          ///< Búfer que presenta el hilo de render.
+    bool m_pending = false;       ///< Hay un frame enviado que aún no termina de presentarse.
+    bool m_running = false;       ///< El hilo debe seguir esperando frames.
+
+    std::thread m_thread;                     ///< Hilo de render.
+    mutable std::mutex m_mutex;               ///< Protege los índices y banderas.
+    std::condition_variable m_condition;      ///< Señala frames nuevos y frames terminados.
+
+    std::function<void()> m_onStart;                ///< Inicialización en el hilo de render.
+    std::function<void(RenderSnapshot&)> m_present; ///< Presentación de un snapshot.
+    std::function<void()> m_onStop;                 ///< Limpieza en el hilo de render.
+};
@@ -1,61 +1,65 @@
 #include "ShapeFactory.h"
 
 /**
- * @brief Implementacin del constructor parametrizado.
+ * @brief Implementación del constructor parametrizado.
  *
- * Inicializa la fbrica con un tipo especfico de forma.
+ * Inicializa la fábrica con un tipo específico de forma.
  */
 ShapeFactory::ShapeFactory(ShapeType shapeType)
-    : m_shape(nullptr), m_shapeType(shapeType), Component(ComponentType::SHAPE) {}
+    : m_shapeType(shapeType), Component(ComponentType::SHAPE) {}
 
 /**
- * @brief Crea una nueva forma geomtrica segn el tipo indicado.
+ * @brief Crea una nueva forma geométrica según el tipo indicado.
  *
- * Asigna la forma creada al puntero `m_shape` y devuelve un puntero a la forma.
+ * Usa los tamaños por defecto de cada tipo de forma.
  *
  * @param shapeType El tipo de forma a crear.
- * @return Puntero a la forma creada (`sf::Shape*`).
+ * @return Puntero compartido a la plantilla de la forma.
  */
-sf::Shape* ShapeFactory::createShape(ShapeType shapeType) {
-    m_shapeType = shapeType;
-
+EngineUtilities::TSharedPointer<ShapeTemplate> ShapeFactory::createShape(ShapeType shapeType) {
     switch (shapeType) {
-    case ShapeType::EMPTY:
-        return nullptr;
-
-    case ShapeType::CIRCLE: {
-        sf::CircleShape* circle = new sf::CircleShape(10.0f);
-        circle->setFillColor(sf::Color::White);
-        m_shape = circle;
-        return circle;
-    }
+    case ShapeType::CIRCLE:
+        return createShape(shapeType, sf::Vector2f(10.0f, 10.0f), 30);
 
-    case ShapeType::RECTANGLE: {
-        sf::RectangleShape* rectangle = new sf::RectangleShape(sf::Vector2f(100.0f, 50.0f));
-        rectangle->setFillColor(sf::Color::White);
-        m_shape = rectangle;
-        return rectangle;
-    }
+    case ShapeType::RECTANGLE:
+        return createShape(shapeType, sf::Vector2f(100.0f, 50.0f), 4);
 
-    case ShapeType::TRIANGLE: {
-        sf::CircleShape* triangle = new sf::CircleShape(50.0f, 3);  // Tringulo con 3 puntos.
-        triangle->setFillColor(sf::Color::White);
-        m_shape = triangle;
-        return triangle;
-    }
+    case ShapeType::TRIANGLE:
+        return createShape(shapeType, sf::Vector2f(50.0f, 50.0f), 3);  // Triángulo con 3 puntos.
 
     default:
-        return nullptr;
+        return createShape(ShapeType::EMPTY, sf::Vector2f(), 0);
     }
 }
 
+/**
+ * @brief Crea una forma geométrica con tamaño y número de puntos explícitos.
+ *
+ * En lugar de reservar una `sf::Shape` nueva (con su propio arreglo de vértices), la
+ * instancia obtiene la plantilla compartida de la caché.
+ *
+ * @param shapeType El tipo de forma a crear.
+ * @param size Radio o dimensiones de la forma.
+ * @param pointCount Número de puntos del contorno de un círculo.
+ * @return Puntero compartido a la plantilla de la forma.
+ */
+EngineUtilities::TSharedPointer<ShapeTemplate> ShapeFactory::createShape(ShapeType shapeType,
+                                                                         const sf::Vector2f& size,
+                                                                         std::size_t pointCount) {
+    m_shapeType = shapeType;
+    m_template = ShapeTemplate::acquire(shapeType, size, pointCount);
+    m_fillColor = sf::Color::White;
+    m_staticDirty = true;
+    return m_template;
+}
+
 /**
  * @brief Actualiza el estado de la forma.
  *
- * Este mtodo se ejecuta en cada frame para realizar cambios dinmicos si es necesario.
+ * Este método se ejecuta en cada frame para realizar cambios dinámicos si es necesario.
  */
 void ShapeFactory::update(float deltaTime) {
-    // Implementacin futura: Aadir lgica de actualizacin si es necesario.
+    // Implementación futura: Añadir lógica de actualización si es necesario.
 }
 
 /**
@@ -64,31 +68,61 @@ void ShapeFactory::update(float deltaTime) {
  * @param window Ventana donde se renderiza la forma.
  */
 void ShapeFactory::render(Window& window) {
-    if (m_shape != nullptr) {
-        window.draw(*m_shape);  // Dibuja la forma en la ventana.
+    if (m_template.isNull()) {
+        return;
+    }
+
+    if (m_isStatic) {
+        if (m_staticDirty) {
+            // El frame en vuelo del hilo de render puede seguir usando el buffer anterior.
+            window.waitForRenderThread();
+            bakeStaticGeometry(!window.isSoftwareRendering());
+        }
+
+        if (!m_staticBuffer.isNull() && !window.isSoftwareRendering()) {
+            window.draw(*m_staticBuffer, m_staticStates);
+        }
+        else if (!m_staticVertices.empty()) {
+            window.draw(m_staticVertices.data(), m_staticVertices.size(), sf::TriangleFan, m_staticStates);
+        }
+        return;
+    }
+
+    sf::RenderStates states;
+    states.transform = m_transformable.getTransform();
+    states.texture = m_texture;
+
+    // Sin color ni textura propios la plantilla se dibuja tal cual, sin copiar vértices.
+    if (m_fillColor == sf::Color::White && m_texture == nullptr) {
+        window.draw(m_template->getVertices(), m_template->getVertexCount(), sf::TriangleFan, states);
+        return;
     }
+
+    // Buffer temporal reutilizado entre instancias para aplicar color y coordenadas de textura.
+    static thread_local std::vector<sf::Vertex> scratch;
+    m_template->buildVertices(m_fillColor, m_textureRect, scratch);
+    window.draw(scratch.data(), scratch.size(), sf::TriangleFan, states);
 }
 
 /**
- * @brief Establece la posicin de la forma con coordenadas X e Y.
+ * @brief Establece la posición de la forma con coordenadas X e Y.
  *
  * @param x Coordenada X.
  * @param y Coordenada Y.
  */
 void ShapeFactory::setPosition(float x, float y) {
-    if (m_shape != nullptr) {
-        m_shape->setPosition(x, y);
-    }
+    setPosition(sf::Vector2f(x, y));
 }
 
 /**
- * @brief Establece la posicin de la forma con un vector 2D.
+ * @brief Establece la posición de la forma con un vector 2D.
  *
  * @param position Un vector con las coordenadas X e Y.
  */
 void ShapeFactory::setPosition(const sf::Vector2f& position) {
-    if (m_shape != nullptr) {
-        m_shape->setPosition(position);
+    if (m_transformable.getPosition() != position) {
+        m_transformable.setPosition(position);
+        m_staticDirty = true;
     }
 }
 
@@ -98,19 +132,21 @@ void ShapeFactory::setPosition(const sf::Vector2f& position) {
  * @param color El nuevo color a aplicar.
  */
 void ShapeFactory::setFillColor(const sf::Color& color) {
-    if (m_shape != nullptr) {
-        m_shape->setFillColor(color);
+    if (m_fillColor != color) {
+        m_fillColor = color;
+        m_staticDirty = true;
     }
 }
 
 /**
- * @brief Establece la rotacin de la forma en grados.
+ * @brief Establece la rotación de la forma en grados.
  *
- * @param angle ngulo de rotacin.
+ * @param angle Ángulo de rotación.
  */
 void ShapeFactory::setRotation(float angle) {
-    if (m_shape != nullptr) {
-        m_shape->setRotation(angle);
+    if (m_transformable.getRotation() != angle) {
+        m_transformable.setRotation(angle);
+        m_staticDirty = true;
     }
 }
 
@@ -120,16 +156,135 @@ void ShapeFactory::setRotation(float angle) {
  * @param scl Vector con los valores de escala.
  */
 void ShapeFactory::setScale(const sf::Vector2f& scl) {
-    if (m_shape != nullptr) {
-        m_shape->setScale(scl);
+    if (m_transformable.getScale() != scl) {
+        m_transformable.setScale(scl);
+        m_staticDirty = true;
+    }
+}
+
+/**
+ * @brief Asigna la textura de la forma.
+ *
+ * Igual que `sf::Shape::setTexture`, la primera textura asignada define el rectángulo
+ * de textura como la imagen completa.
+ *
+ * @param texture Textura a aplicar (puede ser `nullptr`).
+ */
+void ShapeFactory::setTexture(const sf::Texture* texture) {
+    if (texture != nullptr && m_texture == nullptr && m_textureRect == sf::IntRect()) {
+        sf::Vector2u size = texture->getSize();
+        m_textureRect = sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y));
+    }
+    m_texture = texture;
+    m_staticDirty = true;
+}
+
+/**
+ * @brief Marca la forma como estática o dinámica.
+ *
+ * @param isStatic true para hornear la geometría.
+ */
+void ShapeFactory::setStatic(bool isStatic) {
+    m_isStatic = isStatic;
+    m_staticDirty = true;
+}
+
+/**
+ * @brief Indica si la forma está marcada como estática.
+ *
+ * @return true si la geometría se dibuja desde el buffer horneado.
+ */
+bool ShapeFactory::isStatic() const {
+    return m_isStatic;
+}
+
+/**
+ * @brief Hornea la geometría de la instancia en un buffer de vértices.
+ *
+ * Copia la plantilla con el color y el rectángulo de textura de la instancia, y guarda
+ * la transformación y la textura en los estados de render horneados. La copia en el
+ * cliente se conserva para que el backend por software también pueda dibujarla.
+ *
+ * @param uploadToGpu true para subir la geometría a un `sf::VertexBuffer`.
+ */
+void ShapeFactory::bakeStaticGeometry(bool uploadToGpu) {
+    m_staticDirty = false;
+    m_staticVertices.clear();
+    m_staticBuffer.reset();
+
+    if (m_template.isNull()) {
+        return;
+    }
+
+    m_template->buildVertices(m_fillColor, m_textureRect, m_staticVertices);
+
+    m_staticStates = sf::RenderStates::Default;
+    m_staticStates.transform = m_transformable.getTransform();
+    m_staticStates.texture = m_texture;
+
+    // Subir la geometría a la GPU; si no hay soporte de VBO queda el arreglo del cliente.
+    if (uploadToGpu && sf::VertexBuffer::isAvailable()) {
+        m_staticBuffer.reset(new sf::VertexBuffer(sf::TriangleFan, sf::VertexBuffer::Static));
+        if (!m_staticBuffer->create(m_staticVertices.size()) ||
+            !m_staticBuffer->update(m_staticVertices.data())) {
+            m_staticBuffer.reset();
+        }
+    }
+}
+
+/**
+ * @brief Obtiene la plantilla de geometría compartida.
+ *
+ * @return Puntero compartido a la plantilla.
+ */
+const EngineUtilities::TSharedPointer<ShapeTemplate>& ShapeFactory::getTemplate() const {
+    return m_template;
+}
+
+/**
+ * @brief Obtiene la transformación de la instancia.
+ *
+ * @return Matriz de transformación de la forma.
+ */
+const sf::Transform& ShapeFactory::getTransform() const {
+    return m_transformable.getTransform();
+}
+
+/**
+ * @brief Obtiene los límites de la forma en coordenadas del mundo.
+ *
+ * @return Rectángulo alineado a los ejes que contiene la forma transformada.
+ */
+sf::FloatRect ShapeFactory::getGlobalBounds() const {
+    if (m_template.isNull()) {
+        return sf::FloatRect();
     }
+    return m_transformable.getTransform().transformRect(m_template->getLocalBounds());
+}
+
+/**
+ * @brief Obtiene el color de relleno de la instancia.
+ *
+ * @return Color de la forma.
+ */
+const sf::Color& ShapeFactory::getFillColor() const {
+    return m_fillColor;
+}
+
+/**
+ * @brief Obtiene la textura de la instancia.
+ *
+ * @return Puntero a la textura.
+ */
+const sf::Texture* ShapeFactory::getTexture() const {
+    return m_texture;
 }
 
 /**
- * @brief Devuelve un puntero a la forma creada.
+ * @brief Obtiene el tipo de forma gestionada.
  *
- * @return Puntero a la forma (`sf::Shape*`).
+ * @return Tipo de forma.
  */
-sf::Shape* ShapeFactory::getShape() {
-    return m_shape;
+ShapeType ShapeFactory::getShapeType() const {
+    return m_shapeType;
 }
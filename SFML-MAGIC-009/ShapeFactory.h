@@ -2,21 +2,31 @@
 #include "Prerequisites.h"  // Incluye dependencias esenciales.
 #include "Component.h"       // Define la clase base Component.
 #include "Window.h"          // Clase para gestionar la ventana principal.
+#include "ShapeTemplate.h"   // Geometría compartida entre instancias.
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 
 /**
  * @class ShapeFactory
- * @brief Fbrica de formas geomtricas.
+ * @brief Fábrica de formas geométricas.
  *
- * La clase `ShapeFactory` permite la creacin y gestin de formas geomtricas como crculos,
- * rectngulos y tringulos. Adems, facilita la manipulacin de propiedades como posicin,
- * color, rotacin y escala de dichas formas, y su posterior renderizado en la ventana.
+ * La clase `ShapeFactory` permite la creación y gestión de formas geométricas como círculos,
+ * rectángulos y triángulos. Además, facilita la manipulación de propiedades como posición,
+ * color, rotación y escala de dichas formas, y su posterior renderizado en la ventana.
+ *
+ * La geometría no se guarda por instancia: cada fábrica apunta a un `ShapeTemplate`
+ * compartido y solo conserva su transformación, color y textura.
  */
 class ShapeFactory : public Component {
 public:
     /**
      * @brief Constructor por defecto.
      *
-     * Inicializa la clase sin realizar ninguna accin adicional.
+     * Inicializa la clase sin realizar ninguna acción adicional.
      */
     ShapeFactory() = default;
 
@@ -31,28 +41,43 @@ public:
     /**
      * @brief Constructor parametrizado.
      *
-     * Inicializa la fbrica con un tipo especfico de forma a gestionar.
+     * Inicializa la fábrica con un tipo específico de forma a gestionar.
      *
-     * @param shapeType Tipo de forma que ser creada (CIRCLE, RECTANGLE, etc.).
+     * @param shapeType Tipo de forma que será creada (CIRCLE, RECTANGLE, etc.).
      */
     ShapeFactory(ShapeType shapeType);
 
     /**
-     * @brief Crea una nueva forma geomtrica segn el tipo indicado.
+     * @brief Crea una nueva forma geométrica según el tipo indicado.
+     *
+     * Usa los tamaños por defecto de la fábrica: círculo de radio 10, rectángulo de
+     * 100x50 y triángulo de radio 50.
+     *
+     * @param shapeType El tipo de forma a crear.
+     * @return Puntero compartido a la plantilla de la forma (nulo para `EMPTY`).
+     */
+    EngineUtilities::TSharedPointer<ShapeTemplate> createShape(ShapeType shapeType);
+
+    /**
+     * @brief Crea una forma geométrica con tamaño y número de puntos explícitos.
      *
-     * Asigna la forma creada al puntero `m_shape` para su posterior manipulacin.
+     * Las instancias con los mismos parámetros comparten la misma plantilla.
      *
      * @param shapeType El tipo de forma a crear.
-     * @return Puntero a la forma creada (`sf::Shape*`).
+     * @param size Radio (círculo y triángulo, en `size.x`) o dimensiones (rectángulo).
+     * @param pointCount Número de puntos del contorno de un círculo.
+     * @return Puntero compartido a la plantilla de la forma (nulo para `EMPTY`).
      */
-    sf::Shape* createShape(ShapeType shapeType);
+    EngineUtilities::TSharedPointer<ShapeTemplate> createShape(ShapeType shapeType,
+                                                               const sf::Vector2f& size,
+                                                               std::size_t pointCount = 30);
 
     /**
      * @brief Actualiza el estado de la forma en cada frame.
      *
-     * Este mtodo permite manejar animaciones o transiciones de la forma.
+     * Este método permite manejar animaciones o transiciones de la forma.
      *
-     * @param deltaTime Tiempo transcurrido desde el ltimo frame.
+     * @param deltaTime Tiempo transcurrido desde el último frame.
      */
     void update(float deltaTime) override;
 
@@ -66,7 +91,7 @@ public:
     void render(Window& window) override;
 
     /**
-     * @brief Establece la posicin de la forma con coordenadas X e Y.
+     * @brief Establece la posición de la forma con coordenadas X e Y.
      *
      * @param x Coordenada X.
      * @param y Coordenada Y.
@@ -74,7 +99,7 @@ public:
     void setPosition(float x, float y);
 
     /**
-     * @brief Establece la posicin de la forma con un vector 2D.
+     * @brief Establece la posición de la forma con un vector 2D.
      *
      * @param position Un vector que contiene las coordenadas X e Y.
      */
@@ -88,9 +113,9 @@ public:
     void setFillColor(const sf::Color& color);
 
     /**
-     * @brief Establece la rotacin de la forma en grados.
+     * @brief Establece la rotación de la forma en grados.
      *
-     * @param angle ngulo de rotacin.
+     * @param angle Ángulo de rotación.
      */
     void setRotation(float angle);
 
@@ -102,13 +127,98 @@ public:
     void setScale(const sf::Vector2f& scl);
 
     /**
-     * @brief Obtiene la forma creada.
+     * @brief Asigna la textura de la forma.
+     *
+     * Si la forma es estática, su geometría se vuelve a hornear en el siguiente render.
+     *
+     * @param texture Textura a aplicar (puede ser `nullptr`).
+     */
+    void setTexture(const sf::Texture* texture);
+
+    /**
+     * @brief Marca la forma como estática o dinámica.
      *
-     * @return Puntero a la forma creada (`sf::Shape*`).
+     * Una forma estática hornea su geometría una sola vez en un `sf::VertexBuffer`
+     * residente en GPU y, a partir de ahí, cada frame se reduce a un único draw del buffer.
+     * Si los VBO no están disponibles se usa un `sf::VertexArray` del lado del cliente,
+     * también construido una sola vez.
+     *
+     * @param isStatic true para hornear la geometría, false para dibujar la forma cada frame.
+     */
+    void setStatic(bool isStatic);
+
+    /**
+     * @brief Indica si la forma está marcada como estática.
+     *
+     * @return true si la geometría se dibuja desde el buffer horneado.
+     */
+    bool isStatic() const;
+
+    /**
+     * @brief Hornea la geometría actual de la forma.
+     *
+     * Copia la plantilla con el color y las coordenadas de textura de la instancia al
+     * `sf::VertexBuffer` y guarda su transformación y textura en los estados de render.
+     * Se llama automáticamente desde `render` cuando la geometría está desactualizada.
+     *
+     * @param uploadToGpu true para subir la geometría a la GPU; false la deja solo en el
+     *                    cliente (por ejemplo, con el backend de render por software).
      */
-    sf::Shape* getShape();
+    void bakeStaticGeometry(bool uploadToGpu = true);
+
+    /**
+     * @brief Obtiene la plantilla de geometría compartida.
+     *
+     * @return Puntero compartido a la plantilla (nulo si no se ha creado ninguna forma).
+     */
+    const EngineUtilities::TSharedPointer<ShapeTemplate>& getTemplate() const;
+
+    /**
+     * @brief Obtiene la transformación de la instancia (posición, rotación y escala).
+     *
+     * @return Matriz de transformación de la forma.
+     */
+    const sf::Transform& getTransform() const;
+
+    /**
+     * @brief Obtiene los límites de la forma en coordenadas del mundo.
+     *
+     * @return Rectángulo alineado a los ejes que contiene la forma transformada.
+     */
+    sf::FloatRect getGlobalBounds() const;
+
+    /**
+     * @brief Obtiene el color de relleno de la instancia.
+     *
+     * @return Color de la forma.
+     */
+    const sf::Color& getFillColor() const;
+
+    /**
+     * @brief Obtiene la textura de la instancia.
+     *
+     * @return Puntero a la textura (puede ser `nullptr`).
+     */
+    const sf::Texture* getTexture() const;
+
+    /**
+     * @brief Obtiene el tipo de forma gestionada.
+     *
+     * @return Tipo de forma.
+     */
+    ShapeType getShapeType() const;
 
 private:
-    sf::Shape* m_shape = nullptr;  ///< Puntero a la forma gestionada por esta fbrica.
+    EngineUtilities::TSharedPointer<ShapeTemplate> m_template;  ///< Geometría compartida de la forma.
+    sf::Transformable m_transformable;  ///< Posición, rotación y escala de esta instancia.
+    sf::Color m_fillColor = sf::Color::White;  ///< Color de relleno de esta instancia.
+    const sf::Texture* m_texture = nullptr;  ///< Textura de esta instancia.
+    sf::IntRect m_textureRect;  ///< Rectángulo de la textura en píxeles.
     ShapeType m_shapeType = ShapeType::EMPTY;  ///< Tipo de forma gestionada.
+
+    bool m_isStatic = false;      ///< La geometría se dibuja desde el buffer horneado.
+    bool m_staticDirty = true;    ///< La geometría horneada ya no coincide con la forma.
+    EngineUtilities::TUniquePtr<sf::VertexBuffer> m_staticBuffer;  ///< Geometría estática en GPU (se crea al hornear).
+    std::vector<sf::Vertex> m_staticVertices;  ///< Copia en el cliente (sin VBO o con render por software).
+    sf::RenderStates m_staticStates;  ///< Transformación y textura de la geometría horneada.
 };
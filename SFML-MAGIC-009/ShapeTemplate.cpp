@@ -0,0 +1,160 @@
+#include "ShapeTemplate.h"
+
+std::map<ShapeTemplate::Key, EngineUtilities::TSharedPointer<ShapeTemplate>> ShapeTemplate::s_cache;
+
+/**
+ * @brief Obtiene (o crea) la plantilla compartida para los parámetros dados.
+ *
+ * @param shapeType Tipo de forma.
+ * @param size Radio o dimensiones de la forma.
+ * @param pointCount Número de puntos del contorno (solo para círculos).
+ * @return Puntero compartido a la plantilla.
+ */
+EngineUtilities::TSharedPointer<ShapeTemplate>
+ShapeTemplate::acquire(ShapeType shapeType, const sf::Vector2f& size, std::size_t pointCount) {
+    Key key{ shapeType, size.x, size.y, pointCount };
+
+    // Normalizar la clave para que parámetros equivalentes compartan plantilla.
+    switch (shapeType) {
+    case ShapeType::CIRCLE:
+        key.height = size.x;
+        key.pointCount = std::max<std::size_t>(pointCount, 3);
+        break;
+    case ShapeType::RECTANGLE:
+        key.pointCount = 4;
+        break;
+    case ShapeType::TRIANGLE:
+        key.height = size.x;
+        key.pointCount = 3;
+        break;
+    default:
+        return EngineUtilities::TSharedPointer<ShapeTemplate>();
+    }
+
+    auto it = s_cache.find(key);
+    if (it != s_cache.end()) {
+        return it->second;
+    }
+
+    EngineUtilities::TSharedPointer<ShapeTemplate> shapeTemplate(new ShapeTemplate(key));
+    s_cache[key] = shapeTemplate;
+    return shapeTemplate;
+}
+
+/**
+ * @brief Número de plantillas distintas que hay en la caché.
+ *
+ * @return Cantidad de geometrías únicas.
+ */
+std::size_t ShapeTemplate::getCachedCount() {
+    return s_cache.size();
+}
+
+/**
+ * @brief Construye el abanico de triángulos de la forma.
+ *
+ * Los puntos siguen la misma convención que `sf::CircleShape` y `sf::RectangleShape`,
+ * así que el resultado es idéntico al que dibujaba la fábrica con formas de SFML.
+ *
+ * @param key Parámetros de la forma.
+ */
+ShapeTemplate::ShapeTemplate(const Key& key)
+    : m_type(key.type) {
+    std::vector<sf::Vector2f> points;
+    points.reserve(key.pointCount);
+
+    if (key.type == ShapeType::RECTANGLE) {
+        points.emplace_back(0.0f, 0.0f);
+        points.emplace_back(key.width, 0.0f);
+        points.emplace_back(key.width, key.height);
+        points.emplace_back(0.0f, key.height);
+    }
+    else {
+        const float pi = 3.141592654f;
+        const float radius = key.width;
+        for (std::size_t i = 0; i < key.pointCount; ++i) {
+            float angle = i * 2.0f * pi / key.pointCount - pi / 2.0f;
+            points.emplace_back(radius + std::cos(angle) * radius, radius + std::sin(angle) * radius);
+        }
+    }
+
+    // Límites locales.
+    sf::Vector2f minPoint = points[0];
+    sf::Vector2f maxPoint = points[0];
+    for (const sf::Vector2f& point : points) {
+        minPoint.x = std::min(minPoint.x, point.x);
+        minPoint.y = std::min(minPoint.y, point.y);
+        maxPoint.x = std::max(maxPoint.x, point.x);
+        maxPoint.y = std::max(maxPoint.y, point.y);
+    }
+    m_bounds = sf::FloatRect(minPoint, maxPoint - minPoint);
+
+    auto makeVertex = [this](const sf::Vector2f& position) {
+        float u = m_bounds.width > 0.0f ? (position.x - m_bounds.left) / m_bounds.width : 0.0f;
+        float v = m_bounds.height > 0.0f ? (position.y - m_bounds.top) / m_bounds.height : 0.0f;
+        return sf::Vertex(position, sf::Color::White, sf::Vector2f(u, v));
+        };
+
+    // Centro, puntos del contorno y el primer punto otra vez para cerrar el abanico.
+    m_vertices.reserve(points.size() + 2);
+    m_vertices.push_back(makeVertex(sf::Vector2f(m_bounds.left + m_bounds.width / 2.0f,
+                                                 m_bounds.top + m_bounds.height / 2.0f)));
+    for (const sf::Vector2f& point : points) {
+        m_vertices.push_back(makeVertex(point));
+    }
+    m_vertices.push_back(m_vertices[1]);
+}
+
+/**
+ * @brief Escribe los vértices de una instancia con su color y rectángulo de textura.
+ *
+ * @param color Color de relleno de la instancia.
+ * @param textureRect Rectángulo de la textura en píxeles.
+ * @param out Vector de salida.
+ */
+void ShapeTemplate::buildVertices(const sf::Color& color, const sf::IntRect& textureRect, std::vector<sf::Vertex>& out) const {
+    out.resize(m_vertices.size());
+    for (std::size_t i = 0; i < m_vertices.size(); ++i) {
+        const sf::Vertex& source = m_vertices[i];
+        out[i].position = source.position;
+        out[i].color = color;
+        out[i].texCoords.x = textureRect.left + textureRect.width * source.texCoords.x;
+        out[i].texCoords.y = textureRect.top + textureRect.height * source.texCoords.y;
+    }
+}
+
+/**
+ * @brief Vértices del abanico de triángulos.
+ *
+ * @return Puntero al primer vértice.
+ */
+const sf::Vertex* ShapeTemplate::getVertices() const {
+    return m_vertices.data();
+}
+
+/**
+ * @brief Número de vértices del abanico.
+ *
+ * @return Cantidad de vértices.
+ */
+std::size_t ShapeTemplate::getVertexCount() const {
+    return m_vertices.size();
+}
+
+/**
+ * @brief Límites locales de la forma.
+ *
+ * @return Rectángulo que contiene todos los puntos.
+ */
+const sf::FloatRect& ShapeTemplate::getLocalBounds() const {
+    return m_bounds;
+}
+
+/**
+ * @brief Tipo de forma de la plantilla.
+ *
+ * @return El tipo con el que se creó.
+ */
+ShapeType ShapeTemplate::getType() const {
+    return m_type;
+}
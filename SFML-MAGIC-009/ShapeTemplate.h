@@ -0,0 +1,114 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <map>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+/**
+ * @class ShapeTemplate
+ * @brief Geometría inmutable y compartida de una forma.
+ *
+ * Un `ShapeTemplate` guarda el abanico de triángulos (en espacio local) de una forma
+ * identificada por su tipo, tamaño y número de puntos. Todas las instancias que
+ * comparten esos parámetros apuntan a la misma plantilla, de modo que la memoria crece
+ * con el número de formas distintas y no con el número de actores.
+ *
+ * Los vértices se guardan en blanco y con coordenadas de textura normalizadas (0..1)
+ * respecto a los límites locales; el color, la textura y la transformación de cada
+ * instancia se aplican al dibujar.
+ *
+ * La caché no está sincronizada: los actores se crean en el hilo principal. El contador
+ * de referencias de `TSharedPointer` no es atómico, así que copiar o soltar plantillas
+ * desde otros hilos sería una carrera aunque la búsqueda estuviera protegida.
+ */
+class ShapeTemplate {
+public:
+    /**
+     * @brief Obtiene (o crea) la plantilla compartida para los parámetros dados.
+     *
+     * Para `CIRCLE` y `TRIANGLE` el tamaño se interpreta como radio (`size.x`); para
+     * `RECTANGLE` como ancho y alto. El triángulo siempre usa 3 puntos y el rectángulo 4.
+     *
+     * @param shapeType Tipo de forma.
+     * @param size Radio o dimensiones de la forma.
+     * @param pointCount Número de puntos del contorno (solo para círculos).
+     * @return Puntero compartido a la plantilla, o un puntero nulo si el tipo es `EMPTY`.
+     */
+    static EngineUtilities::TSharedPointer<ShapeTemplate>
+    acquire(ShapeType shapeType, const sf::Vector2f& size, std::size_t pointCount);
+
+    /**
+     * @brief Número de plantillas distintas que hay en la caché.
+     *
+     * @return Cantidad de geometrías únicas creadas hasta ahora.
+     */
+    static std::size_t getCachedCount();
+
+    /**
+     * @brief Escribe los vértices de una instancia con su color y rectángulo de textura.
+     *
+     * @param color Color de relleno de la instancia.
+     * @param textureRect Rectángulo de la textura en píxeles (vacío si no hay textura).
+     * @param out Vector de salida; se redimensiona al número de vértices de la plantilla.
+     */
+    void buildVertices(const sf::Color& color, const sf::IntRect& textureRect, std::vector<sf::Vertex>& out) const;
+
+    /**
+     * @brief Vértices del abanico de triángulos, en blanco y con coordenadas de textura normalizadas.
+     *
+     * @return Puntero al primer vértice.
+     */
+    const sf::Vertex* getVertices() const;
+
+    /**
+     * @brief Número de vértices del abanico (centro + puntos + cierre).
+     *
+     * @return Cantidad de vértices.
+     */
+    std::size_t getVertexCount() const;
+
+    /**
+     * @brief Límites locales de la forma (sin transformar).
+     *
+     * @return Rectángulo que contiene todos los puntos.
+     */
+    const sf::FloatRect& getLocalBounds() const;
+
+    /**
+     * @brief Tipo de forma de la plantilla.
+     *
+     * @return El tipo con el que se creó.
+     */
+    ShapeType getType() const;
+
+private:
+    /**
+     * @brief Clave de la caché de plantillas.
+     */
+    struct Key {
+        ShapeType type;           ///< Tipo de forma.
+        float width;              ///< Radio o ancho.
+        float height;             ///< Radio o alto.
+        std::size_t pointCount;   ///< Número de puntos del contorno.
+
+        bool operator<(const Key& other) const {
+            if (type != other.type) return type < other.type;
+            if (width != other.width) return width < other.width;
+            if (height != other.height) return height < other.height;
+            return pointCount < other.pointCount;
+        }
+    };
+
+    /**
+     * @brief Construye la geometría a partir de los puntos del contorno.
+     *
+     * @param key Parámetros de la forma.
+     */
+    explicit ShapeTemplate(const Key& key);
+
+    ShapeType m_type;                    ///< Tipo de forma.
+    std::vector<sf::Vertex> m_vertices;  ///< Abanico de triángulos en espacio local.
+    sf::FloatRect m_bounds;              ///< Límites locales de la forma.
+
+    static std::map<Key, EngineUtilities::TSharedPointer<ShapeTemplate>> s_cache;  ///< Plantillas compartidas (solo hilo principal).
+};
@@ -0,0 +1,472 @@
+#include "SoftwareRasterizer.h"
+#include "Profiler.h"
+#include <SFML/System/Clock.hpp>
+
+/**
+ * @brief Constructor.
+ *
+ * @param width Ancho del búfer en píxeles.
+ * @param height Alto del búfer en píxeles.
+ * @param threadCount Hilos para rasterizar (0 = uno por núcleo).
+ * @param tileSize Lado de cada tile en píxeles.
+ */
+SoftwareRasterizer::SoftwareRasterizer(unsigned int width, unsigned int height,
+                                       unsigned int threadCount, unsigned int tileSize)
+    : m_width(0), m_height(0), m_tileSize(std::max(8u, tileSize)), m_pool(threadCount) {
+    resize(width, height);
+}
+
+/**
+ * @brief Cambia el tamaño del búfer y reinicia la vista para cubrirlo completo.
+ *
+ * @param width Nuevo ancho en píxeles.
+ * @param height Nuevo alto en píxeles.
+ */
+void SoftwareRasterizer::resize(unsigned int width, unsigned int height) {
+    m_width = width;
+    m_height = height;
+    m_tilesX = (width + m_tileSize - 1) / m_tileSize;
+    m_tilesY = (height + m_tileSize - 1) / m_tileSize;
+    m_pixels.assign(static_cast<std::size_t>(width) * height * 4, 0);
+    m_tileBins.assign(static_cast<std::size_t>(m_tilesX) * m_tilesY, std::vector<sf::Uint32>());
+    m_triangles.clear();
+
+    setView(sf::View(sf::FloatRect(0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height))));
+}
+
+/**
+ * @brief Vista con la que se proyectan las siguientes llamadas a `draw`.
+ *
+ * Combina la proyección de la vista (a coordenadas normalizadas) con el viewport, igual
+ * que `sf::RenderTarget::mapCoordsToPixel`.
+ *
+ * @param view Vista de SFML.
+ */
+void SoftwareRasterizer::setView(const sf::View& view) {
+    const sf::FloatRect& viewport = view.getViewport();
+    float left = viewport.left * m_width;
+    float top = viewport.top * m_height;
+    float width = viewport.width * m_width;
+    float height = viewport.height * m_height;
+
+    sf::Transform toPixels(width * 0.5f, 0.0f, left + width * 0.5f,
+                           0.0f, -height * 0.5f, top + height * 0.5f,
+                           0.0f, 0.0f, 1.0f);
+    m_viewTransform = toPixels * view.getTransform();
+}
+
+/**
+ * @brief Llena el búfer con un color y descarta los triángulos pendientes.
+ *
+ * @param color Color de fondo.
+ */
+void SoftwareRasterizer::clear(const sf::Color& color) {
+    m_triangles.clear();
+
+    const std::size_t pixelCount = static_cast<std::size_t>(m_width) * m_height;
+    sf::Uint8* out = m_pixels.data();
+    for (std::size_t i = 0; i < pixelCount; ++i) {
+        out[i * 4 + 0] = color.r;
+        out[i * 4 + 1] = color.g;
+        out[i * 4 + 2] = color.b;
+        out[i * 4 + 3] = color.a;
+    }
+}
+
+/**
+ * @brief Convierte la primitiva en triángulos proyectados y los agrega al frame.
+ *
+ * @param vertices Puntero al primer vértice.
+ * @param vertexCount Número de vértices.
+ * @param type Tipo de primitiva.
+ * @param states Transformación, textura y mezcla.
+ */
+void SoftwareRasterizer::draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                              const sf::RenderStates& states) {
+    if (vertices == nullptr || vertexCount < 3) {
+        return;
+    }
+
+    const sf::Transform transform = m_viewTransform * states.transform;
+
+    // Una textura sin registrar se dibuja como si fuera blanca (solo color de vértice).
+    const TextureData* texture = nullptr;
+    if (states.texture != nullptr) {
+        auto it = m_textures.find(states.texture);
+        if (it != m_textures.end()) {
+            texture = &it->second;
+        }
+    }
+
+    BlendType blend = BlendType::Alpha;
+    if (states.blendMode == sf::BlendAdd) {
+        blend = BlendType::Add;
+    }
+    else if (states.blendMode == sf::BlendNone) {
+        blend = BlendType::None;
+    }
+
+    switch (type) {
+    case sf::Triangles:
+        for (std::size_t i = 0; i + 2 < vertexCount; i += 3) {
+            addTriangle(vertices[i], vertices[i + 1], vertices[i + 2], transform, texture, blend);
+        }
+        break;
+
+    case sf::TriangleStrip:
+        for (std::size_t i = 0; i + 2 < vertexCount; ++i) {
+            addTriangle(vertices[i], vertices[i + 1], vertices[i + 2], transform, texture, blend);
+        }
+        break;
+
+    case sf::TriangleFan:
+        for (std::size_t i = 1; i + 1 < vertexCount; ++i) {
+            addTriangle(vertices[0], vertices[i], vertices[i + 1], transform, texture, blend);
+        }
+        break;
+
+    case sf::Quads:
+        for (std::size_t i = 0; i + 3 < vertexCount; i += 4) {
+            addTriangle(vertices[i], vertices[i + 1], vertices[i + 2], transform, texture, blend);
+            addTriangle(vertices[i], vertices[i + 2], vertices[i + 3], transform, texture, blend);
+        }
+        break;
+
+    default:
+        // Puntos y líneas no tienen área: no se rasterizan.
+        break;
+    }
+}
+
+/**
+ * @brief Rasteriza todos los triángulos pendientes en el búfer.
+ *
+ * Primero reparte cada triángulo en los tiles que toca su caja envolvente (en orden de
+ * envío) y luego rasteriza los tiles en paralelo; ningún píxel lo escriben dos hilos.
+ */
+void SoftwareRasterizer::flush() {
+    PROFILE_SCOPE("SoftwareRasterizer::flush");
+    sf::Clock timer;
+
+    for (std::vector<sf::Uint32>& bin : m_tileBins) {
+        bin.clear();
+    }
+
+    for (std::size_t index = 0; index < m_triangles.size(); ++index) {
+        const Triangle& triangle = m_triangles[index];
+        float minX = std::min({ triangle.position[0].x, triangle.position[1].x, triangle.position[2].x });
+        float maxX = std::max({ triangle.position[0].x, triangle.position[1].x, triangle.position[2].x });
+        float minY = std::min({ triangle.position[0].y, triangle.position[1].y, triangle.position[2].y });
+        float maxY = std::max({ triangle.position[0].y, triangle.position[1].y, triangle.position[2].y });
+
+        if (maxX < 0.0f || maxY < 0.0f || minX >= m_width || minY >= m_height) {
+            continue;
+        }
+
+        int tileMinX = std::max(0, static_cast<int>(minX) / static_cast<int>(m_tileSize));
+        int tileMinY = std::max(0, static_cast<int>(minY) / static_cast<int>(m_tileSize));
+        int tileMaxX = std::min(static_cast<int>(m_tilesX) - 1, static_cast<int>(maxX) / static_cast<int>(m_tileSize));
+        int tileMaxY = std::min(static_cast<int>(m_tilesY) - 1, static_cast<int>(maxY) / static_cast<int>(m_tileSize));
+
+        for (int ty = tileMinY; ty <= tileMaxY; ++ty) {
+            for (int tx = tileMinX; tx <= tileMaxX; ++tx) {
+                m_tileBins[ty * m_tilesX + tx].push_back(static_cast<sf::Uint32>(index));
+            }
+        }
+    }
+
+    m_pool.parallelFor(m_tileBins.size(), [this](std::size_t begin, std::size_t end) {
+        PROFILE_SCOPE("SoftwareRasterizer::tiles");
+        for (std::size_t tile = begin; tile < end; ++tile) {
+            int minX = static_cast<int>((tile % m_tilesX) * m_tileSize);
+            int minY = static_cast<int>((tile / m_tilesX) * m_tileSize);
+            int maxX = std::min(minX + static_cast<int>(m_tileSize), static_cast<int>(m_width));
+            int maxY = std::min(minY + static_cast<int>(m_tileSize), static_cast<int>(m_height));
+
+            for (sf::Uint32 index : m_tileBins[tile]) {
+                rasterize(m_triangles[index], minX, minY, maxX, maxY);
+            }
+        }
+    });
+
+    m_lastTriangleCount = m_triangles.size();
+    m_triangles.clear();
+    m_lastFlushTime = timer.getElapsedTime();
+}
+
+/**
+ * @brief Registra los píxeles de una textura para poder muestrearla.
+ *
+ * @param texture Textura que aparecerá en los estados de render.
+ * @param image Imagen con la que se creó la textura.
+ */
+void SoftwareRasterizer::registerTexture(const sf::Texture* texture, const sf::Image& image) {
+    if (texture == nullptr) {
+        return;
+    }
+
+    TextureData& data = m_textures[texture];
+    data.width = image.getSize().x;
+    data.height = image.getSize().y;
+    const sf::Uint8* source = image.getPixelsPtr();
+    data.pixels.assign(source, source + static_cast<std::size_t>(data.width) * data.height * 4);
+}
+
+/**
+ * @brief Olvida una textura registrada.
+ *
+ * @param texture Textura a olvidar.
+ */
+void SoftwareRasterizer::unregisterTexture(const sf::Texture* texture) {
+    m_textures.erase(texture);
+}
+
+/**
+ * @brief Ancho del búfer.
+ *
+ * @return Ancho en píxeles.
+ */
+unsigned int SoftwareRasterizer::getWidth() const {
+    return m_width;
+}
+
+/**
+ * @brief Alto del búfer.
+ *
+ * @return Alto en píxeles.
+ */
+unsigned int SoftwareRasterizer::getHeight() const {
+    return m_height;
+}
+
+/**
+ * @brief Píxeles del búfer en formato RGBA.
+ *
+ * @return Puntero al primer byte.
+ */
+const sf::Uint8* SoftwareRasterizer::getPixels() const {
+    return m_pixels.data();
+}
+
+/**
+ * @brief Copia el búfer a una imagen de SFML.
+ *
+ * @return Imagen con el contenido actual.
+ */
+sf::Image SoftwareRasterizer::copyToImage() const {
+    sf::Image image;
+    image.create(m_width, m_height, m_pixels.data());
+    return image;
+}
+
+/**
+ * @brief Guarda el búfer en un archivo de imagen.
+ *
+ * @param path Ruta del archivo.
+ * @return true si se guardó correctamente.
+ */
+bool SoftwareRasterizer::saveToFile(const std::string& path) const {
+    return copyToImage().saveToFile(path);
+}
+
+/**
+ * @brief Compara el búfer con una imagen de referencia.
+ *
+ * @param golden Imagen de referencia.
+ * @param tolerance Diferencia máxima permitida por canal.
+ * @return Número de píxeles distintos.
+ */
+std::size_t SoftwareRasterizer::compare(const sf::Image& golden, sf::Uint8 tolerance) const {
+    const std::size_t pixelCount = static_cast<std::size_t>(m_width) * m_height;
+    if (golden.getSize().x != m_width || golden.getSize().y != m_height) {
+        return pixelCount;
+    }
+
+    const sf::Uint8* expected = golden.getPixelsPtr();
+    std::size_t differences = 0;
+    for (std::size_t i = 0; i < pixelCount; ++i) {
+        for (std::size_t channel = 0; channel < 4; ++channel) {
+            int delta = static_cast<int>(m_pixels[i * 4 + channel]) - static_cast<int>(expected[i * 4 + channel]);
+            if (std::abs(delta) > tolerance) {
+                ++differences;
+                break;
+            }
+        }
+    }
+    return differences;
+}
+
+/**
+ * @brief Triángulos rasterizados en el último `flush`.
+ *
+ * @return Número de triángulos.
+ */
+std::size_t SoftwareRasterizer::getTriangleCount() const {
+    return m_lastTriangleCount;
+}
+
+/**
+ * @brief Tiempo que tomó el último `flush`.
+ *
+ * @return Duración de la rasterización.
+ */
+sf::Time SoftwareRasterizer::getLastFlushTime() const {
+    return m_lastFlushTime;
+}
+
+/**
+ * @brief Proyecta un triángulo y lo agrega al frame.
+ *
+ * @param a Primer vértice.
+ * @param b Segundo vértice.
+ * @param c Tercer vértice.
+ * @param transform Transformación de mundo a píxeles.
+ * @param texture Textura registrada (o nullptr).
+ * @param blend Modo de mezcla.
+ */
+void SoftwareRasterizer::addTriangle(const sf::Vertex& a, const sf::Vertex& b, const sf::Vertex& c,
+                                     const sf::Transform& transform, const TextureData* texture, BlendType blend) {
+    Triangle triangle;
+    const sf::Vertex* source[3] = { &a, &b, &c };
+    for (int i = 0; i < 3; ++i) {
+        triangle.position[i] = transform.transformPoint(source[i]->position);
+        triangle.color[i] = source[i]->color;
+        triangle.texCoords[i] = source[i]->texCoords;
+    }
+    triangle.texture = texture;
+    triangle.blend = blend;
+    m_triangles.push_back(triangle);
+}
+
+/**
+ * @brief Rasteriza un triángulo dentro de los límites de un tile.
+ *
+ * Usa funciones de arista evaluadas en el centro de cada píxel con regla de relleno
+ * superior-izquierda (los triángulos que comparten arista no se pisan), interpola color y
+ * coordenadas de textura con baricéntricas y muestrea la textura por vecino más cercano,
+ * igual que una `sf::Texture` sin suavizado.
+ *
+ * @param triangle Triángulo a dibujar.
+ * @param minX Primer píxel X del tile.
+ * @param minY Primer píxel Y del tile.
+ * @param maxX Último píxel X del tile (exclusivo).
+ * @param maxY Último píxel Y del tile (exclusivo).
+ */
+void SoftwareRasterizer::rasterize(const Triangle& triangle, int minX, int minY, int maxX, int maxY) {
+    sf::Vector2f v0 = triangle.position[0];
+    sf::Vector2f v1 = triangle.position[1];
+    sf::Vector2f v2 = triangle.position[2];
+    int i1 = 1;
+    int i2 = 2;
+
+    auto edge = [](const sf::Vector2f& a, const sf::Vector2f& b, float px, float py) {
+        return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+    };
+
+    float area = edge(v0, v1, v2.x, v2.y);
+    if (area == 0.0f) {
+        return;
+    }
+    // SFML no descarta caras traseras: se normaliza el orden para que el área sea positiva.
+    if (area < 0.0f) {
+        std::swap(v1, v2);
+        std::swap(i1, i2);
+        area = -area;
+    }
+
+    auto isTopLeft = [](const sf::Vector2f& a, const sf::Vector2f& b) {
+        float dx = b.x - a.x;
+        float dy = b.y - a.y;
+        return (dy == 0.0f && dx > 0.0f) || dy < 0.0f;
+    };
+    const bool topLeft0 = isTopLeft(v1, v2);
+    const bool topLeft1 = isTopLeft(v2, v0);
+    const bool topLeft2 = isTopLeft(v0, v1);
+
+    // Caja envolvente recortada al tile.
+    int startX = std::max(minX, static_cast<int>(std::floor(std::min({ v0.x, v1.x, v2.x }))));
+    int endX = std::min(maxX, static_cast<int>(std::ceil(std::max({ v0.x, v1.x, v2.x }))));
+    int startY = std::max(minY, static_cast<int>(std::floor(std::min({ v0.y, v1.y, v2.y }))));
+    int endY = std::min(maxY, static_cast<int>(std::ceil(std::max({ v0.y, v1.y, v2.y }))));
+    if (startX >= endX || startY >= endY) {
+        return;
+    }
+
+    const float invArea = 1.0f / area;
+    const sf::Color& c0 = triangle.color[0];
+    const sf::Color& c1 = triangle.color[i1];
+    const sf::Color& c2 = triangle.color[i2];
+    const sf::Vector2f& t0 = triangle.texCoords[0];
+    const sf::Vector2f& t1 = triangle.texCoords[i1];
+    const sf::Vector2f& t2 = triangle.texCoords[i2];
+    const TextureData* texture = triangle.texture;
+
+    for (int y = startY; y < endY; ++y) {
+        const float py = static_cast<float>(y) + 0.5f;
+        sf::Uint8* row = &m_pixels[(static_cast<std::size_t>(y) * m_width) * 4];
+
+        for (int x = startX; x < endX; ++x) {
+            const float px = static_cast<float>(x) + 0.5f;
+            float w0 = edge(v1, v2, px, py);
+            float w1 = edge(v2, v0, px, py);
+            float w2 = edge(v0, v1, px, py);
+
+            bool inside = (w0 > 0.0f || (w0 == 0.0f && topLeft0)) &&
+                          (w1 > 0.0f || (w1 == 0.0f && topLeft1)) &&
+                          (w2 > 0.0f || (w2 == 0.0f && topLeft2));
+            if (!inside) {
+                continue;
+            }
+
+            w0 *= invArea;
+            w1 *= invArea;
+            w2 *= invArea;
+
+            float r = c0.r * w0 + c1.r * w1 + c2.r * w2;
+            float g = c0.g * w0 + c1.g * w1 + c2.g * w2;
+            float b = c0.b * w0 + c1.b * w1 + c2.b * w2;
+            float a = c0.a * w0 + c1.a * w1 + c2.a * w2;
+
+            if (texture != nullptr && texture->width > 0 && texture->height > 0) {
+                float u = t0.x * w0 + t1.x * w1 + t2.x * w2;
+                float v = t0.y * w0 + t1.y * w1 + t2.y * w2;
+                int tx = std::min(std::max(static_cast<int>(std::floor(u)), 0), static_cast<int>(texture->width) - 1);
+                int ty = std::min(std::max(static_cast<int>(std::floor(v)), 0), static_cast<int>(texture->height) - 1);
+                const sf::Uint8* texel = &texture->pixels[(static_cast<std::size_t>(ty) * texture->width + tx) * 4];
+                r = r * texel[0] / 255.0f;
+                g = g * texel[1] / 255.0f;
+                b = b * texel[2] / 255.0f;
+                a = a * texel[3] / 255.0f;
+            }
+
+            sf::Uint8* dst = row + static_cast<std::size_t>(x) * 4;
+            switch (triangle.blend) {
+            case BlendType::None:
+                dst[0] = static_cast<sf::Uint8>(r + 0.5f);
+                dst[1] = static_cast<sf::Uint8>(g + 0.5f);
+                dst[2] = static_cast<sf::Uint8>(b + 0.5f);
+                dst[3] = static_cast<sf::Uint8>(a + 0.5f);
+                break;
+
+            case BlendType::Add: {
+                float alpha = a / 255.0f;
+                dst[0] = static_cast<sf::Uint8>(std::min(255.0f, dst[0] + r * alpha + 0.5f));
+                dst[1] = static_cast<sf::Uint8>(std::min(255.0f, dst[1] + g * alpha + 0.5f));
+                dst[2] = static_cast<sf::Uint8>(std::min(255.0f, dst[2] + b * alpha + 0.5f));
+                dst[3] = static_cast<sf::Uint8>(std::min(255.0f, dst[3] + a + 0.5f));
+                break;
+            }
+
+            case BlendType::Alpha: {
+                float alpha = a / 255.0f;
+                float inverse = 1.0f - alpha;
+                dst[0] = static_cast<sf::Uint8>(r * alpha + dst[0] * inverse + 0.5f);
+                dst[1] = static_cast<sf::Uint8>(g * alpha + dst[1] * inverse + 0.5f);
+                dst[2] = static_cast<sf::Uint8>(b * alpha + dst[2] * inverse + 0.5f);
+                dst[3] = static_cast<sf::Uint8>(a + dst[3] * inverse + 0.5f);
+                break;
+            }
+            }
+        }
+    }
+}
@@ -0,0 +1,225 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "ThreadPool.h"     // Hilos para rasterizar los tiles en paralelo.
+#include <map>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+
+/**
+ * @class SoftwareRasterizer
+ * @brief Backend de render por CPU que dibuja en un búfer RGBA en memoria.
+ *
+ * Acepta las mismas llamadas que `Window::draw` (vértices, tipo de primitiva y estados de
+ * render) y las rasteriza sin GPU, para pruebas con imágenes de referencia y para medir
+ * el costo de preparar el render en máquinas sin pantalla.
+ *
+ * Los triángulos se acumulan durante el frame y `flush` los reparte en tiles: cada tile
+ * se rasteriza en un hilo distinto procesando sus triángulos en el orden de envío, de
+ * modo que la mezcla es idéntica a la de un solo hilo.
+ *
+ * Como una `sf::Texture` no puede leerse sin contexto de OpenGL, cada textura debe
+ * registrarse con su `sf::Image` de origen. Se soportan triángulos, tiras, abanicos y
+ * quads; los puntos y las líneas se ignoran.
+ */
+class SoftwareRasterizer {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param width Ancho del búfer en píxeles.
+     * @param height Alto del búfer en píxeles.
+     * @param threadCount Hilos para rasterizar (0 = uno por núcleo).
+     * @param tileSize Lado de cada tile en píxeles.
+     */
+    SoftwareRasterizer(unsigned int width, unsigned int height, unsigned int threadCount = 0,
+                       unsigned int tileSize = 64);
+
+    /**
+     * @brief Cambia el tamaño del búfer (descarta su contenido).
+     *
+     * @param width Nuevo ancho en píxeles.
+     * @param height Nuevo alto en píxeles.
+     */
+    void resize(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Vista con la que se proyectan las siguientes llamadas a `draw`.
+     *
+     * @param view Vista de SFML (centro, tamaño, rotación y viewport).
+     */
+    void setView(const sf::View& view);
+
+    /**
+     * @brief Llena el búfer con un color y descarta los triángulos pendientes.
+     *
+     * @param color Color de fondo.
+     */
+    void clear(const sf::Color& color = sf::Color::Black);
+
+    /**
+     * @brief Agrega una llamada de dibujo al frame.
+     *
+     * @param vertices Puntero al primer vértice.
+     * @param vertexCount Número de vértices.
+     * @param type Tipo de primitiva.
+     * @param states Transformación, textura y mezcla.
+     */
+    void draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+              const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /**
+     * @brief Rasteriza todos los triángulos pendientes en el búfer.
+     */
+    void flush();
+
+    /**
+     * @brief Registra los píxeles de una textura para poder muestrearla.
+     *
+     * @param texture Textura que aparecerá en `sf::RenderStates::texture`.
+     * @param image Imagen con la que se creó la textura.
+     */
+    void registerTexture(const sf::Texture* texture, const sf::Image& image);
+
+    /**
+     * @brief Olvida una textura registrada.
+     *
+     * @param texture Textura a olvidar.
+     */
+    void unregisterTexture(const sf::Texture* texture);
+
+    /**
+     * @brief Ancho del búfer.
+     *
+     * @return Ancho en píxeles.
+     */
+    unsigned int getWidth() const;
+
+    /**
+     * @brief Alto del búfer.
+     *
+     * @return Alto en píxeles.
+     */
+    unsigned int getHeight() const;
+
+    /**
+     * @brief Píxeles del búfer en formato RGBA de 8 bits, fila por fila.
+     *
+     * @return Puntero al primer byte (ancho * alto * 4 bytes).
+     */
+    const sf::Uint8* getPixels() const;
+
+    /**
+     * @brief Copia el búfer a una imagen de SFML.
+     *
+     * @return Imagen con el contenido actual.
+     */
+    sf::Image copyToImage() const;
+
+    /**
+     * @brief Guarda el búfer en un archivo de imagen.
+     *
+     * @param path Ruta del archivo (el formato se deduce de la extensión).
+     * @return true si se guardó correctamente.
+     */
+    bool saveToFile(const std::string& path) const;
+
+    /**
+     * @brief Compara el búfer con una imagen de referencia.
+     *
+     * @param golden Imagen de referencia.
+     * @param tolerance Diferencia máxima permitida por canal.
+     * @return Número de píxeles distintos (todos si los tamaños no coinciden).
+     */
+    std::size_t compare(const sf::Image& golden, sf::Uint8 tolerance = 0) const;
+
+    /**
+     * @brief Triángulos rasterizados en el último `flush`.
+     *
+     * @return Número de triángulos.
+     */
+    std::size_t getTriangleCount() const;
+
+    /**
+     * @brief Tiempo que tomó el último `flush`.
+     *
+     * @return Duración de la rasterización.
+     */
+    sf::Time getLastFlushTime() const;
+
+private:
+    /**
+     * @struct TextureData
+     * @brief Copia en CPU de los píxeles de una textura.
+     */
+    struct TextureData {
+        unsigned int width = 0;          ///< Ancho en píxeles.
+        unsigned int height = 0;         ///< Alto en píxeles.
+        std::vector<sf::Uint8> pixels;   ///< Píxeles RGBA.
+    };
+
+    /**
+     * @enum BlendType
+     * @brief Modos de mezcla soportados.
+     */
+    enum class BlendType {
+        Alpha,  ///< Mezcla alfa estándar (`sf::BlendAlpha`).
+        Add,    ///< Suma (`sf::BlendAdd`).
+        None    ///< Sobrescribe (`sf::BlendNone`).
+    };
+
+    /**
+     * @struct Triangle
+     * @brief Triángulo ya proyectado a píxeles, listo para rasterizar.
+     */
+    struct Triangle {
+        sf::Vector2f position[3];        ///< Vértices en coordenadas de píxel.
+        sf::Color color[3];              ///< Color de cada vértice.
+        sf::Vector2f texCoords[3];       ///< Coordenadas de textura en píxeles.
+        const TextureData* texture;      ///< Textura a muestrear (nullptr = solo color).
+        BlendType blend;                 ///< Modo de mezcla.
+    };
+
+    /**
+     * @brief Proyecta un triángulo y lo agrega al frame.
+     *
+     * @param a Primer vértice.
+     * @param b Segundo vértice.
+     * @param c Tercer vértice.
+     * @param transform Transformación de mundo a píxeles.
+     * @param texture Textura registrada (o nullptr).
+     * @param blend Modo de mezcla.
+     */
+    void addTriangle(const sf::Vertex& a, const sf::Vertex& b, const sf::Vertex& c,
+                     const sf::Transform& transform, const TextureData* texture, BlendType blend);
+
+    /**
+     * @brief Rasteriza un triángulo dentro de los límites de un tile.
+     *
+     * @param triangle Triángulo a dibujar.
+     * @param minX Primer píxel X del tile.
+     * @param minY Primer píxel Y del tile.
+     * @param maxX Último píxel X del tile (exclusivo).
+     * @param maxY Último píxel Y del tile (exclusivo).
+     */
+    void rasterize(const Triangle& triangle, int minX, int minY, int maxX, int maxY);
+
+    unsigned int m_width;              ///< Ancho del búfer.
+    unsigned int m_height;             ///< Alto del búfer.
+    unsigned int m_tileSize;           ///< Lado de cada tile.
+    unsigned int m_tilesX = 0;         ///< Tiles por fila.
+    unsigned int m_tilesY = 0;         ///< Tiles por columna.
+
+    std::vector<sf::Uint8> m_pixels;   ///< Búfer RGBA.
+    std::vector<Triangle> m_triangles; ///< Triángulos pendientes del frame.
+    std::vector<std::vector<sf::Uint32>> m_tileBins;  ///< Índices de triángulos por tile, en orden.
+    std::map<const sf::Texture*, TextureData> m_textures;  ///< Texturas registradas.
+
+    sf::Transform m_viewTransform;     ///< Proyección de mundo a píxeles de la vista actual.
+    std::size_t m_lastTriangleCount = 0;  ///< Triángulos del último `flush`.
+    sf::Time m_lastFlushTime;          ///< Duración del último `flush`.
+    ThreadPool m_pool;                 ///< Hilos que rasterizan los tiles.
+};
@@ -0,0 +1,184 @@
+#include "SpatialHashGrid.h"
+
+/**
+ * @brief Constructor.
+ *
+ * @param cellSize Lado de cada celda.
+ */
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+    : m_cellSize(std::max(cellSize, 1e-3f)), m_invCellSize(1.0f / std::max(cellSize, 1e-3f)) {
+}
+
+/**
+ * @brief Reconstruye la rejilla con las posiciones del tick (ordenamiento por conteo).
+ *
+ * @param x Coordenadas X (una por entidad).
+ * @param y Coordenadas Y (una por entidad).
+ * @param count Número de entidades.
+ */
+void SpatialHashGrid::build(const float* x, const float* y, std::size_t count) {
+    // Una cubeta por entidad (potencia de dos): las cubetas casi no se comparten y el
+    // conteo sigue siendo O(n).
+    sf::Uint32 buckets = 256;
+    while (buckets < count) {
+        buckets <<= 1;
+    }
+    m_bucketMask = buckets - 1;
+    m_bucketStart.assign(buckets + 1, 0);
+    m_entityBucket.resize(count);
+
+    // 1. Conteo por cubeta.
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Uint32 bucket = bucketOf(cellCoordinate(x[i]), cellCoordinate(y[i]));
+        m_entityBucket[i] = bucket;
+        ++m_bucketStart[bucket + 1];
+    }
+
+    // 2. Suma prefija: inicio de cada cubeta en el arreglo ordenado.
+    for (sf::Uint32 bucket = 0; bucket < buckets; ++bucket) {
+        m_bucketStart[bucket + 1] += m_bucketStart[bucket];
+    }
+
+    // 3. Distribución estable: handles y posiciones quedan contiguos por cubeta.
+    m_handles.resize(count);
+    m_keys.resize(count);
+    m_x.resize(count);
+    m_y.resize(count);
+    m_cursor.assign(m_bucketStart.begin(), m_bucketStart.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Uint32 slot = m_cursor[m_entityBucket[i]]++;
+        m_handles[slot] = static_cast<sf::Uint32>(i);
+        m_keys[slot] = cellKey(cellCoordinate(x[i]), cellCoordinate(y[i]));
+        m_x[slot] = x[i];
+        m_y[slot] = y[i];
+    }
+}
+
+/**
+ * @brief Reconstruye la rejilla con las posiciones del tick.
+ *
+ * @param positions Posición de cada entidad.
+ */
+void SpatialHashGrid::build(const std::vector<sf::Vector2f>& positions) {
+    std::vector<float> x(positions.size());
+    std::vector<float> y(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        x[i] = positions[i].x;
+        y[i] = positions[i].y;
+    }
+    build(x.data(), y.data(), positions.size());
+}
+
+/**
+ * @brief Entidades a distancia menor o igual que `radius` de un punto.
+ *
+ * @param center Centro de la consulta.
+ * @param radius Radio de la consulta.
+ * @param result Recibe los handles encontrados (se vacía antes).
+ */
+void SpatialHashGrid::queryRadius(const sf::Vector2f& center, float radius, std::vector<sf::Uint32>& result) const {
+    const float radiusSquared = radius * radius;
+    gather(center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+           [&center, radiusSquared](float x, float y) {
+               float dx = x - center.x;
+               float dy = y - center.y;
+               return dx * dx + dy * dy <= radiusSquared;
+           },
+           result);
+}
+
+/**
+ * @brief Entidades dentro de un rectángulo (bordes incluidos).
+ *
+ * @param area Rectángulo de la consulta.
+ * @param result Recibe los handles encontrados (se vacía antes).
+ */
+void SpatialHashGrid::queryAABB(const sf::FloatRect& area, std::vector<sf::Uint32>& result) const {
+    const float minX = area.left;
+    const float minY = area.top;
+    const float maxX = area.left + area.width;
+    const float maxY = area.top + area.height;
+    gather(minX, minY, maxX, maxY,
+           [minX, minY, maxX, maxY](float x, float y) {
+               return x >= minX && x <= maxX && y >= minY && y <= maxY;
+           },
+           result);
+}
+
+/**
+ * @brief Recorre las entidades de las celdas que cubren un rectángulo.
+ *
+ * Cada entrada guarda la clave de su celda: las que comparten cubeta con otra celda por
+ * colisión del hash se descartan sin probar su posición, y ninguna entidad se reporta dos
+ * veces. Si el rectángulo cubre más celdas que entidades hay, se recorre todo el arreglo.
+ */
+template<typename Accept>
+void SpatialHashGrid::gather(float minX, float minY, float maxX, float maxY, Accept accept,
+                             std::vector<sf::Uint32>& result) const {
+    result.clear();
+    if (m_handles.empty() || maxX < minX || maxY < minY) {
+        return;
+    }
+
+    const sf::Int32 cellMinX = cellCoordinate(minX);
+    const sf::Int32 cellMinY = cellCoordinate(minY);
+    const sf::Int32 cellMaxX = cellCoordinate(maxX);
+    const sf::Int32 cellMaxY = cellCoordinate(maxY);
+    const double cellCount = (static_cast<double>(cellMaxX) - cellMinX + 1) * (static_cast<double>(cellMaxY) - cellMinY + 1);
+
+    if (cellCount > static_cast<double>(m_handles.size())) {
+        for (std::size_t i = 0; i < m_handles.size(); ++i) {
+            if (accept(m_x[i], m_y[i])) {
+                result.push_back(m_handles[i]);
+            }
+        }
+        return;
+    }
+
+    for (sf::Int32 cellY = cellMinY; cellY <= cellMaxY; ++cellY) {
+        for (sf::Int32 cellX = cellMinX; cellX <= cellMaxX; ++cellX) {
+            const sf::Uint64 key = cellKey(cellX, cellY);
+            const sf::Uint32 bucket = bucketOf(cellX, cellY);
+            const sf::Uint32 end = m_bucketStart[bucket + 1];
+            for (sf::Uint32 i = m_bucketStart[bucket]; i < end; ++i) {
+                if (m_keys[i] == key && accept(m_x[i], m_y[i])) {
+                    result.push_back(m_handles[i]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Coordenada de celda de una posición.
+ *
+ * @param value Coordenada en píxeles.
+ * @return Índice de celda (puede ser negativo).
+ */
+sf::Int32 SpatialHashGrid::cellCoordinate(float value) const {
+    return static_cast<sf::Int32>(std::floor(value * m_invCellSize));
+}
+
+/**
+ * @brief Clave única de una celda.
+ *
+ * @param cellX Columna.
+ * @param cellY Fila.
+ * @return Las dos coordenadas empaquetadas en 64 bits.
+ */
+sf::Uint64 SpatialHashGrid::cellKey(sf::Int32 cellX, sf::Int32 cellY) {
+    return (static_cast<sf::Uint64>(static_cast<sf::Uint32>(cellX)) << 32) | static_cast<sf::Uint32>(cellY);
+}
+
+/**
+ * @brief Cubeta de una celda.
+ *
+ * @param cellX Columna.
+ * @param cellY Fila.
+ * @return Índice en la tabla.
+ */
+sf::Uint32 SpatialHashGrid::bucketOf(sf::Int32 cellX, sf::Int32 cellY) const {
+    // Primos grandes clásicos del hash espacial de Teschner et al.
+    sf::Uint32 hash = static_cast<sf::Uint32>(cellX) * 73856093u ^ static_cast<sf::Uint32>(cellY) * 19349663u;
+    return hash & m_bucketMask;
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <SFML/Graphics/Rect.hpp>
+
+/**
+ * @class SpatialHashGrid
+ * @brief Rejilla uniforme con hash para consultas de proximidad sobre miles de entidades.
+ *
+ * El mundo se divide en celdas cuadradas de `cellSize` y cada celda se asigna a una
+ * cubeta de una tabla hash, así que no hace falta conocer los límites del mundo. Cada tick
+ * se reconstruye con un ordenamiento por conteo (O(n), sin reservas tras el primer tick):
+ * se cuentan las entidades por cubeta, se acumulan los conteos y se copian las entidades
+ * en orden de cubeta junto con su posición. Una consulta recorre solo las celdas que toca
+ * y lee rangos contiguos de memoria.
+ *
+ * Los resultados son handles: el índice de la entidad en el arreglo de posiciones con que
+ * se construyó la rejilla.
+ */
+class SpatialHashGrid {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param cellSize Lado de cada celda (conviene que sea del orden del radio de consulta).
+     */
+    explicit SpatialHashGrid(float cellSize = 64.0f);
+
+    /**
+     * @brief Reconstruye la rejilla con las posiciones del tick.
+     *
+     * @param x Coordenadas X (una por entidad).
+     * @param y Coordenadas Y (una por entidad).
+     * @param count Número de entidades.
+     */
+    void build(const float* x, const float* y, std::size_t count);
+
+    /**
+     * @brief Reconstruye la rejilla con las posiciones del tick.
+     *
+     * @param positions Posición de cada entidad.
+     */
+    void build(const std::vector<sf::Vector2f>& positions);
+
+    /**
+     * @brief Entidades a distancia menor o igual que `radius` de un punto.
+     *
+     * @param center Centro de la consulta.
+     * @param radius Radio de la consulta.
+     * @param result Recibe los handles encontrados (se vacía antes).
+     */
+    void queryRadius(const sf::Vector2f& center, float radius, std::vector<sf::Uint32>& result) const;
+
+    /**
+     * @brief Entidades dentro de un rectángulo (bordes incluidos).
+     *
+     * @param area Rectángulo de la consulta.
+     * @param result Recibe los handles encontrados (se vacía antes).
+     */
+    void queryAABB(const sf::FloatRect& area, std::vector<sf::Uint32>& result) const;
+
+    /**
+     * @brief Número de entidades de la última construcción.
+     *
+     * @return Entidades en la rejilla.
+     */
+    std::size_t size() const { return m_handles.size(); }
+
+    /**
+     * @brief Lado de las celdas.
+     *
+     * @return Tamaño de celda en píxeles.
+     */
+    float getCellSize() const { return m_cellSize; }
+
+private:
+    /**
+     * @brief Recorre las entidades de las celdas que cubren un rectángulo.
+     *
+     * @param minX Borde izquierdo.
+     * @param minY Borde superior.
+     * @param maxX Borde derecho.
+     * @param maxY Borde inferior.
+     * @param accept Prueba exacta sobre la posición de cada candidata.
+     * @param result Recibe los handles aceptados.
+     */
+    template<typename Accept>
+    void gather(float minX, float minY, float maxX, float maxY, Accept accept, std::vector<sf::Uint32>& result) const;
+
+    /**
+     * @brief Coordenada de celda de una posición.
+     *
+     * @param value Coordenada en píxeles.
+     * @return Índice de celda (puede ser negativo).
+     */
+    sf::Int32 cellCoordinate(float value) const;
+
+    /**
+     * @brief Clave única de una celda.
+     *
+     * @param cellX Columna.
+     * @param cellY Fila.
+     * @return Las dos coordenadas empaquetadas en 64 bits.
+     */
+    static sf::Uint64 cellKey(sf::Int32 cellX, sf::Int32 cellY);
+
+    /**
+     * @brief Cubeta de una celda.
+     *
+     * @param cellX Columna.
+     * @param cellY Fila.
+     * @return Índice en la tabla.
+     */
+    sf::Uint32 bucketOf(sf::Int32 cellX, sf::Int32 cellY) const;
+
+    float m_cellSize;                      ///< Lado de las celdas.
+    float m_invCellSize;                   ///< 1 / `m_cellSize`.
+    sf::Uint32 m_bucketMask = 0;           ///< Cubetas - 1 (la tabla es potencia de dos).
+
+    std::vector<sf::Uint32> m_bucketStart; ///< Primer índice ordenado de cada cubeta (más el total al final).
+    std::vector<sf::Uint32> m_entityBucket;///< Cubeta de cada entidad (temporal de la construcción).
+    std::vector<sf::Uint32> m_cursor;      ///< Siguiente posición libre de cada cubeta (temporal de la construcción).
+    std::vector<sf::Uint32> m_handles;     ///< Handles ordenados por cubeta.
+    std::vector<sf::Uint64> m_keys;        ///< Celda de cada entrada ordenada (descarta colisiones del hash).
+    std::vector<float> m_x;                ///< Posición X de cada entrada ordenada.
+    std::vector<float> m_y;                ///< Posición Y de cada entrada ordenada.
+};
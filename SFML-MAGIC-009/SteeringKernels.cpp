@@ -0,0 +1,328 @@
+#include "SteeringKernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGIC_STEERING_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define MAGIC_STEERING_X86 0
+#endif
+
+// GCC y Clang solo aceptan intrínsecos AVX2 en funciones marcadas para ese conjunto; MSVC
+// los acepta siempre. Así el resto del motor sigue compilando para SSE2.
+#if MAGIC_STEERING_X86 && (defined(__GNUC__) || defined(__clang__))
+#define MAGIC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MAGIC_TARGET_AVX2
+#endif
+
+/**
+ * @brief Cambia el número de agentes (los nuevos quedan en el origen y quietos).
+ *
+ * @param count Número de agentes.
+ */
+void SteeringAgents::resize(std::size_t count) {
+    positionX.resize(count, 0.0f);
+    positionY.resize(count, 0.0f);
+    velocityX.resize(count, 0.0f);
+    velocityY.resize(count, 0.0f);
+    targetX.resize(count, 0.0f);
+    targetY.resize(count, 0.0f);
+}
+
+namespace {
+/**
+ * @brief Paso escalar de un rango de agentes; también procesa las colas de las rutas SIMD.
+ *
+ * Para Seek reproduce operación por operación `Transform::Seek`.
+ */
+void steerScalar(SteeringAgents& agents, std::size_t begin, std::size_t end,
+                 const SteeringParams& params, float deltaTime) {
+    float* px = agents.positionX.data();
+    float* py = agents.positionY.data();
+    float* vx = agents.velocityX.data();
+    float* vy = agents.velocityY.data();
+    const float* tx = agents.targetX.data();
+    const float* ty = agents.targetY.data();
+
+    const float invSlowRadius = 1.0f / params.slowRadius;
+    for (std::size_t i = begin; i < end; ++i) {
+        float dx = tx[i] - px[i];
+        float dy = ty[i] - py[i];
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance > 0.0f) {
+            dx /= distance;
+            dy /= distance;
+        }
+
+        float speed = 0.0f;
+        switch (params.behavior) {
+        case SteeringBehavior::Seek:
+            speed = distance < params.range ? 0.0f : params.maxSpeed;
+            break;
+        case SteeringBehavior::Flee:
+            speed = distance < params.range ? -params.maxSpeed : 0.0f;
+            break;
+        case SteeringBehavior::Arrive:
+            speed = distance < params.range ? 0.0f : params.maxSpeed * std::min(1.0f, distance * invSlowRadius);
+            break;
+        }
+
+        vx[i] = dx * speed;
+        vy[i] = dy * speed;
+        px[i] += vx[i] * deltaTime;
+        py[i] += vy[i] * deltaTime;
+    }
+}
+
+#if MAGIC_STEERING_X86
+/**
+ * @brief Paso SSE: 4 agentes por iteración. Devuelve el primer agente no procesado.
+ */
+std::size_t steerSSE(SteeringAgents& agents, std::size_t begin, std::size_t end,
+                     const SteeringParams& params, float deltaTime) {
+    float* px = agents.positionX.data();
+    float* py = agents.positionY.data();
+    float* vx = agents.velocityX.data();
+    float* vy = agents.velocityY.data();
+    const float* tx = agents.targetX.data();
+    const float* ty = agents.targetY.data();
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    const __m128 range = _mm_set1_ps(params.range);
+    const __m128 maxSpeed = _mm_set1_ps(params.maxSpeed);
+    const __m128 fleeSpeed = _mm_set1_ps(-params.maxSpeed);
+    const __m128 invSlowRadius = _mm_set1_ps(1.0f / params.slowRadius);
+    const __m128 dt = _mm_set1_ps(deltaTime);
+
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m128 x = _mm_loadu_ps(px + i);
+        __m128 y = _mm_loadu_ps(py + i);
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(tx + i), x);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(ty + i), y);
+        __m128 squared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 nonZero = _mm_cmpgt_ps(squared, zero);
+
+        __m128 distance;
+        if (params.fastRsqrt) {
+            // rsqrt (12 bits) + un paso de Newton-Raphson: r = r * (1.5 - 0.5 * d² * r²).
+            __m128 r = _mm_rsqrt_ps(squared);
+            r = _mm_mul_ps(r, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(half, squared), _mm_mul_ps(r, r))));
+            r = _mm_and_ps(r, nonZero);  // rsqrt(0) = inf: esos carriles quedan en cero.
+            distance = _mm_mul_ps(squared, r);
+            dx = _mm_mul_ps(dx, r);
+            dy = _mm_mul_ps(dy, r);
+        }
+        else {
+            distance = _mm_sqrt_ps(squared);
+            // Dividir entre 1 donde la distancia es cero deja la dirección en (0, 0), como Seek.
+            __m128 divisor = _mm_or_ps(_mm_and_ps(nonZero, distance), _mm_andnot_ps(nonZero, one));
+            dx = _mm_div_ps(dx, divisor);
+            dy = _mm_div_ps(dy, divisor);
+        }
+
+        __m128 inside = _mm_cmplt_ps(distance, range);
+        __m128 speed;
+        switch (params.behavior) {
+        case SteeringBehavior::Seek:
+            speed = _mm_andnot_ps(inside, maxSpeed);
+            break;
+        case SteeringBehavior::Flee:
+            speed = _mm_and_ps(inside, fleeSpeed);
+            break;
+        default:
+            speed = _mm_mul_ps(maxSpeed, _mm_min_ps(one, _mm_mul_ps(distance, invSlowRadius)));
+            speed = _mm_andnot_ps(inside, speed);
+            break;
+        }
+
+        __m128 velX = _mm_mul_ps(dx, speed);
+        __m128 velY = _mm_mul_ps(dy, speed);
+        _mm_storeu_ps(vx + i, velX);
+        _mm_storeu_ps(vy + i, velY);
+        _mm_storeu_ps(px + i, _mm_add_ps(x, _mm_mul_ps(velX, dt)));
+        _mm_storeu_ps(py + i, _mm_add_ps(y, _mm_mul_ps(velY, dt)));
+    }
+    return i;
+}
+
+/**
+ * @brief Paso AVX2: 8 agentes por iteración. Devuelve el primer agente no procesado.
+ */
+MAGIC_TARGET_AVX2
+std::size_t steerAVX2(SteeringAgents& agents, std::size_t begin, std::size_t end,
+                      const SteeringParams& params, float deltaTime) {
+    float* px = agents.positionX.data();
+    float* py = agents.positionY.data();
+    float* vx = agents.velocityX.data();
+    float* vy = agents.velocityY.data();
+    const float* tx = agents.targetX.data();
+    const float* ty = agents.targetY.data();
+
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+    const __m256 range = _mm256_set1_ps(params.range);
+    const __m256 maxSpeed = _mm256_set1_ps(params.maxSpeed);
+    const __m256 fleeSpeed = _mm256_set1_ps(-params.maxSpeed);
+    const __m256 invSlowRadius = _mm256_set1_ps(1.0f / params.slowRadius);
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+
+    std::size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 x = _mm256_loadu_ps(px + i);
+        __m256 y = _mm256_loadu_ps(py + i);
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(tx + i), x);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ty + i), y);
+        __m256 squared = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        __m256 nonZero = _mm256_cmp_ps(squared, zero, _CMP_GT_OQ);
+
+        __m256 distance;
+        if (params.fastRsqrt) {
+            __m256 r = _mm256_rsqrt_ps(squared);
+            r = _mm256_mul_ps(r, _mm256_sub_ps(threeHalves, _mm256_mul_ps(_mm256_mul_ps(half, squared), _mm256_mul_ps(r, r))));
+            r = _mm256_and_ps(r, nonZero);
+            distance = _mm256_mul_ps(squared, r);
+            dx = _mm256_mul_ps(dx, r);
+            dy = _mm256_mul_ps(dy, r);
+        }
+        else {
+            distance = _mm256_sqrt_ps(squared);
+            __m256 divisor = _mm256_blendv_ps(one, distance, nonZero);
+            dx = _mm256_div_ps(dx, divisor);
+            dy = _mm256_div_ps(dy, divisor);
+        }
+
+        __m256 inside = _mm256_cmp_ps(distance, range, _CMP_LT_OQ);
+        __m256 speed;
+        switch (params.behavior) {
+        case SteeringBehavior::Seek:
+            speed = _mm256_andnot_ps(inside, maxSpeed);
+            break;
+        case SteeringBehavior::Flee:
+            speed = _mm256_and_ps(inside, fleeSpeed);
+            break;
+        default:
+            speed = _mm256_mul_ps(maxSpeed, _mm256_min_ps(one, _mm256_mul_ps(distance, invSlowRadius)));
+            speed = _mm256_andnot_ps(inside, speed);
+            break;
+        }
+
+        __m256 velX = _mm256_mul_ps(dx, speed);
+        __m256 velY = _mm256_mul_ps(dy, speed);
+        _mm256_storeu_ps(vx + i, velX);
+        _mm256_storeu_ps(vy + i, velY);
+        _mm256_storeu_ps(px + i, _mm256_add_ps(x, _mm256_mul_ps(velX, dt)));
+        _mm256_storeu_ps(py + i, _mm256_add_ps(y, _mm256_mul_ps(velY, dt)));
+    }
+    return i;
+}
+
+/**
+ * @brief Consulta a la CPU (y al sistema operativo) si AVX2 se puede usar.
+ */
+bool cpuHasAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+}
+
+/**
+ * @brief Avanza un paso todos los agentes con la mejor ruta disponible.
+ *
+ * @param agents Agentes a actualizar.
+ * @param params Comportamiento y parámetros.
+ * @param deltaTime Duración del paso en segundos.
+ */
+void Steering::update(SteeringAgents& agents, const SteeringParams& params, float deltaTime) {
+    updateRange(agents, 0, agents.size(), params, deltaTime, bestSimdLevel());
+}
+
+/**
+ * @brief Avanza un paso todos los agentes con una ruta concreta.
+ *
+ * @param agents Agentes a actualizar.
+ * @param params Comportamiento y parámetros.
+ * @param deltaTime Duración del paso en segundos.
+ * @param level Ruta a usar.
+ */
+void Steering::update(SteeringAgents& agents, const SteeringParams& params, float deltaTime, SimdLevel level) {
+    updateRange(agents, 0, agents.size(), params, deltaTime, level);
+}
+
+/**
+ * @brief Avanza un paso un rango de agentes.
+ *
+ * @param agents Agentes a actualizar.
+ * @param begin Primer agente del rango.
+ * @param end Uno más allá del último agente del rango.
+ * @param params Comportamiento y parámetros.
+ * @param deltaTime Duración del paso en segundos.
+ * @param level Ruta a usar.
+ */
+void Steering::updateRange(SteeringAgents& agents, std::size_t begin, std::size_t end,
+                           const SteeringParams& params, float deltaTime, SimdLevel level) {
+    end = std::min(end, agents.size());
+    if (begin >= end) return;
+
+    level = std::min(level, bestSimdLevel());
+    std::size_t next = begin;
+#if MAGIC_STEERING_X86
+    if (level == SimdLevel::AVX2) {
+        next = steerAVX2(agents, next, end, params, deltaTime);
+    }
+    if (level >= SimdLevel::SSE) {
+        next = steerSSE(agents, next, end, params, deltaTime);
+    }
+#endif
+    steerScalar(agents, next, end, params, deltaTime);
+}
+
+/**
+ * @brief Mejor ruta que soporta la CPU actual (se detecta una sola vez).
+ *
+ * @return Ruta más ancha disponible.
+ */
+SimdLevel Steering::bestSimdLevel() {
+#if MAGIC_STEERING_X86
+    static const SimdLevel level = cpuHasAVX2() ? SimdLevel::AVX2 : SimdLevel::SSE;
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+/**
+ * @brief Nombre legible de una ruta.
+ *
+ * @param level Ruta.
+ * @return "Scalar", "SSE" o "AVX2".
+ */
+const char* Steering::simdLevelName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::SSE:
+        return "SSE";
+    case SimdLevel::AVX2:
+        return "AVX2";
+    default:
+        return "Scalar";
+    }
+}
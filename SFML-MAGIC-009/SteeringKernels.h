@@ -0,0 +1,129 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+
+/**
+ * @enum SteeringBehavior
+ * @brief Comportamiento que aplica el kernel a todos los agentes de un lote.
+ */
+enum class SteeringBehavior {
+    Seek,   ///< Ir hacia el objetivo y detenerse dentro de `range` (igual que `Transform::Seek`).
+    Flee,   ///< Alejarse del objetivo mientras esté a menos de `range`.
+    Arrive  ///< Ir hacia el objetivo frenando dentro de `slowRadius` y detenerse dentro de `range`.
+};
+
+/**
+ * @enum SimdLevel
+ * @brief Conjunto de instrucciones con el que se ejecuta el kernel.
+ */
+enum class SimdLevel {
+    Scalar,  ///< Un agente por iteración (cualquier CPU).
+    SSE,     ///< 4 agentes por iteración (SSE2, base de x86-64).
+    AVX2     ///< 8 agentes por iteración (se detecta en tiempo de ejecución).
+};
+
+/**
+ * @struct SteeringAgents
+ * @brief Agentes en formato SoA: un arreglo contiguo por componente.
+ *
+ * El kernel lee y escribe cada arreglo de forma secuencial, de modo que cada carga
+ * vectorial trae 4 u 8 agentes sin recolectar datos dispersos.
+ */
+struct SteeringAgents {
+    std::vector<float> positionX;  ///< Posición X de cada agente.
+    std::vector<float> positionY;  ///< Posición Y de cada agente.
+    std::vector<float> velocityX;  ///< Velocidad X calculada en el último paso.
+    std::vector<float> velocityY;  ///< Velocidad Y calculada en el último paso.
+    std::vector<float> targetX;    ///< Objetivo X de cada agente.
+    std::vector<float> targetY;    ///< Objetivo Y de cada agente.
+
+    /**
+     * @brief Cambia el número de agentes (los nuevos quedan en el origen y quietos).
+     *
+     * @param count Número de agentes.
+     */
+    void resize(std::size_t count);
+
+    /**
+     * @brief Número de agentes.
+     *
+     * @return Tamaño de los arreglos.
+     */
+    std::size_t size() const { return positionX.size(); }
+};
+
+/**
+ * @struct SteeringParams
+ * @brief Parámetros comunes a todos los agentes de un lote.
+ */
+struct SteeringParams {
+    SteeringBehavior behavior = SteeringBehavior::Seek;  ///< Comportamiento a aplicar.
+    float maxSpeed = 150.0f;                             ///< Velocidad máxima en píxeles por segundo.
+    float range = 10.0f;                                 ///< Radio de parada (Seek/Arrive) o de pánico (Flee).
+    float slowRadius = 100.0f;                           ///< Radio de frenado de Arrive.
+    bool fastRsqrt = false;                              ///< Usar raíz inversa aproximada (SSE/AVX2).
+};
+
+/**
+ * @class Steering
+ * @brief Kernel por lotes de seek/flee/arrive: generaliza `Transform::Seek` a miles de agentes.
+ *
+ * Cada paso calcula, para cada agente, la dirección al objetivo, la velocidad deseada
+ * según el comportamiento y la integra en la posición. La ruta escalar hace exactamente
+ * las operaciones de `Transform::Seek` (raíz y división); las rutas SSE y AVX2 hacen las
+ * mismas operaciones en 4 u 8 carriles. Con `fastRsqrt` la raíz y la división se
+ * reemplazan por `rsqrt` más un paso de Newton-Raphson (unos 22 bits de precisión).
+ *
+ * La ruta se elige en tiempo de ejecución según la CPU; en plataformas que no son x86
+ * solo existe la escalar.
+ */
+class Steering {
+public:
+    /**
+     * @brief Avanza un paso todos los agentes con la mejor ruta disponible.
+     *
+     * @param agents Agentes a actualizar.
+     * @param params Comportamiento y parámetros.
+     * @param deltaTime Duración del paso en segundos.
+     */
+    static void update(SteeringAgents& agents, const SteeringParams& params, float deltaTime);
+
+    /**
+     * @brief Avanza un paso todos los agentes con una ruta concreta.
+     *
+     * Si la CPU no soporta la ruta pedida se usa la mejor disponible.
+     *
+     * @param agents Agentes a actualizar.
+     * @param params Comportamiento y parámetros.
+     * @param deltaTime Duración del paso en segundos.
+     * @param level Ruta a usar.
+     */
+    static void update(SteeringAgents& agents, const SteeringParams& params, float deltaTime, SimdLevel level);
+
+    /**
+     * @brief Avanza un paso un rango de agentes (para repartir un lote entre hilos).
+     *
+     * @param agents Agentes a actualizar.
+     * @param begin Primer agente del rango.
+     * @param end Uno más allá del último agente del rango.
+     * @param params Comportamiento y parámetros.
+     * @param deltaTime Duración del paso en segundos.
+     * @param level Ruta a usar.
+     */
+    static void updateRange(SteeringAgents& agents, std::size_t begin, std::size_t end,
+                            const SteeringParams& params, float deltaTime, SimdLevel level);
+
+    /**
+     * @brief Mejor ruta que soporta la CPU actual (se detecta una sola vez).
+     *
+     * @return Ruta más ancha disponible.
+     */
+    static SimdLevel bestSimdLevel();
+
+    /**
+     * @brief Nombre legible de una ruta.
+     *
+     * @param level Ruta.
+     * @return "Scalar", "SSE" o "AVX2".
+     */
+    static const char* simdLevelName(SimdLevel level);
+};
@@ -0,0 +1,129 @@
+#include "ThreadPool.h"
+#include "Profiler.h"
+
+/**
+ * @brief Constructor. Crea los hilos de trabajo.
+ *
+ * @param threadCount Hilos en total, contando al que llama (0 = uno por núcleo).
+ */
+ThreadPool::ThreadPool(unsigned int threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    m_workers.reserve(threadCount - 1);
+    for (unsigned int i = 1; i < threadCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::workerMain, this);
+    }
+}
+
+/**
+ * @brief Destructor. Despierta y une a todos los hilos de trabajo.
+ */
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief Ejecuta `task` sobre el rango [0, count) repartido entre los hilos.
+ *
+ * @param count Número de índices a procesar.
+ * @param task Función que recibe un subrango [begin, end).
+ * @param grain Índices mínimos por bloque.
+ */
+void ThreadPool::parallelFor(std::size_t count,
+                             const std::function<void(std::size_t begin, std::size_t end)>& task,
+                             std::size_t grain) {
+    if (count == 0) {
+        return;
+    }
+
+    grain = std::max<std::size_t>(1, grain);
+
+    // Sin hilos de trabajo, o con un solo bloque, no vale la pena despertar a nadie.
+    if (m_workers.empty() || count <= grain) {
+        task(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_grain = grain;
+        m_next.store(0);
+        m_activeWorkers = static_cast<unsigned int>(m_workers.size());
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    // El hilo que llama también trabaja.
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_activeWorkers == 0; });
+    m_task = nullptr;
+}
+
+/**
+ * @brief Número total de hilos que participan en `parallelFor`.
+ *
+ * @return Hilos de trabajo más el hilo que llama.
+ */
+unsigned int ThreadPool::getThreadCount() const {
+    return static_cast<unsigned int>(m_workers.size()) + 1;
+}
+
+/**
+ * @brief Bucle de cada hilo de trabajo.
+ *
+ * Duerme hasta que aparece un trabajo nuevo (cambia la generación), procesa bloques
+ * hasta agotarlos y avisa al que llama.
+ */
+void ThreadPool::workerMain() {
+    PROFILE_THREAD("Trabajador");
+
+    unsigned int seenGeneration = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this, seenGeneration]() { return m_stop || m_generation != seenGeneration; });
+            if (m_stop) {
+                return;
+            }
+            seenGeneration = m_generation;
+        }
+
+        runChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_activeWorkers;
+        }
+        m_done.notify_one();
+    }
+}
+
+/**
+ * @brief Toma bloques del trabajo actual hasta agotarlos.
+ */
+void ThreadPool::runChunks() {
+    while (true) {
+        std::size_t begin = m_next.fetch_add(m_grain);
+        if (begin >= m_count) {
+            return;
+        }
+        (*m_task)(begin, std::min(begin + m_grain, m_count));
+    }
+}
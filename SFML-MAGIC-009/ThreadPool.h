@@ -0,0 +1,79 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <thread>
+
+/**
+ * @class ThreadPool
+ * @brief Grupo fijo de hilos de trabajo para repartir bucles en paralelo.
+ *
+ * Los hilos se crean una sola vez y duermen entre trabajos. `parallelFor` divide un
+ * rango de índices en bloques que los hilos (y el hilo que llama) toman de un contador
+ * atómico, y regresa cuando todos los bloques terminaron.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param threadCount Hilos en total, contando al que llama a `parallelFor`
+     *                    (0 = uno por núcleo del procesador).
+     */
+    explicit ThreadPool(unsigned int threadCount = 0);
+
+    /**
+     * @brief Destructor. Despierta y une a todos los hilos de trabajo.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Ejecuta `task` sobre el rango [0, count) repartido entre los hilos.
+     *
+     * Bloquea hasta que todo el rango se procesó. No es reentrante: `task` no debe
+     * llamar a `parallelFor` del mismo grupo.
+     *
+     * @param count Número de índices a procesar.
+     * @param task Función que recibe un subrango [begin, end).
+     * @param grain Índices mínimos por bloque (bloques más grandes reducen la contención).
+     */
+    void parallelFor(std::size_t count,
+                     const std::function<void(std::size_t begin, std::size_t end)>& task,
+                     std::size_t grain = 1);
+
+    /**
+     * @brief Número total de hilos que participan en `parallelFor`.
+     *
+     * @return Hilos de trabajo más el hilo que llama.
+     */
+    unsigned int getThreadCount() const;
+
+private:
+    /**
+     * @brief Bucle de cada hilo de trabajo.
+     */
+    void workerMain();
+
+    /**
+     * @brief Toma bloques del trabajo actual hasta agotarlos.
+     */
+    void runChunks();
+
+    std::vector<std::thread> m_workers;  ///< Hilos de trabajo (sin contar al que llama).
+    std::mutex m_mutex;                  ///< Protege el estado del trabajo actual.
+    std::condition_variable m_wake;      ///< Despierta a los hilos cuando hay trabajo.
+    std::condition_variable m_done;      ///< Avisa al que llama cuando todos terminaron.
+
+    const std::function<void(std::size_t, std::size_t)>* m_task = nullptr;  ///< Trabajo actual.
+    std::size_t m_count = 0;             ///< Índices del trabajo actual.
+    std::size_t m_grain = 1;             ///< Tamaño de bloque del trabajo actual.
+    std::atomic<std::size_t> m_next{ 0 };  ///< Siguiente índice sin asignar.
+    unsigned int m_generation = 0;       ///< Se incrementa con cada trabajo nuevo.
+    unsigned int m_activeWorkers = 0;    ///< Hilos que aún no terminan el trabajo actual.
+    bool m_stop = false;                 ///< Los hilos deben terminar.
+};
@@ -0,0 +1,228 @@
+#include "TraceExporter.h"
+#include <iostream>
+
+#if PROFILER_ENABLED
+
+namespace {
+    /**
+     * @brief Agrega una cadena entre comillas, escapada para JSON.
+     *
+     * @param out Texto de salida.
+     * @param text Cadena a escribir.
+     */
+    void appendJsonString(std::string& out, const char* text) {
+        out += '"';
+        for (const char* c = text; *c != '\0'; ++c) {
+            if (*c == '"' || *c == '\\') {
+                out += '\\';
+                out += *c;
+            }
+            else if (static_cast<unsigned char>(*c) < 0x20) {
+                out += ' ';
+            }
+            else {
+                out += *c;
+            }
+        }
+        out += '"';
+    }
+}
+
+/**
+ * @brief Destructor. Termina la captura y cierra el archivo.
+ */
+TraceExporter::~TraceExporter() {
+    stop();
+}
+
+/**
+ * @brief Abre el archivo y empieza a recibir frames del perfilador.
+ *
+ * @param path Ruta del archivo JSON.
+ * @param frameCount Frames a capturar.
+ * @return true si el archivo se pudo crear.
+ */
+bool TraceExporter::start(const std::string& path, sf::Uint32 frameCount) {
+    stop();
+
+    m_file.open(path, std::ios::out | std::ios::trunc);
+    if (!m_file.is_open()) {
+        std::cerr << "TraceExporter : no se puede abrir '" << path << "' para escritura\n";
+        return false;
+    }
+
+    m_path = path;
+    m_frameCount = frameCount;
+    m_submitted = 0;
+    m_stop = false;
+    m_finished = false;
+    m_firstEvent = true;
+    m_pending.clear();
+    m_file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    m_writer = std::thread(&TraceExporter::writerMain, this);
+    Profiler::getInstance().setFrameCallback(
+        [this](const ProfileFrame& frame, const std::vector<std::string>& threadNames) {
+            submit(frame, threadNames);
+        });
+    return true;
+}
+
+/**
+ * @brief Deja de recibir frames, escribe los pendientes y cierra el archivo.
+ */
+void TraceExporter::stop() {
+    if (!m_writer.joinable()) {
+        return;
+    }
+
+    Profiler::getInstance().setFrameCallback(nullptr);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_writer.join();
+}
+
+/**
+ * @brief Indica si la captura sigue abierta.
+ *
+ * @return true mientras falten frames por recibir o por escribir.
+ */
+bool TraceExporter::isCapturing() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_finished;
+}
+
+/**
+ * @brief Frames recibidos del perfilador hasta ahora.
+ *
+ * @return Número de frames encolados.
+ */
+sf::Uint32 TraceExporter::getCapturedFrames() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_submitted;
+}
+
+/**
+ * @brief Encola una copia del frame.
+ *
+ * Es lo único que paga el hilo principal: una copia de las zonas del frame.
+ *
+ * @param frame Frame recogido.
+ * @param threadNames Nombres de los hilos por índice.
+ */
+void TraceExporter::submit(const ProfileFrame& frame, const std::vector<std::string>& threadNames) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_submitted >= m_frameCount) {
+            return;
+        }
+        m_pending.push_back(frame);
+        m_threadNames = threadNames;
+        ++m_submitted;
+    }
+    m_wake.notify_one();
+}
+
+/**
+ * @brief Bucle del hilo escritor.
+ *
+ * Saca los frames de la cola en bloques, los formatea fuera del candado y los escribe.
+ * Al completar la captura (o al detenerse) agrega los nombres de los hilos como
+ * metadatos y cierra el JSON.
+ */
+void TraceExporter::writerMain() {
+    std::deque<ProfileFrame> batch;
+    std::string out;
+    sf::Uint32 written = 0;
+
+    while (true) {
+        bool stopping = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this]() { return m_stop || !m_pending.empty(); });
+            batch.swap(m_pending);
+            stopping = m_stop;
+        }
+
+        out.clear();
+        for (const ProfileFrame& frame : batch) {
+            appendFrame(frame, out);
+        }
+        written += static_cast<sf::Uint32>(batch.size());
+        batch.clear();
+        m_file << out;
+
+        if (stopping || written >= m_frameCount) {
+            break;
+        }
+    }
+
+    std::vector<std::string> threadNames;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        threadNames = m_threadNames;
+    }
+
+    // Metadatos: nombre del proceso y de cada pista.
+    out.clear();
+    beginEvent(out);
+    out += "\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"SFML-MAGIC-009\"}}";
+    beginEvent(out);
+    out += "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+    for (std::size_t i = 0; i < threadNames.size(); ++i) {
+        beginEvent(out);
+        out += "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(i + 1) +
+               ",\"args\":{\"name\":";
+        appendJsonString(out, threadNames[i].c_str());
+        out += "}}";
+    }
+    out += "\n]}\n";
+    m_file << out;
+    m_file.close();
+
+    std::cout << "TraceExporter : " << written << " frames escritos en " << m_path << std::endl;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_finished = true;
+}
+
+/**
+ * @brief Agrega los eventos de un frame al texto de salida.
+ *
+ * Los tiempos del perfilador ya están en microsegundos, la unidad de `ts` y `dur`.
+ * La pista 0 lleva los frames; el hilo con índice i va en la pista i + 1.
+ *
+ * @param frame Frame a convertir.
+ * @param out Texto JSON de salida.
+ */
+void TraceExporter::appendFrame(const ProfileFrame& frame, std::string& out) {
+    beginEvent(out);
+    out += "\"name\":\"Frame " + std::to_string(frame.index) + "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":" +
+           std::to_string(frame.start) + ",\"dur\":" + std::to_string(frame.end - frame.start) + "}";
+
+    for (const ProfileZone& zone : frame.zones) {
+        beginEvent(out);
+        out += "\"name\":";
+        appendJsonString(out, zone.name);
+        out += ",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(zone.thread + 1) +
+               ",\"ts\":" + std::to_string(zone.start) + ",\"dur\":" + std::to_string(zone.end - zone.start) + "}";
+    }
+}
+
+/**
+ * @brief Agrega el separador entre eventos y abre el objeto del evento.
+ *
+ * @param out Texto JSON de salida.
+ */
+void TraceExporter::beginEvent(std::string& out) {
+    if (!m_firstEvent) {
+        out += ",\n";
+    }
+    m_firstEvent = false;
+    out += '{';
+}
+
+#endif
@@ -0,0 +1,113 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include "Profiler.h"       // Zonas y frames del perfilador.
+
+#if PROFILER_ENABLED
+
+#include <fstream>
+#include <deque>
+#include <condition_variable>
+#include <thread>
+
+/**
+ * @class TraceExporter
+ * @brief Captura N frames del perfilador y los escribe como Chrome Trace Event JSON.
+ *
+ * El archivo resultante se abre en `chrome://tracing` o en Perfetto (ui.perfetto.dev).
+ * Cada zona se escribe como un evento completo (`"ph":"X"`) en la pista de su hilo y cada
+ * frame como un evento en una pista "Frames" aparte.
+ *
+ * El hilo principal solo copia cada frame a una cola; el formateo y la escritura a disco
+ * ocurren en un hilo propio, para no alterar los frames que se están midiendo. El archivo
+ * se cierra en cuanto se escribieron los N frames, aunque la aplicación siga corriendo.
+ */
+class TraceExporter {
+public:
+    /**
+     * @brief Constructor por defecto. No captura nada hasta llamar a `start`.
+     */
+    TraceExporter() = default;
+
+    /**
+     * @brief Destructor. Termina la captura y cierra el archivo.
+     */
+    ~TraceExporter();
+
+    TraceExporter(const TraceExporter&) = delete;
+    TraceExporter& operator=(const TraceExporter&) = delete;
+
+    /**
+     * @brief Abre el archivo y empieza a recibir frames del perfilador.
+     *
+     * @param path Ruta del archivo JSON.
+     * @param frameCount Frames a capturar.
+     * @return true si el archivo se pudo crear.
+     */
+    bool start(const std::string& path, sf::Uint32 frameCount);
+
+    /**
+     * @brief Deja de recibir frames, escribe los pendientes y cierra el archivo.
+     *
+     * Si la captura no llegó a N frames, el archivo queda válido con los que hubo.
+     */
+    void stop();
+
+    /**
+     * @brief Indica si la captura sigue abierta.
+     *
+     * @return true mientras falten frames por recibir o por escribir.
+     */
+    bool isCapturing() const;
+
+    /**
+     * @brief Frames recibidos del perfilador hasta ahora.
+     *
+     * @return Número de frames encolados.
+     */
+    sf::Uint32 getCapturedFrames() const;
+
+private:
+    /**
+     * @brief Encola una copia del frame (se llama desde `Profiler::endFrame`).
+     *
+     * @param frame Frame recogido.
+     * @param threadNames Nombres de los hilos por índice.
+     */
+    void submit(const ProfileFrame& frame, const std::vector<std::string>& threadNames);
+
+    /**
+     * @brief Bucle del hilo escritor.
+     */
+    void writerMain();
+
+    /**
+     * @brief Agrega los eventos de un frame al texto de salida.
+     *
+     * @param frame Frame a convertir.
+     * @param out Texto JSON de salida.
+     */
+    void appendFrame(const ProfileFrame& frame, std::string& out);
+
+    /**
+     * @brief Agrega el separador entre eventos y el prefijo común de un evento.
+     *
+     * @param out Texto JSON de salida.
+     */
+    void beginEvent(std::string& out);
+
+    std::string m_path;                       ///< Ruta del archivo.
+    std::ofstream m_file;                     ///< Archivo de salida (solo lo usa el escritor).
+    std::thread m_writer;                     ///< Hilo que formatea y escribe.
+
+    mutable std::mutex m_mutex;               ///< Protege la cola y los nombres.
+    std::condition_variable m_wake;           ///< Despierta al escritor.
+    std::deque<ProfileFrame> m_pending;       ///< Frames por escribir.
+    std::vector<std::string> m_threadNames;   ///< Nombres de los hilos más recientes.
+    sf::Uint32 m_frameCount = 0;              ///< Frames a capturar.
+    sf::Uint32 m_submitted = 0;               ///< Frames encolados.
+    bool m_stop = false;                      ///< El escritor debe terminar.
+    bool m_finished = true;                   ///< El archivo ya se cerró.
+    bool m_firstEvent = true;                 ///< Aún no se escribió ningún evento.
+};
+
+#endif
@@ -0,0 +1,256 @@
+#include "TrackMask.h"
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace {
+    constexpr float kDistanceScale = 4.0f;  // Cuartos de píxel por unidad guardada.
+    constexpr float kInfinity = std::numeric_limits<float>::infinity();
+
+    /**
+     * @brief Transformada de distancia 1D exacta (envolvente inferior de parábolas).
+     *
+     * @param f Costo de cada muestra (0 en destinos, infinito en el resto, o el resultado de la pasada anterior).
+     * @param count Muestras.
+     * @param spacing Distancia en el mundo entre muestras consecutivas.
+     * @param d Recibe la distancia al cuadrado de cada muestra.
+     * @param v Temporal: vértices de las parábolas de la envolvente.
+     * @param z Temporal: fronteras entre parábolas (count + 1).
+     */
+    void distanceTransform1D(const float* f, std::size_t count, float spacing, float* d,
+                             std::vector<std::size_t>& v, std::vector<float>& z) {
+        // Parábolas en coordenadas del mundo: la muestra q está en q * spacing.
+        std::size_t k = 0;
+        std::size_t first = 0;
+        while (first < count && f[first] == kInfinity) {
+            ++first;
+        }
+        if (first == count) {
+            std::fill(d, d + count, kInfinity);
+            return;
+        }
+
+        v[0] = first;
+        z[0] = -kInfinity;
+        z[1] = kInfinity;
+        for (std::size_t q = first + 1; q < count; ++q) {
+            if (f[q] == kInfinity) {
+                continue;
+            }
+            const float pq = q * spacing;
+            float s;
+            // z[0] es -infinito, así que el retroceso siempre se detiene en la primera parábola.
+            while (true) {
+                const float pv = v[k] * spacing;
+                s = ((f[q] + pq * pq) - (f[v[k]] + pv * pv)) / (2.0f * (pq - pv));
+                if (s > z[k]) {
+                    break;
+                }
+                --k;
+            }
+            ++k;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = kInfinity;
+        }
+
+        k = 0;
+        for (std::size_t q = 0; q < count; ++q) {
+            const float pq = q * spacing;
+            while (z[k + 1] < pq) {
+                ++k;
+            }
+            const float delta = pq - v[k] * spacing;
+            d[q] = delta * delta + f[v[k]];
+        }
+    }
+
+    /**
+     * @brief Celda de una coordenada, acotada a un margen de una celda fuera de la máscara.
+     *
+     * Se acota en flotante antes de convertir para que posiciones enormes no desborden el entero.
+     *
+     * @param offset Coordenada relativa al origen de la máscara.
+     * @param inverseCellSize 1 / tamaño de la celda.
+     * @param count Celdas en ese eje.
+     * @return Índice de la celda en [-1, count].
+     */
+    sf::Int32 toCell(float offset, float inverseCellSize, sf::Uint32 count) {
+        const float cell = std::floor(offset * inverseCellSize);
+        return static_cast<sf::Int32>(std::max(-1.0f, std::min(static_cast<float>(count), cell)));
+    }
+}
+
+/**
+ * @brief Clasificador por defecto: asfalto gris (poco saturado) y opaco.
+ *
+ * @param color Color del píxel.
+ * @return true si el píxel parece asfalto.
+ */
+bool TrackMask::isRoadColor(const sf::Color& color) {
+    const sf::Uint8 high = std::max(color.r, std::max(color.g, color.b));
+    const sf::Uint8 low = std::min(color.r, std::min(color.g, color.b));
+    return color.a > 0 && high - low <= 40;
+}
+
+/**
+ * @brief Hornea la máscara (y opcionalmente el campo de distancias) desde la imagen.
+ *
+ * @param image Imagen de la pista.
+ * @param worldBounds Rectángulo del mundo que cubre la imagen.
+ * @param withDistanceField true para hornear también el campo de distancias.
+ * @param isRoad Clasificador de píxeles.
+ * @return false si la imagen o el rectángulo están vacíos.
+ */
+bool TrackMask::bake(const sf::Image& image, const sf::FloatRect& worldBounds, bool withDistanceField,
+                     const Classifier& isRoad) {
+    const sf::Vector2u size = image.getSize();
+    if (size.x == 0 || size.y == 0 || worldBounds.width <= 0.0f || worldBounds.height <= 0.0f) {
+        std::cerr << "TrackMask : la imagen o el rectángulo de la pista están vacíos\n";
+        return false;
+    }
+
+    m_width = size.x;
+    m_height = size.y;
+    m_wordsPerRow = (m_width + 63) / 64;
+    m_origin = sf::Vector2f(worldBounds.left, worldBounds.top);
+    m_cellSize = sf::Vector2f(worldBounds.width / m_width, worldBounds.height / m_height);
+    m_inverseCellSize = sf::Vector2f(1.0f / m_cellSize.x, 1.0f / m_cellSize.y);
+
+    // Se clasifica directamente sobre los bytes RGBA: una sola pasada por la imagen.
+    m_bits.assign(static_cast<std::size_t>(m_wordsPerRow) * m_height, 0);
+    const sf::Uint8* pixels = image.getPixelsPtr();
+    for (sf::Uint32 y = 0; y < m_height; ++y) {
+        sf::Uint64* row = &m_bits[static_cast<std::size_t>(y) * m_wordsPerRow];
+        for (sf::Uint32 x = 0; x < m_width; ++x) {
+            const sf::Uint8* p = pixels + (static_cast<std::size_t>(y) * m_width + x) * 4;
+            if (isRoad(sf::Color(p[0], p[1], p[2], p[3]))) {
+                row[x >> 6] |= sf::Uint64(1) << (x & 63);
+            }
+        }
+    }
+
+    m_distance.clear();
+    if (!withDistanceField) {
+        return true;
+    }
+
+    // Distancia de cada celda de asfalto a la celda fuera de pista más cercana, y al revés.
+    const std::size_t cells = static_cast<std::size_t>(m_width) * m_height;
+    std::vector<bool> road(cells);
+    std::vector<bool> offRoad(cells);
+    for (sf::Uint32 y = 0; y < m_height; ++y) {
+        for (sf::Uint32 x = 0; x < m_width; ++x) {
+            const bool drivable = (m_bits[static_cast<std::size_t>(y) * m_wordsPerRow + (x >> 6)] >> (x & 63)) & 1u;
+            road[static_cast<std::size_t>(y) * m_width + x] = drivable;
+            offRoad[static_cast<std::size_t>(y) * m_width + x] = !drivable;
+        }
+    }
+    std::vector<float> toOffRoad;
+    std::vector<float> toRoad;
+    distanceTransform(offRoad, toOffRoad);
+    distanceTransform(road, toRoad);
+
+    // Sin celdas del tipo opuesto la distancia es infinita: se acota al rango de 16 bits.
+    const float limit = std::numeric_limits<sf::Int16>::max() / kDistanceScale;
+    m_distance.resize(cells);
+    for (std::size_t i = 0; i < cells; ++i) {
+        const float distance = road[i] ? std::sqrt(toOffRoad[i]) : -std::sqrt(toRoad[i]);
+        const float clamped = std::max(-limit, std::min(limit, distance));
+        m_distance[i] = static_cast<sf::Int16>(std::lround(clamped * kDistanceScale));
+    }
+    return true;
+}
+
+/**
+ * @brief Distancia euclídea al cuadrado a la celda marcada más cercana.
+ *
+ * @param marked true en las celdas de destino.
+ * @param result Recibe la distancia al cuadrado de cada celda.
+ */
+void TrackMask::distanceTransform(const std::vector<bool>& marked, std::vector<float>& result) const {
+    const std::size_t width = m_width;
+    const std::size_t height = m_height;
+    result.assign(width * height, kInfinity);
+
+    const std::size_t longest = std::max(width, height);
+    std::vector<float> f(longest);
+    std::vector<float> d(longest);
+    std::vector<std::size_t> v(longest);
+    std::vector<float> z(longest + 1);
+
+    // Columnas: distancia vertical a la celda marcada más cercana.
+    for (std::size_t x = 0; x < width; ++x) {
+        for (std::size_t y = 0; y < height; ++y) {
+            f[y] = marked[y * width + x] ? 0.0f : kInfinity;
+        }
+        distanceTransform1D(f.data(), height, m_cellSize.y, d.data(), v, z);
+        for (std::size_t y = 0; y < height; ++y) {
+            result[y * width + x] = d[y];
+        }
+    }
+
+    // Filas: combina con la distancia horizontal.
+    for (std::size_t y = 0; y < height; ++y) {
+        float* row = &result[y * width];
+        std::copy(row, row + width, f.begin());
+        distanceTransform1D(f.data(), width, m_cellSize.x, row, v, z);
+    }
+}
+
+/**
+ * @brief Distancia con signo de una celda (acotada a la máscara).
+ *
+ * @param x Columna.
+ * @param y Fila.
+ * @return Distancia en píxeles del mundo.
+ */
+float TrackMask::cellDistance(sf::Int32 x, sf::Int32 y) const {
+    x = std::max(0, std::min(static_cast<sf::Int32>(m_width) - 1, x));
+    y = std::max(0, std::min(static_cast<sf::Int32>(m_height) - 1, y));
+    return m_distance[static_cast<std::size_t>(y) * m_width + x] / kDistanceScale;
+}
+
+/**
+ * @brief Distancia con signo al borde de la pista.
+ *
+ * @param position Posición en el mundo.
+ * @return Positiva sobre el asfalto, negativa fuera (0 sin campo).
+ */
+float TrackMask::getDistance(const sf::Vector2f& position) const {
+    if (m_distance.empty()) {
+        return 0.0f;
+    }
+    const sf::Int32 x = toCell(position.x - m_origin.x, m_inverseCellSize.x, m_width);
+    const sf::Int32 y = toCell(position.y - m_origin.y, m_inverseCellSize.y, m_height);
+    const float distance = cellDistance(x, y);
+
+    // Fuera de la imagen todo es fuera de pista: se suma lo que falta para llegar al borde.
+    const float outsideX = std::max(0.0f, std::max(m_origin.x - position.x, position.x - (m_origin.x + m_width * m_cellSize.x)));
+    const float outsideY = std::max(0.0f, std::max(m_origin.y - position.y, position.y - (m_origin.y + m_height * m_cellSize.y)));
+    if (outsideX > 0.0f || outsideY > 0.0f) {
+        return std::min(distance, 0.0f) - std::sqrt(outsideX * outsideX + outsideY * outsideY);
+    }
+    return distance;
+}
+
+/**
+ * @brief Dirección hacia el centro de la pista (diferencias centrales del campo).
+ *
+ * @param position Posición en el mundo.
+ * @return Vector unitario, o cero si el campo es plano o no existe.
+ */
+sf::Vector2f TrackMask::getGradient(const sf::Vector2f& position) const {
+    if (m_distance.empty()) {
+        return sf::Vector2f(0.0f, 0.0f);
+    }
+    const sf::Int32 x = toCell(position.x - m_origin.x, m_inverseCellSize.x, m_width);
+    const sf::Int32 y = toCell(position.y - m_origin.y, m_inverseCellSize.y, m_height);
+    const sf::Vector2f gradient((cellDistance(x + 1, y) - cellDistance(x - 1, y)) * m_inverseCellSize.x,
+                                (cellDistance(x, y + 1) - cellDistance(x, y - 1)) * m_inverseCellSize.y);
+    const float length = std::sqrt(gradient.x * gradient.x + gradient.y * gradient.y);
+    if (length <= 0.0f) {
+        return sf::Vector2f(0.0f, 0.0f);
+    }
+    return gradient / length;
+}
@@ -0,0 +1,154 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <functional>
+
+/**
+ * @class TrackMask
+ * @brief Máscara de la pista (asfalto / fuera de pista) horneada desde la imagen del circuito.
+ *
+ * Al iniciar se clasifica cada píxel de la imagen una sola vez y se guarda un bit por
+ * píxel, fila por fila en palabras de 64 bits: la pista de 1100x600 cabe en unos 80 KB
+ * y saber si un kart está sobre el asfalto es una resta, una multiplicación y la lectura
+ * de un bit, en lugar de leer y clasificar un `sf::Color` de la imagen.
+ *
+ * Opcionalmente se hornea también un campo de distancias con signo (euclídeo exacto):
+ * cuánto falta para salir de la pista (positivo) o para volver a ella (negativo), con
+ * un cuarto de píxel de resolución en 16 bits. Su gradiente apunta hacia el asfalto.
+ *
+ * Es inmutable después de `bake`: cualquier número de hilos la puede consultar a la vez.
+ */
+class TrackMask {
+public:
+    /**
+     * @brief Decide si un color de la imagen es asfalto.
+     */
+    using Classifier = std::function<bool(const sf::Color&)>;
+
+    TrackMask() = default;
+
+    /**
+     * @brief Hornea la máscara a partir de la imagen del circuito.
+     *
+     * @param image Imagen de la pista.
+     * @param worldBounds Rectángulo del mundo que cubre la imagen (la pista dibujada).
+     * @param withDistanceField true para hornear también el campo de distancias.
+     * @param isRoad Clasificador de píxeles (por defecto `isRoadColor`).
+     * @return false si la imagen o el rectángulo están vacíos.
+     */
+    bool bake(const sf::Image& image, const sf::FloatRect& worldBounds, bool withDistanceField = true,
+              const Classifier& isRoad = &TrackMask::isRoadColor);
+
+    /**
+     * @brief Indica si una posición del mundo está sobre el asfalto.
+     *
+     * @param position Posición en el mundo.
+     * @return true sobre la pista; false fuera de ella o fuera de la imagen.
+     */
+    bool isDrivable(const sf::Vector2f& position) const {
+        const float cellX = (position.x - m_origin.x) * m_inverseCellSize.x;
+        const float cellY = (position.y - m_origin.y) * m_inverseCellSize.y;
+        // La comparación negada también descarta NaN.
+        if (!(cellX >= 0.0f && cellY >= 0.0f && cellX < m_width && cellY < m_height)) {
+            return false;
+        }
+        const sf::Uint32 x = static_cast<sf::Uint32>(cellX);
+        const sf::Uint32 y = static_cast<sf::Uint32>(cellY);
+        return (m_bits[y * m_wordsPerRow + (x >> 6)] >> (x & 63)) & 1u;
+    }
+
+    /**
+     * @brief Distancia con signo al borde de la pista.
+     *
+     * @param position Posición en el mundo.
+     * @return Píxeles del mundo hasta el borde: positiva sobre el asfalto, negativa fuera
+     *         (0 si no se horneó el campo).
+     */
+    float getDistance(const sf::Vector2f& position) const;
+
+    /**
+     * @brief Dirección en que crece la distancia (hacia el centro de la pista).
+     *
+     * @param position Posición en el mundo.
+     * @return Vector unitario, o cero si el campo es plano o no se horneó.
+     */
+    sf::Vector2f getGradient(const sf::Vector2f& position) const;
+
+    /**
+     * @brief Clasificador por defecto: asfalto gris (poco saturado) y opaco.
+     *
+     * El césped, la arena y los bordes del circuito son colores saturados; el asfalto y
+     * las líneas de salida son grises.
+     *
+     * @param color Color del píxel.
+     * @return true si el píxel parece asfalto.
+     */
+    static bool isRoadColor(const sf::Color& color);
+
+    /**
+     * @brief Indica si la máscara no se ha horneado.
+     *
+     * @return true si está vacía.
+     */
+    bool isEmpty() const { return m_bits.empty(); }
+
+    /**
+     * @brief Indica si se horneó el campo de distancias.
+     *
+     * @return true si `getDistance` y `getGradient` tienen datos.
+     */
+    bool hasDistanceField() const { return !m_distance.empty(); }
+
+    /**
+     * @brief Columnas de la máscara (píxeles de la imagen).
+     *
+     * @return Ancho en celdas.
+     */
+    sf::Uint32 getWidth() const { return m_width; }
+
+    /**
+     * @brief Filas de la máscara.
+     *
+     * @return Alto en celdas.
+     */
+    sf::Uint32 getHeight() const { return m_height; }
+
+    /**
+     * @brief Memoria ocupada por la máscara y el campo de distancias.
+     *
+     * @return Bytes reservados.
+     */
+    std::size_t getMemoryBytes() const {
+        return m_bits.size() * sizeof(sf::Uint64) + m_distance.size() * sizeof(sf::Int16);
+    }
+
+private:
+    /**
+     * @brief Distancia con signo de una celda (acotada a la máscara).
+     *
+     * @param x Columna.
+     * @param y Fila.
+     * @return Distancia en píxeles del mundo.
+     */
+    float cellDistance(sf::Int32 x, sf::Int32 y) const;
+
+    /**
+     * @brief Distancia euclídea al cuadrado a la celda marcada más cercana (Felzenszwalb-Huttenlocher).
+     *
+     * Dos pasadas de la transformada 1D exacta (columnas y luego filas), O(celdas).
+     *
+     * @param marked true en las celdas de destino.
+     * @param result Recibe la distancia al cuadrado de cada celda, en píxeles del mundo.
+     */
+    void distanceTransform(const std::vector<bool>& marked, std::vector<float>& result) const;
+
+    std::vector<sf::Uint64> m_bits;         ///< Un bit por celda (1 = asfalto), filas alineadas a 64 bits.
+    std::vector<sf::Int16> m_distance;      ///< Distancia con signo en cuartos de píxel (vacío si no se horneó).
+    sf::Uint32 m_wordsPerRow = 0;           ///< Palabras de 64 bits por fila.
+    sf::Uint32 m_width = 0;                 ///< Columnas.
+    sf::Uint32 m_height = 0;                ///< Filas.
+    sf::Vector2f m_origin;                  ///< Esquina del mundo que corresponde a la celda (0, 0).
+    sf::Vector2f m_cellSize{ 1.0f, 1.0f };  ///< Tamaño de una celda en el mundo.
+    sf::Vector2f m_inverseCellSize{ 0.0f, 0.0f };  ///< 1 / `m_cellSize` (0 mientras está vacía).
+};
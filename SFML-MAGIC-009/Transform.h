@@ -5,35 +5,39 @@
 
 /*
  * Transform.h
- * Esta clase gestiona las transformaciones bsicas de un actor en la escena, incluyendo su posicin,
- * rotacin y escala. Estas propiedades definen cmo se representa y transforma el actor en el mundo 2D.
+ * Esta clase gestiona las transformaciones básicas de un actor en la escena, incluyendo su posición,
+ * rotación y escala. Estas propiedades definen cómo se representa y transforma el actor en el mundo 2D.
  */
 class Transform : public Component
 {
 public:
-    // Constructor por defecto que inicializa la posicin, rotacin y escala a valores por defecto.
+    // Constructor por defecto que inicializa la posición, rotación y escala a valores por defecto.
     Transform()
-        : position(0.0f, 0.0f), rotation(0.0f), scale(1.0f, 1.0f), Component(ComponentType::TRANSFORM) {}
+        : position(0.0f, 0.0f), rotation(0.0f), scale(1.0f, 1.0f), Component(ComponentType::TRANSFORM) {
+        savePreviousState();
+    }
 
-    // Constructor con parmetros que permite inicializar las propiedades de transformacin.
+    // Constructor con parámetros que permite inicializar las propiedades de transformación.
     Transform(const sf::Vector2f& position, float rotation = 0.0f, const sf::Vector2f& scale = sf::Vector2f(1.0f, 1.0f))
-        : position(position), rotation(rotation), scale(scale), Component(ComponentType::TRANSFORM) {}
+        : position(position), rotation(rotation), scale(scale), Component(ComponentType::TRANSFORM) {
+        savePreviousState();
+    }
 
-    // Destructor por defecto. No requiere liberacin de recursos especiales.
+    // Destructor por defecto. No requiere liberación de recursos especiales.
     virtual ~Transform() = default;
 
-    // Actualiza el estado del componente (no hace nada en esta implementacin).
+    // Actualiza el estado del componente (no hace nada en esta implementación).
     void update(float deltaTime) override {}
 
     // Renderiza el componente (no aplicable para Transform).
     void render(Window& window) override {}
 
-    // Establece la posicin del actor.
+    // Establece la posición del actor.
     void setPosition(const sf::Vector2f& newPosition) {
         position = newPosition;
     }
 
-    // Establece la rotacin del actor.
+    // Establece la rotación del actor.
     void setRotation(float newRotation) {
         rotation = newRotation;
     }
@@ -43,12 +47,12 @@ public:
         scale = newScale;
     }
 
-    // Devuelve la posicin actual del actor.
+    // Devuelve la posición actual del actor.
     sf::Vector2f& getPosition() {
         return position;
     }
 
-    // Devuelve la rotacin actual del actor.
+    // Devuelve la rotación actual del actor.
     float getRotation() const {
         return rotation;
     }
@@ -58,35 +62,72 @@ public:
         return scale;
     }
 
+    // Guarda la transformación actual como la del tick anterior.
+    // Se llama al inicio de cada tick de simulación, antes de mover al actor.
+    void savePreviousState() {
+        previousPosition = position;
+        previousRotation = rotation;
+        previousScale = scale;
+    }
+
+    // Posición interpolada entre el tick anterior y el actual.
+    // @param alpha Fracción de tick transcurrida (0 = tick anterior, 1 = tick actual).
+    sf::Vector2f getInterpolatedPosition(float alpha) const {
+        return previousPosition + (position - previousPosition) * alpha;
+    }
+
+    // Rotación interpolada por el camino más corto (por ejemplo, de 350° a 10° pasa por 0°).
+    // @param alpha Fracción de tick transcurrida.
+    float getInterpolatedRotation(float alpha) const {
+        float delta = std::fmod(rotation - previousRotation + 540.0f, 360.0f) - 180.0f;
+        return previousRotation + delta * alpha;
+    }
+
+    // Escala interpolada entre el tick anterior y el actual.
+    // @param alpha Fracción de tick transcurrida.
+    sf::Vector2f getInterpolatedScale(float alpha) const {
+        return previousScale + (scale - previousScale) * alpha;
+    }
+
     /**
-     * @brief Mueve la entidad hacia un objetivo con una velocidad especfica.
+     * @brief Mueve la entidad hacia un objetivo con una velocidad específica.
      *
-     * @param targetPosition La posicin objetivo hacia la que se mover.
-     * @param speed La velocidad a la que se mover la entidad.
+     * @param targetPosition La posición objetivo hacia la que se moverá.
+     * @param speed La velocidad a la que se moverá la entidad.
      * @param deltaTime El tiempo transcurrido entre frames para un movimiento suave.
-     * @param range La distancia mnima antes de detener el movimiento.
+     * @param range La distancia mínima antes de detener el movimiento.
+     * @return false si ya estaba dentro del rango (no se movió).
+     *
+     * Para miles de agentes a la vez, `Steering::update` (SteeringKernels.h) hace el mismo
+     * cálculo por lotes con SSE/AVX2; `FixedTransform::Seek` (FixedPoint.h) es la versión
+     * en punto fijo, idéntica bit a bit en cualquier compilación.
      */
-    void Seek(const sf::Vector2f& targetPosition, float speed, float deltaTime, float range) {
-        // Calcular la direccin hacia el objetivo.
+    bool Seek(const sf::Vector2f& targetPosition, float speed, float deltaTime, float range) {
+        // Calcular la dirección hacia el objetivo.
         sf::Vector2f direction = targetPosition - position;
 
         // Calcular la distancia al objetivo.
         float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
 
-        // Si estamos dentro del rango, no realizamos ms movimiento.
-        if (distance < range) return;
+        // Si estamos dentro del rango, no realizamos más movimiento.
+        if (distance < range) return false;
 
-        // Normalizamos la direccin.
+        // Normalizamos la dirección.
         if (distance > 0.0f) {
             direction /= distance;
         }
 
-        // Mover la posicin segn la direccin, velocidad y deltaTime.
+        // Mover la posición según la dirección, velocidad y deltaTime.
         position += direction * speed * deltaTime;
+        return true;
     }
 
 private:
-    sf::Vector2f position;  // Posicin del actor.
-    float rotation;         // Rotacin del actor en grados.
+    sf::Vector2f position;  // Posición del actor.
+    float rotation;         // Rotación del actor en grados.
     sf::Vector2f scale;     // Escala del actor en los ejes X e Y.
+
+    sf::Vector2f previousPosition;  // Posición al inicio del tick actual (para interpolar).
+    float previousRotation;         // Rotación al inicio del tick actual.
+    sf::Vector2f previousScale;     // Escala al inicio del tick actual.
 };
@@ -0,0 +1,159 @@
+#include "WaypointPath.h"
+#include <limits>
+
+/**
+ * @brief Constructor. Precalcula direcciones y longitudes acumuladas de los tramos.
+ *
+ * @param points Waypoints en orden de recorrido.
+ * @param closed true si después del último waypoint se vuelve al primero.
+ */
+WaypointPath::WaypointPath(const std::vector<sf::Vector2f>& points, bool closed)
+    : m_closed(closed) {
+    for (const sf::Vector2f& point : points) {
+        if (m_points.empty() || point != m_points.back()) {
+            m_points.push_back(point);
+        }
+    }
+    if (m_closed && m_points.size() > 1 && m_points.front() == m_points.back()) {
+        m_points.pop_back();
+    }
+
+    std::size_t segmentCount = m_points.size() < 2 ? 0 : (m_closed ? m_points.size() : m_points.size() - 1);
+    m_directions.reserve(segmentCount);
+    m_starts.reserve(segmentCount + 1);
+    for (std::size_t i = 0; i < segmentCount; ++i) {
+        sf::Vector2f delta = m_points[(i + 1) % m_points.size()] - m_points[i];
+        float length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+        m_starts.push_back(m_length);
+        m_directions.push_back(delta / length);
+        m_length += length;
+    }
+    m_starts.push_back(m_length);
+}
+
+/**
+ * @brief Avanza un agente sobre la ruta.
+ *
+ * @param progress Avance del agente (se actualiza).
+ * @param delta Distancia a recorrer (negativa para retroceder).
+ * @return Nueva posición del agente.
+ */
+sf::Vector2f WaypointPath::advance(PathProgress& progress, float delta) const {
+    progress.distance = wrapDistance(progress.distance + delta);
+    progress.segment = findSegment(progress.distance, progress.segment);
+    return getPosition(progress);
+}
+
+/**
+ * @brief Posición correspondiente a un avance.
+ *
+ * @param progress Avance sobre la ruta.
+ * @return Punto de la ruta.
+ */
+sf::Vector2f WaypointPath::getPosition(const PathProgress& progress) const {
+    if (m_directions.empty()) {
+        return m_points.empty() ? sf::Vector2f(0.0f, 0.0f) : m_points.front();
+    }
+    sf::Uint32 segment = std::min<sf::Uint32>(progress.segment, static_cast<sf::Uint32>(m_directions.size() - 1));
+    return m_points[segment] + m_directions[segment] * (progress.distance - m_starts[segment]);
+}
+
+/**
+ * @brief Dirección de la ruta en un avance.
+ *
+ * @param progress Avance sobre la ruta.
+ * @return Vector unitario del tramo actual (cero si la ruta no tiene tramos).
+ */
+sf::Vector2f WaypointPath::getDirection(const PathProgress& progress) const {
+    if (m_directions.empty()) {
+        return sf::Vector2f(0.0f, 0.0f);
+    }
+    return m_directions[std::min<sf::Uint32>(progress.segment, static_cast<sf::Uint32>(m_directions.size() - 1))];
+}
+
+/**
+ * @brief Avance correspondiente a una distancia desde el inicio (búsqueda binaria).
+ *
+ * @param distance Distancia desde el primer waypoint.
+ * @return Avance con su tramo resuelto.
+ */
+PathProgress WaypointPath::progressAt(float distance) const {
+    PathProgress progress;
+    progress.distance = wrapDistance(distance);
+    progress.segment = findSegment(progress.distance, 0);
+    return progress;
+}
+
+/**
+ * @brief Punto de la ruta más cercano a una posición.
+ *
+ * @param point Posición a proyectar.
+ * @return Avance del punto más cercano.
+ */
+PathProgress WaypointPath::closestProgress(const sf::Vector2f& point) const {
+    PathProgress best;
+    float bestDistanceSquared = std::numeric_limits<float>::max();
+    for (std::size_t i = 0; i < m_directions.size(); ++i) {
+        float segmentLength = m_starts[i + 1] - m_starts[i];
+        sf::Vector2f offset = point - m_points[i];
+        float along = std::clamp(offset.x * m_directions[i].x + offset.y * m_directions[i].y, 0.0f, segmentLength);
+        sf::Vector2f gap = offset - m_directions[i] * along;
+        float distanceSquared = gap.x * gap.x + gap.y * gap.y;
+        if (distanceSquared < bestDistanceSquared) {
+            bestDistanceSquared = distanceSquared;
+            best.segment = static_cast<sf::Uint32>(i);
+            best.distance = m_starts[i] + along;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Lleva una distancia al rango válido de la ruta.
+ *
+ * @param distance Distancia arbitraria.
+ * @return Distancia en [0, longitud] (dando la vuelta si la ruta es cerrada).
+ */
+float WaypointPath::wrapDistance(float distance) const {
+    if (m_length <= 0.0f) {
+        return 0.0f;
+    }
+    if (!m_closed) {
+        return std::clamp(distance, 0.0f, m_length);
+    }
+    if (distance >= m_length || distance < 0.0f) {
+        distance -= m_length * std::floor(distance / m_length);
+        // El redondeo puede dejar exactamente `m_length`: equivale al inicio.
+        if (distance >= m_length) distance = 0.0f;
+    }
+    return distance;
+}
+
+/**
+ * @brief Resuelve el tramo de una distancia partiendo de una pista.
+ *
+ * Un agente avanza poco por tick: casi siempre sigue en el mismo tramo o pasa al
+ * siguiente. Si la pista no sirve (dio la vuelta o retrocedió), se busca en binario.
+ *
+ * @param distance Distancia ya acotada con `wrapDistance`.
+ * @param hint Tramo donde estaba el agente.
+ * @return Tramo que contiene la distancia.
+ */
+sf::Uint32 WaypointPath::findSegment(float distance, sf::Uint32 hint) const {
+    if (m_directions.empty()) {
+        return 0;
+    }
+    const sf::Uint32 last = static_cast<sf::Uint32>(m_directions.size() - 1);
+    sf::Uint32 segment = std::min(hint, last);
+    if (distance >= m_starts[segment]) {
+        for (int step = 0; step < 2 && segment < last && distance >= m_starts[segment + 1]; ++step) {
+            ++segment;
+        }
+        if (segment == last || distance < m_starts[segment + 1]) {
+            return segment;
+        }
+    }
+    // upper_bound da el primer inicio mayor que la distancia: el tramo es el anterior.
+    auto it = std::upper_bound(m_starts.begin(), m_starts.begin() + last + 1, distance);
+    return static_cast<sf::Uint32>(std::max<std::ptrdiff_t>(0, (it - m_starts.begin()) - 1));
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include "Prerequisites.h"  // Incluye dependencias esenciales.
+
+/**
+ * @struct PathProgress
+ * @brief Avance de un agente sobre un `WaypointPath`: todo lo que el agente guarda.
+ *
+ * `segment` es solo una pista para no buscar el tramo desde cero cada tick; la posición
+ * queda determinada por `distance` (longitud de arco desde el primer waypoint).
+ */
+struct PathProgress {
+    sf::Uint32 segment = 0;  ///< Tramo donde está el agente (pista de búsqueda).
+    float distance = 0.0f;   ///< Distancia recorrida desde el inicio de la ruta.
+};
+
+/**
+ * @class WaypointPath
+ * @brief Ruta inmutable de waypoints compartida por todos los agentes que la recorren.
+ *
+ * Al construirla se precalculan la dirección y la longitud de cada tramo y la longitud
+ * acumulada al inicio de cada uno. La ruta queda parametrizada por longitud de arco:
+ * avanzar `speed * deltaTime` recorre siempre la misma distancia, sin importar lo largo o
+ * corto que sea cada tramo, y cada agente solo necesita un `PathProgress` de 8 bytes.
+ *
+ * Después de construida solo tiene métodos const, así que cualquier número de hilos la
+ * puede leer a la vez sin sincronización.
+ */
+class WaypointPath {
+public:
+    /**
+     * @brief Constructor.
+     *
+     * Los waypoints repetidos consecutivos se descartan (tramos de longitud cero).
+     *
+     * @param points Waypoints en orden de recorrido.
+     * @param closed true si después del último waypoint se vuelve al primero.
+     */
+    explicit WaypointPath(const std::vector<sf::Vector2f>& points, bool closed = true);
+
+    /**
+     * @brief Avanza un agente sobre la ruta.
+     *
+     * En una ruta cerrada la distancia da la vuelta; en una abierta se detiene en los
+     * extremos. El costo es O(1) amortizado: se parte del tramo guardado en `progress`.
+     *
+     * @param progress Avance del agente (se actualiza).
+     * @param delta Distancia a recorrer (negativa para retroceder).
+     * @return Nueva posición del agente.
+     */
+    sf::Vector2f advance(PathProgress& progress, float delta) const;
+
+    /**
+     * @brief Posición correspondiente a un avance.
+     *
+     * @param progress Avance sobre la ruta.
+     * @return Punto de la ruta.
+     */
+    sf::Vector2f getPosition(const PathProgress& progress) const;
+
+    /**
+     * @brief Dirección de la ruta en un avance.
+     *
+     * @param progress Avance sobre la ruta.
+     * @return Vector unitario del tramo actual (cero si la ruta no tiene tramos).
+     */
+    sf::Vector2f getDirection(const PathProgress& progress) const;
+
+    /**
+     * @brief Avance correspondiente a una distancia desde el inicio (búsqueda binaria).
+     *
+     * @param distance Distancia desde el primer waypoint.
+     * @return Avance con su tramo resuelto.
+     */
+    PathProgress progressAt(float distance) const;
+
+    /**
+     * @brief Punto de la ruta más cercano a una posición.
+     *
+     * Sirve para reincorporar a un agente que salió de la ruta.
+     *
+     * @param point Posición a proyectar.
+     * @return Avance del punto más cercano.
+     */
+    PathProgress closestProgress(const sf::Vector2f& point) const;
+
+    /**
+     * @brief Longitud total de la ruta (incluye el tramo de cierre si es cerrada).
+     *
+     * @return Longitud en píxeles.
+     */
+    float getLength() const { return m_length; }
+
+    /**
+     * @brief Indica si la ruta se recorre en bucle.
+     *
+     * @return true si es cerrada.
+     */
+    bool isClosed() const { return m_closed; }
+
+    /**
+     * @brief Waypoints de la ruta (sin repetidos).
+     *
+     * @return Waypoints en orden de recorrido.
+     */
+    const std::vector<sf::Vector2f>& getPoints() const { return m_points; }
+
+private:
+    /**
+     * @brief Lleva una distancia al rango válido de la ruta.
+     *
+     * @param distance Distancia arbitraria.
+     * @return Distancia en [0, longitud] (dando la vuelta si la ruta es cerrada).
+     */
+    float wrapDistance(float distance) const;
+
+    /**
+     * @brief Resuelve el tramo de una distancia partiendo de una pista.
+     *
+     * @param distance Distancia ya acotada con `wrapDistance`.
+     * @param hint Tramo donde estaba el agente.
+     * @return Tramo que contiene la distancia.
+     */
+    sf::Uint32 findSegment(float distance, sf::Uint32 hint) const;
+
+    std::vector<sf::Vector2f> m_points;      ///< Waypoints sin repetidos consecutivos.
+    std::vector<sf::Vector2f> m_directions;  ///< Dirección unitaria de cada tramo.
+    std::vector<float> m_starts;             ///< Distancia acumulada al inicio de cada tramo (más la longitud total al final).
+    float m_length = 0.0f;                   ///< Longitud total.
+    bool m_closed = true;                    ///< La ruta vuelve al primer waypoint.
+};
@@ -1,19 +1,49 @@
 #include "Window.h"
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include "../Include/IMGUI/imgui.h"
+#include "../Include/IMGUI/imgui-SFML.h"
+#include <iostream>
+
+namespace {
+    /**
+     * @brief Vértices que envía un `sf::Drawable` de los tipos conocidos.
+     *
+     * @param drawable Objeto a dibujar.
+     * @return Número de vértices (0 si el tipo no expone su geometría).
+     */
+    std::size_t countVertices(const sf::Drawable& drawable) {
+        if (const sf::Shape* shape = dynamic_cast<const sf::Shape*>(&drawable)) {
+            // Abanico del relleno: centro, puntos y el primero repetido para cerrar.
+            return shape->getPointCount() + 2;
+        }
+        if (dynamic_cast<const sf::Sprite*>(&drawable) != nullptr) {
+            return 4;
+        }
+        if (const sf::VertexArray* array = dynamic_cast<const sf::VertexArray*>(&drawable)) {
+            return array->getVertexCount();
+        }
+        if (const sf::VertexBuffer* buffer = dynamic_cast<const sf::VertexBuffer*>(&drawable)) {
+            return buffer->getVertexCount();
+        }
+        return 0;
+    }
+}
 
 /**
  * @brief Constructor parametrizado.
  *
- * Crea una ventana con las dimensiones y ttulo proporcionados. Tambin inicializa ImGui.
+ * Crea una ventana con las dimensiones y título proporcionados. También inicializa ImGui.
  *
- * @param width Ancho de la ventana en pxeles.
- * @param height Altura de la ventana en pxeles.
- * @param title Ttulo de la ventana.
+ * @param width Ancho de la ventana en píxeles.
+ * @param height Altura de la ventana en píxeles.
+ * @param title Título de la ventana.
  */
 Window::Window(int width, int height, const std::string& title) {
     // Crear la ventana con SFML.
     m_window = new sf::RenderWindow(sf::VideoMode(width, height), title);
 
-    // Verificar si la ventana se cre correctamente.
+    // Verificar si la ventana se creó correctamente.
     if (!m_window) {
         ERROR("Window", "Window", "CHECK CONSTRUCTOR");
     }
@@ -21,6 +51,9 @@ Window::Window(int width, int height, const std::string& title) {
         MESSAGE("Window", "Window", "OK");
     }
 
+    // Vista inicial; se ajusta al redimensionar y viaja en cada snapshot de render.
+    m_view = m_window->getView();
+
     // Inicializar ImGui con la ventana de SFML.
     ImGui::SFML::Init(*m_window);
 }
@@ -31,6 +64,8 @@ Window::Window(int width, int height, const std::string& title) {
  * Libera los recursos utilizados por la ventana y apaga ImGui.
  */
 Window::~Window() {
+    // Detener el hilo de render para recuperar el contexto de OpenGL en este hilo.
+    setRenderThreadEnabled(false);
     // Apagar ImGui.
     ImGui::SFML::Shutdown();
     // Liberar la memoria de la ventana.
@@ -40,42 +75,77 @@ Window::~Window() {
 /**
  * @brief Maneja los eventos de la ventana.
  *
- * Procesa los eventos del usuario, como cerrar la ventana o cambiar su tamao.
+ * Primero vacía la cola del sistema en `m_frameEvents` y después la recorre: así la
+ * entrada se procesa por lotes y el resto del frame trabaja con un conjunto estable.
  */
 void Window::handleEvents() {
+    m_frameEvents.clear();
     sf::Event event;
     while (m_window->pollEvent(event)) {
-        // Procesar los eventos para ImGui.
-        ImGui::SFML::ProcessEvent(event);
+        m_frameEvents.push_back(event);
+    }
 
-        switch (event.type) {
+    for (const sf::Event& frameEvent : m_frameEvents) {
+        // Procesar los eventos para ImGui. Con hilo de render, ImGui vive en ese hilo y
+        // los eventos viajan con el siguiente snapshot.
+        if (m_useRenderThread) {
+            m_pendingUIEvents.push_back(frameEvent);
+        }
+        else {
+            ImGui::SFML::ProcessEvent(*m_window, frameEvent);
+        }
+
+        switch (frameEvent.type) {
         case sf::Event::Closed:
-            // Cerrar la ventana si se detecta el evento de cierre.
+            // Detener el hilo de render antes de destruir el contexto y cerrar la ventana.
+            setRenderThreadEnabled(false);
             m_window->close();
             break;
 
         case sf::Event::Resized:
-            // Obtener el nuevo tamao de la ventana.
-            unsigned int width = event.size.width;
-            unsigned int height = event.size.height;
-
-            // Ajustar la vista de la ventana al nuevo tamao.
-            m_view = m_window->getView();
-            m_view.setSize(static_cast<float>(width), static_cast<float>(height));
-            m_window->setView(m_view);
+            // Ajustar la vista de la ventana al nuevo tamaño (con hilo de render se aplica
+            // al presentar el snapshot).
+            m_view.setSize(static_cast<float>(frameEvent.size.width), static_cast<float>(frameEvent.size.height));
+            if (!m_useRenderThread) {
+                m_window->setView(m_view);
+            }
+            break;
+
+        default:
             break;
         }
     }
 }
 
+/**
+ * @brief Eventos sacados por el último `handleEvents`.
+ *
+ * @return Eventos del frame en orden de llegada.
+ */
+const std::vector<sf::Event>& Window::getFrameEvents() const {
+    return m_frameEvents;
+}
+
 /**
  * @brief Limpia la ventana para preparar un nuevo frame.
  *
  * Borra todo lo que se muestra actualmente en la ventana.
  */
 void Window::clear() {
-    if (m_window != nullptr) {
-        m_window->clear();
+    if (m_useSoftwareRendering) {
+        m_softwareRasterizer->setView(m_view);
+        m_softwareRasterizer->clear();
+    }
+    else if (m_window != nullptr) {
+        if (m_useRenderThread) {
+            // Empezar a grabar el siguiente frame en el búfer trasero.
+            RenderSnapshot& snapshot = m_renderThread.getBackBuffer();
+            snapshot.clear();
+            snapshot.view = m_view;
+        }
+        else {
+            m_window->clear();
+        }
     }
     else {
         ERROR("Window", "clear", "CHECK FOR WINDOW POINTER DATA");
@@ -85,11 +155,33 @@ void Window::clear() {
 /**
  * @brief Muestra en pantalla el contenido dibujado.
  *
- * Realiza un "flip" para actualizar la ventana con el contenido ms reciente.
+ * Realiza un "flip" para actualizar la ventana con el contenido más reciente.
  */
 void Window::display() {
-    if (m_window != nullptr) {
-        m_window->display();
+    PROFILE_SCOPE("Window::display");
+
+    m_lastFrameCounters = m_frameCounters;
+    m_frameCounters = RenderCounters();
+
+    if (m_useSoftwareRendering) {
+        m_framePacer.waitForNextFrame();
+        m_softwareRasterizer->flush();
+        m_framePacer.recordFrame();
+    }
+    else if (m_window != nullptr) {
+        if (m_useRenderThread) {
+            // Enviar el frame grabado; solo espera si el hilo de render sigue con el anterior.
+            RenderSnapshot& snapshot = m_renderThread.getBackBuffer();
+            snapshot.uiEvents.swap(m_pendingUIEvents);
+            m_pendingUIEvents.clear();
+            m_renderThread.submit();
+        }
+        else {
+            m_framePacer.applyPendingMode(*m_window);
+            m_framePacer.waitForNextFrame();
+            m_window->display();
+            m_framePacer.recordFrame();
+        }
     }
     else {
         ERROR("Window", "display", "CHECK FOR WINDOW POINTER DATA");
@@ -99,7 +191,7 @@ void Window::display() {
 /**
  * @brief Verifica si la ventana sigue abierta.
  *
- * @return true si la ventana est abierta, false si se ha cerrado.
+ * @return true si la ventana está abierta, false si se ha cerrado.
  */
 bool Window::isOpen() const {
     if (m_window != nullptr) {
@@ -116,11 +208,57 @@ bool Window::isOpen() const {
  *
  * Recibe cualquier objeto que herede de `sf::Drawable` y lo muestra en la ventana.
  *
- * @param drawable El objeto a dibujar (como un crculo o rectngulo).
+ * @param drawable El objeto a dibujar (como un círculo o rectángulo).
+ * @param states Estados de render a aplicar.
  */
-void Window::draw(const sf::Drawable& drawable) {
-    if (m_window != nullptr) {
-        m_window->draw(drawable);
+void Window::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    if (m_useSoftwareRendering) {
+        // Un `sf::Drawable` se dibuja directo en OpenGL y no expone su geometría: se omite
+        // (avisando una sola vez, ya que `ERROR` terminaría el programa).
+        static bool warned = false;
+        if (!warned) {
+            std::cerr << "Window::draw : el renderizador por software no soporta sf::Drawable; se omite.\n";
+            warned = true;
+        }
+    }
+    else if (m_window != nullptr) {
+        m_frameCounters.drawCalls++;
+        m_frameCounters.vertices += countVertices(drawable);
+        if (m_useRenderThread) {
+            m_renderThread.getBackBuffer().addDrawable(drawable, states);
+        }
+        else {
+            m_window->draw(drawable, states);
+        }
+    }
+    else {
+        ERROR("Window", "draw", "CHECK FOR WINDOW POINTER DATA");
+    }
+}
+
+/**
+ * @brief Dibuja un arreglo de vértices en la ventana.
+ *
+ * @param vertices Puntero al primer vértice.
+ * @param vertexCount Número de vértices.
+ * @param type Tipo de primitiva.
+ * @param states Estados de render a aplicar.
+ */
+void Window::draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                  const sf::RenderStates& states) {
+    m_frameCounters.drawCalls++;
+    m_frameCounters.vertices += vertexCount;
+
+    if (m_useSoftwareRendering) {
+        m_softwareRasterizer->draw(vertices, vertexCount, type, states);
+    }
+    else if (m_window != nullptr) {
+        if (m_useRenderThread) {
+            m_renderThread.getBackBuffer().addVertices(vertices, vertexCount, type, states);
+        }
+        else {
+            m_window->draw(vertices, vertexCount, type, states);
+        }
     }
     else {
         ERROR("Window", "draw", "CHECK FOR WINDOW POINTER DATA");
@@ -147,20 +285,43 @@ sf::RenderWindow* Window::getWindow() {
 /**
  * @brief Actualiza la ventana cada frame.
  *
- * Calcula el `deltaTime` y actualiza ImGui con ese valor.
+ * Calcula el `deltaTime` y lo acumula para el siguiente frame de ImGui.
  */
 void Window::update() {
-    // Reiniciar el reloj y obtener el tiempo transcurrido desde el ltimo frame.
+    // Reiniciar el reloj y obtener el tiempo transcurrido desde el último frame.
     deltaTime = clock.restart();
 
-    // Actualizar ImGui con el nuevo deltaTime.
-    ImGui::SFML::Update(*m_window, deltaTime);
+    // ImGui se actualiza al renderizar (posiblemente en el hilo de render).
+    m_uiDeltaTime += deltaTime;
 }
 
 /**
  * @brief Renderiza el contenido de ImGui en la ventana.
+ *
+ * Sin hilo de render actualiza ImGui, construye la interfaz y la dibuja aquí mismo;
+ * con hilo de render solo marca el snapshot para que lo haga el hilo.
  */
 void Window::render() {
+    // La interfaz solo existe en OpenGL; el backend por software dibuja la escena.
+    if (m_useSoftwareRendering) {
+        m_uiDeltaTime = sf::Time::Zero;
+        return;
+    }
+
+    if (m_useRenderThread) {
+        RenderSnapshot& snapshot = m_renderThread.getBackBuffer();
+        snapshot.renderUI = true;
+        snapshot.uiDeltaTime = m_uiDeltaTime;
+        m_uiDeltaTime = sf::Time::Zero;
+        return;
+    }
+
+    PROFILE_SCOPE("ImGui::SFML::Render");
+    ImGui::SFML::Update(*m_window, m_uiDeltaTime);
+    m_uiDeltaTime = sf::Time::Zero;
+    if (m_uiCallback) {
+        m_uiCallback();
+    }
     ImGui::SFML::Render(*m_window);
 }
 
@@ -170,6 +331,195 @@ void Window::render() {
  * Usa la macro `SAFE_PTR_RELEASE` para liberar la memoria de forma segura.
  */
 void Window::destroy() {
+    setRenderThreadEnabled(false);
     ImGui::SFML::Shutdown();
     SAFE_PTR_RELEASE(m_window);
 }
+
+/**
+ * @brief Registra la función que construye la interfaz de ImGui cada frame.
+ *
+ * @param callback Función con las llamadas de ImGui de la aplicación.
+ */
+void Window::setUICallback(std::function<void()> callback) {
+    waitForRenderThread();
+    m_uiCallback = callback;
+}
+
+/**
+ * @brief Activa o desactiva el hilo de render dedicado.
+ *
+ * El contexto de OpenGL de la ventana solo puede estar activo en un hilo: al activar el
+ * hilo de render se desactiva aquí y se activa allá, y al detenerlo se recupera.
+ *
+ * @param enabled true para presentar los frames desde un hilo dedicado.
+ */
+void Window::setRenderThreadEnabled(bool enabled) {
+    if (m_window == nullptr || enabled == m_useRenderThread || (enabled && m_useSoftwareRendering)) {
+        return;
+    }
+
+    if (enabled) {
+        m_window->setActive(false);
+        m_renderThread.start(
+            [this]() { m_window->setActive(true); },
+            [this](RenderSnapshot& snapshot) { presentSnapshot(snapshot); },
+            [this]() { m_window->setActive(false); });
+        m_useRenderThread = true;
+    }
+    else {
+        m_renderThread.stop();
+        m_useRenderThread = false;
+        m_pendingUIEvents.clear();
+        m_window->setActive(true);
+        m_window->setView(m_view);
+    }
+}
+
+/**
+ * @brief Indica si el hilo de render dedicado está activo.
+ *
+ * @return true si los frames se presentan desde el hilo de render.
+ */
+bool Window::isRenderThreadEnabled() const {
+    return m_useRenderThread;
+}
+
+/**
+ * @brief Espera a que el hilo de render termine el frame en vuelo.
+ */
+void Window::waitForRenderThread() {
+    if (m_useRenderThread) {
+        m_renderThread.waitIdle();
+    }
+}
+
+/**
+ * @brief Activa o desactiva el backend de render por software.
+ *
+ * El rasterizador se crea la primera vez con el tamaño de la vista y conserva las
+ * texturas registradas aunque el backend se desactive.
+ *
+ * @param enabled true para rasterizar por CPU.
+ */
+void Window::setSoftwareRendering(bool enabled) {
+    if (enabled == m_useSoftwareRendering) {
+        return;
+    }
+
+    if (enabled) {
+        // Los frames ya no pasan por OpenGL: el hilo de render no tiene nada que presentar.
+        setRenderThreadEnabled(false);
+
+        unsigned int width = static_cast<unsigned int>(m_view.getSize().x);
+        unsigned int height = static_cast<unsigned int>(m_view.getSize().y);
+        if (m_softwareRasterizer.isNull()) {
+            m_softwareRasterizer.reset(new SoftwareRasterizer(width, height));
+        }
+        else if (m_softwareRasterizer->getWidth() != width || m_softwareRasterizer->getHeight() != height) {
+            m_softwareRasterizer->resize(width, height);
+        }
+    }
+
+    m_useSoftwareRendering = enabled;
+}
+
+/**
+ * @brief Indica si el backend de render por software está activo.
+ *
+ * @return true si los frames se rasterizan por CPU.
+ */
+bool Window::isSoftwareRendering() const {
+    return m_useSoftwareRendering;
+}
+
+/**
+ * @brief Acceso al rasterizador por software.
+ *
+ * @return Puntero al rasterizador, o nullptr si el backend nunca se activó.
+ */
+SoftwareRasterizer* Window::getSoftwareRasterizer() {
+    return m_softwareRasterizer.get();
+}
+
+/**
+ * @brief Elige cómo se espacian los frames presentados.
+ *
+ * @param mode VSync, limitador propio o sin límite.
+ * @param targetFrameRate Frames por segundo del limitador.
+ */
+void Window::setFramePacing(FramePacingMode mode, float targetFrameRate) {
+    m_framePacer.setMode(mode, targetFrameRate);
+}
+
+/**
+ * @brief Estadísticas del ritmo de presentación de los últimos frames.
+ *
+ * @return Tiempo medio, extremos, percentiles y jitter entre frames.
+ */
+FramePacer::Stats Window::getFrameStats() const {
+    return m_framePacer.getStats();
+}
+
+/**
+ * @brief Tiempos entre los últimos frames presentados.
+ *
+ * @param out Recibe los tiempos en milisegundos, del más antiguo al más reciente.
+ */
+void Window::getFrameTimes(std::vector<float>& out) const {
+    m_framePacer.getFrameTimes(out);
+}
+
+/**
+ * @brief Llamadas de dibujo y vértices del último frame mostrado.
+ *
+ * @return Contadores del último frame completo.
+ */
+const Window::RenderCounters& Window::getLastFrameCounters() const {
+    return m_lastFrameCounters;
+}
+
+/**
+ * @brief Presenta un snapshot completo en el hilo de render.
+ *
+ * Reproduce los comandos grabados en orden, procesa los eventos de ImGui y construye
+ * su interfaz (si el frame la incluye) y finalmente muestra el resultado.
+ *
+ * @param snapshot Frame a presentar.
+ */
+void Window::presentSnapshot(RenderSnapshot& snapshot) {
+    PROFILE_SCOPE("Window::presentSnapshot");
+
+    m_window->setView(snapshot.view);
+    m_window->clear(snapshot.clearColor);
+
+    for (const RenderCommand& command : snapshot.commands) {
+        if (command.drawable != nullptr) {
+            m_window->draw(*command.drawable, command.states);
+        }
+        else if (command.vertexCount > 0) {
+            m_window->draw(&snapshot.vertices[command.firstVertex], command.vertexCount,
+                           command.type, command.states);
+        }
+    }
+
+    if (snapshot.renderUI) {
+        PROFILE_SCOPE("ImGui::SFML::Render");
+        for (const sf::Event& event : snapshot.uiEvents) {
+            ImGui::SFML::ProcessEvent(*m_window, event);
+        }
+        ImGui::SFML::Update(*m_window, snapshot.uiDeltaTime);
+        if (m_uiCallback) {
+            m_uiCallback();
+        }
+        ImGui::SFML::Render(*m_window);
+    }
+
+    {
+        PROFILE_SCOPE("sf::RenderWindow::display");
+        m_framePacer.applyPendingMode(*m_window);
+        m_framePacer.waitForNextFrame();
+        m_window->display();
+        m_framePacer.recordFrame();
+    }
+}
@@ -1,31 +1,45 @@
 #pragma once 
 #include "Prerequisites.h"  // Incluye las bibliotecas y dependencias esenciales.
+#include "RenderThread.h"   // Hilo de render con snapshots de doble búfer.
+#include "SoftwareRasterizer.h"  // Backend de render por CPU.
+#include "FramePacer.h"     // Ritmo de presentación (VSync, limitador, sin límite).
+#include "Profiler.h"       // Zonas de perfilado de CPU.
+#include <SFML/Graphics/RenderWindow.hpp>
 
 /**
  * @class Window
  * @brief Clase que gestiona la ventana principal del proyecto.
  *
- * Esta clase controla la creacin, actualizacin, renderizado y destruccin
- * de la ventana utilizando la biblioteca SFML. Tambin maneja el tiempo entre
- * frames para clculos precisos y permite manipular la vista de la ventana.
+ * Esta clase controla la creación, actualización, renderizado y destrucción
+ * de la ventana utilizando la biblioteca SFML. También maneja el tiempo entre
+ * frames para cálculos precisos y permite manipular la vista de la ventana.
  */
 class Window {
 public:
+    /**
+     * @struct RenderCounters
+     * @brief Trabajo de render enviado en un frame.
+     */
+    struct RenderCounters {
+        std::size_t drawCalls = 0;  ///< Llamadas a `draw`.
+        std::size_t vertices = 0;   ///< Vértices enviados (los de formas, sprites y buffers incluidos).
+    };
+
     /**
      * @brief Constructor por defecto.
      *
-     * No realiza ninguna operacin especial.
+     * No realiza ninguna operación especial.
      */
     Window() = default;
 
     /**
      * @brief Constructor parametrizado.
      *
-     * Crea una ventana con las dimensiones y ttulo especificados.
+     * Crea una ventana con las dimensiones y título especificados.
      *
      * @param width Ancho de la ventana.
      * @param height Altura de la ventana.
-     * @param title Ttulo de la ventana.
+     * @param title Título de la ventana.
      */
     Window(int width, int height, const std::string& title);
 
@@ -39,10 +53,20 @@ public:
     /**
      * @brief Maneja los eventos de la ventana.
      *
-     * Procesa eventos como cerrar, minimizar o mover la ventana.
+     * Saca de una vez todos los eventos pendientes (ver `getFrameEvents`) y procesa los
+     * que afectan a la ventana: cerrar, cambiar de tamaño y los que consume ImGui.
      */
     void handleEvents();
 
+    /**
+     * @brief Eventos sacados por el último `handleEvents`.
+     *
+     * Es el lote que se entrega a `InputSystem::processEvents`.
+     *
+     * @return Eventos del frame en orden de llegada.
+     */
+    const std::vector<sf::Event>& getFrameEvents() const;
+
     /**
      * @brief Limpia el contenido de la ventana.
      *
@@ -53,25 +77,43 @@ public:
     /**
      * @brief Muestra en pantalla el contenido dibujado.
      *
-     * Realiza un "flip" para actualizar la ventana con el contenido ms reciente.
+     * Realiza un "flip" para actualizar la ventana con el contenido más reciente.
      */
     void display();
 
     /**
      * @brief Verifica si la ventana sigue abierta.
      *
-     * @return true si la ventana est abierta, false si se ha cerrado.
+     * @return true si la ventana está abierta, false si se ha cerrado.
      */
     bool isOpen() const;
 
     /**
      * @brief Dibuja un objeto en la ventana.
      *
-     * Recibe cualquier objeto que herede de `sf::Drawable` para dibujarlo.
+     * Recibe cualquier objeto que herede de `sf::Drawable` para dibujarlo. Con el hilo de
+     * render activo solo se graba un puntero: el objeto debe seguir vivo y sin cambios hasta
+     * que el frame se presente (ver `waitForRenderThread`).
+     *
+     * @param drawable Objeto a dibujar (como un círculo o rectángulo).
+     * @param states Estados de render (transformación, textura, mezcla) a aplicar.
+     */
+    void draw(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /**
+     * @brief Dibuja un arreglo de vértices en la ventana.
      *
-     * @param drawable Objeto a dibujar (como un crculo o rectngulo).
+     * Permite dibujar geometría compartida (por ejemplo, plantillas de formas) sin
+     * envolverla en un `sf::Drawable`. Con el hilo de render activo los vértices se copian
+     * al snapshot del frame, así que el arreglo puede reutilizarse de inmediato.
+     *
+     * @param vertices Puntero al primer vértice.
+     * @param vertexCount Número de vértices.
+     * @param type Tipo de primitiva (triángulos, abanico, etc.).
+     * @param states Estados de render a aplicar.
      */
-    void draw(const sf::Drawable& drawable);
+    void draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+              const sf::RenderStates& states = sf::RenderStates::Default);
 
     /**
      * @brief Obtiene el puntero a la ventana interna de SFML.
@@ -85,12 +127,12 @@ public:
     /**
      * @brief Inicializa la ventana.
      *
-     * Realiza la configuracin inicial necesaria para mostrar la ventana.
+     * Realiza la configuración inicial necesaria para mostrar la ventana.
      */
     void init();
 
     /**
-     * @brief Actualiza la lgica de la ventana cada frame.
+     * @brief Actualiza la lógica de la ventana cada frame.
      *
      * Usa el `deltaTime` para calcular el tiempo transcurrido entre frames
      * y actualizar animaciones o movimientos.
@@ -100,7 +142,8 @@ public:
     /**
      * @brief Renderiza el contenido de la ventana.
      *
-     * Dibuja todos los elementos que deben mostrarse en la ventana.
+     * Dibuja la interfaz de ImGui: actualiza ImGui, ejecuta el callback de interfaz y
+     * envía sus comandos. Con el hilo de render activo todo esto ocurre en ese hilo.
      */
     void render();
 
@@ -111,9 +154,130 @@ public:
      */
     void destroy();
 
+    /**
+     * @brief Registra la función que construye la interfaz de ImGui cada frame.
+     *
+     * Con el hilo de render activo el callback se ejecuta en ese hilo, en paralelo con la
+     * simulación del siguiente frame: solo debe leer datos que no cambien durante el frame
+     * o que estén protegidos.
+     *
+     * @param callback Función con las llamadas `ImGui::Begin`/`ImGui::End` de la aplicación.
+     */
+    void setUICallback(std::function<void()> callback);
+
+    /**
+     * @brief Activa o desactiva el hilo de render dedicado.
+     *
+     * Con el hilo activo, `clear`/`draw` graban un snapshot del frame y `display` lo envía
+     * al hilo de render, que lo presenta mientras la simulación avanza al siguiente frame.
+     *
+     * @param enabled true para presentar los frames desde un hilo dedicado.
+     */
+    void setRenderThreadEnabled(bool enabled);
+
+    /**
+     * @brief Indica si el hilo de render dedicado está activo.
+     *
+     * @return true si los frames se presentan desde el hilo de render.
+     */
+    bool isRenderThreadEnabled() const;
+
+    /**
+     * @brief Espera a que el hilo de render termine el frame en vuelo.
+     *
+     * Debe llamarse antes de modificar o destruir un objeto grabado con `draw(drawable)`.
+     * No hace nada si el hilo de render está desactivado.
+     */
+    void waitForRenderThread();
+
+    /**
+     * @brief Activa o desactiva el backend de render por software.
+     *
+     * Con el backend activo, `clear`/`draw`/`display` rasterizan en un búfer RGBA en
+     * memoria del tamaño de la ventana en lugar de usar OpenGL; la ventana de SFML no se
+     * actualiza y la interfaz de ImGui no se dibuja. Desactiva el hilo de render.
+     *
+     * @param enabled true para rasterizar por CPU.
+     */
+    void setSoftwareRendering(bool enabled);
+
+    /**
+     * @brief Indica si el backend de render por software está activo.
+     *
+     * @return true si los frames se rasterizan por CPU.
+     */
+    bool isSoftwareRendering() const;
+
+    /**
+     * @brief Acceso al rasterizador por software (para registrar texturas o leer el frame).
+     *
+     * @return Puntero al rasterizador, o nullptr si el backend nunca se activó.
+     */
+    SoftwareRasterizer* getSoftwareRasterizer();
+
+    /**
+     * @brief Elige cómo se espacian los frames presentados.
+     *
+     * Se aplica en el hilo que presenta (el principal o el de render) antes del siguiente
+     * `display`. Con el hilo de render activo el limitador frena también a la simulación,
+     * porque `display` espera a que el frame anterior se haya presentado.
+     *
+     * @param mode VSync, limitador propio o sin límite.
+     * @param targetFrameRate Frames por segundo del limitador.
+     */
+    void setFramePacing(FramePacingMode mode, float targetFrameRate = 60.0f);
+
+    /**
+     * @brief Estadísticas del ritmo de presentación de los últimos frames.
+     *
+     * @return Tiempo medio, extremos, percentiles y jitter entre frames.
+     */
+    FramePacer::Stats getFrameStats() const;
+
+    /**
+     * @brief Tiempos entre los últimos frames presentados.
+     *
+     * @param out Recibe los tiempos en milisegundos, del más antiguo al más reciente.
+     */
+    void getFrameTimes(std::vector<float>& out) const;
+
+    /**
+     * @brief Llamadas de dibujo y vértices del último frame mostrado.
+     *
+     * Se cuentan al llamar a `draw` y se cierran en `display`; solo deben leerse desde
+     * el hilo que dibuja (el de la simulación).
+     *
+     * @return Contadores del último frame completo.
+     */
+    const RenderCounters& getLastFrameCounters() const;
+
 private:
-    sf::RenderWindow* m_window;  ///< Puntero a la ventana de SFML donde se dibujan los elementos.
-    sf::View m_view;  ///< Vista de la ventana para manipular la cmara o perspectiva.
+    /**
+     * @brief Presenta un snapshot completo: escena, interfaz y `display`.
+     *
+     * Se ejecuta en el hilo de render con el contexto de OpenGL activo.
+     *
+     * @param snapshot Frame a presentar.
+     */
+    void presentSnapshot(RenderSnapshot& snapshot);
+
+    sf::RenderWindow* m_window = nullptr;  ///< Puntero a la ventana de SFML donde se dibujan los elementos.
+    sf::View m_view;  ///< Vista de la ventana para manipular la cámara o perspectiva.
+
+    RenderThread m_renderThread;  ///< Hilo que presenta los snapshots de cada frame.
+    bool m_useRenderThread = false;  ///< Si los frames se graban para el hilo de render.
+    std::vector<sf::Event> m_frameEvents;  ///< Lote de eventos del frame actual.
+    std::vector<sf::Event> m_pendingUIEvents;  ///< Eventos para ImGui que se envían con el siguiente frame.
+    std::function<void()> m_uiCallback;  ///< Construye la interfaz de ImGui.
+    sf::Time m_uiDeltaTime;  ///< Tiempo acumulado desde el último frame de ImGui.
+
+    EngineUtilities::TUniquePtr<SoftwareRasterizer> m_softwareRasterizer;  ///< Backend de render por CPU.
+    bool m_useSoftwareRendering = false;  ///< Si los frames se rasterizan por CPU.
+
+    FramePacer m_framePacer;  ///< Ritmo de presentación y estadísticas de jitter.
+
+    RenderCounters m_frameCounters;      ///< Contadores del frame que se está dibujando.
+    RenderCounters m_lastFrameCounters;  ///< Contadores del último frame mostrado.
 
 public:
     sf::Time deltaTime;  ///< Tiempo transcurrido entre frames.